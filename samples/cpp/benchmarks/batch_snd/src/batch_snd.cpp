@@ -0,0 +1,142 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define TOPIC_NUMBER        40
+#define PAYLOAD_SIZE       256
+#define CYCLE_NUMBER      5000
+
+namespace
+{
+  class CStringPayload : public eCAL::CPayloadWriter
+  {
+  public:
+    explicit CStringPayload(const std::string& s_) : s(s_) {}
+
+    bool WriteFull(void* buf_, size_t len_) override
+    {
+      if (len_ < s.size()) return false;
+      std::copy(s.begin(), s.end(), static_cast<char*>(buf_));
+      return true;
+    }
+
+    size_t GetSize() override { return s.size(); }
+
+  private:
+    const std::string& s;
+  };
+}
+
+int main(int argc, char **argv)
+{
+  // initialize eCAL API
+  eCAL::Initialize(argc, argv, "batch_snd");
+
+  // publisher and subscriber live in this process
+  eCAL::Util::EnableLoopback(true);
+
+  // default send string
+  std::string send_s = "Hello World ";
+  while(send_s.size() < PAYLOAD_SIZE)
+  {
+    send_s += send_s;
+  }
+  send_s.resize(PAYLOAD_SIZE);
+
+  // create publisher and subscriber
+  std::atomic<long long> received(0);
+  std::vector<std::unique_ptr<eCAL::CPublisher>>  pub_vec;
+  std::vector<std::unique_ptr<eCAL::CSubscriber>> sub_vec;
+  for(int i = 0; i < TOPIC_NUMBER; i++)
+  {
+    const std::string tname = "BATCH_" + std::to_string(i);
+    pub_vec.emplace_back(new eCAL::CPublisher(tname));
+    sub_vec.emplace_back(new eCAL::CSubscriber(tname));
+    sub_vec.back()->AddReceiveCallback([&received](const char*, const struct eCAL::SReceiveCallbackData*) { received++; });
+  }
+
+  // let them match
+  std::cout << "Waiting for " << TOPIC_NUMBER << " connections .." << std::endl;
+  for(;;)
+  {
+    size_t connected(0);
+    for(const auto& pub : pub_vec) if(pub->IsSubscribed()) connected++;
+    if(connected == pub_vec.size() || !eCAL::Ok()) break;
+    eCAL::Process::SleepMS(100);
+  }
+
+  // prepare the batch
+  CStringPayload payload(send_s);
+  std::vector<eCAL::SPublisherPayload> batch;
+  for(const auto& pub : pub_vec)
+  {
+    batch.push_back({ pub.get(), &payload });
+  }
+
+  while(eCAL::Ok())
+  {
+    // separate sends
+    received = 0;
+    auto start_time = std::chrono::steady_clock::now();
+    for(int cycle = 0; cycle < CYCLE_NUMBER; cycle++)
+    {
+      for(const auto& pub : pub_vec)
+      {
+        pub->Send(payload);
+      }
+    }
+    const std::chrono::duration<double, std::micro> single_time = std::chrono::steady_clock::now() - start_time;
+    eCAL::Process::SleepMS(100);
+    const long long single_received = received;
+
+    // batched sends
+    received = 0;
+    start_time = std::chrono::steady_clock::now();
+    for(int cycle = 0; cycle < CYCLE_NUMBER; cycle++)
+    {
+      eCAL::CPublisher::SendBatch(batch);
+    }
+    const std::chrono::duration<double, std::micro> batch_time = std::chrono::steady_clock::now() - start_time;
+    eCAL::Process::SleepMS(100);
+    const long long batch_received = received;
+
+    std::cout << std::endl;
+    std::cout << "Topics per cycle       : " << TOPIC_NUMBER << std::endl;
+    std::cout << "Separate Send  [us/cyc]: " << single_time.count() / CYCLE_NUMBER << " (received " << single_received << ")" << std::endl;
+    std::cout << "SendBatch      [us/cyc]: " << batch_time.count()  / CYCLE_NUMBER << " (received " << batch_received  << ")" << std::endl;
+  }
+
+  // destroy publisher and subscriber
+  sub_vec.clear();
+  pub_vec.clear();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
@@ -17,6 +17,7 @@
  * ========================= eCAL LICENSE =================================
 */
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <cstring>
@@ -49,19 +50,30 @@ int main(int argc, char** argv)
   eCAL::CSubscriber sub(topic_name);
 
   // add callback
-  std::vector<char> rec_buffer;
+  std::vector<char>   rec_buffer;
+  std::atomic<size_t> msgs(0);
+  std::atomic<size_t> bytes(0);
   auto on_receive = [&](const struct eCAL::SReceiveCallbackData* data_) {
     // make a memory copy to emulate user action
     rec_buffer.reserve(data_->size);
     std::memcpy(rec_buffer.data(), data_->buf, data_->size);
+    msgs++;
+    bytes += static_cast<size_t>(data_->size);
   };
   sub.AddReceiveCallback(std::bind(on_receive, std::placeholders::_2));
 
-  // idle main thread
+  // print the receive rate every second
   while (eCAL::Ok())
   {
-    // sleep 100 ms
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // sleep 1000 ms
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    const size_t rec_msgs  = msgs.exchange(0);
+    const size_t rec_bytes = bytes.exchange(0);
+    if (rec_msgs > 0)
+    {
+      std::cout << "Messages/s    : " << rec_msgs << std::endl;
+      std::cout << "MByte/s       : " << rec_bytes / (1024 * 1024) << std::endl << std::endl;
+    }
   }
 
   // destroy publisher
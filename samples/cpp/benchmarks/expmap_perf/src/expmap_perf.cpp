@@ -0,0 +1,88 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+// measures the registration like access pattern (touch all keys, purge, iterate) of the expiration maps
+
+#include "util/ecal_expmap.h"
+#include "util/ecal_exphashmap.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  template <typename MapT>
+  void BenchmarkMap(const std::string& name_, const std::vector<std::string>& keys_, int rounds_)
+  {
+    MapT expmap(std::chrono::milliseconds(60000));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds_; ++round)
+    {
+      // registration like access pattern, touch every key and purge afterwards
+      for (const auto& key : keys_)
+      {
+        expmap[key] = round;
+      }
+      expmap.remove_deprecated();
+    }
+    const auto touch_end = std::chrono::steady_clock::now();
+
+    size_t iterated(0);
+    for (int round = 0; round < rounds_; ++round)
+    {
+      for (const auto& entry : expmap)
+      {
+        iterated += static_cast<size_t>(entry.second);
+      }
+    }
+    const auto iterate_end = std::chrono::steady_clock::now();
+
+    const auto touches = static_cast<double>(keys_.size()) * rounds_;
+    std::cout << name_ << ": "
+      << std::chrono::duration<double, std::nano>(touch_end - start).count() / touches << " ns per touch, "
+      << std::chrono::duration<double, std::nano>(iterate_end - touch_end).count() / touches << " ns per iterated element"
+      << " (checksum " << iterated << ")" << std::endl;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  int key_count(20000);
+  int rounds(20);
+  if (argc > 1) key_count = std::max(1, std::atoi(argv[1]));
+  if (argc > 2) rounds    = std::max(1, std::atoi(argv[2]));
+
+  // topic name + topic id like keys
+  std::vector<std::string> keys;
+  for (int i = 0; i < key_count; ++i)
+  {
+    keys.emplace_back("/sensor/fusion/topic_" + std::to_string(i) + "_" + std::to_string(1000000 + i * 7919));
+  }
+
+  std::cout << key_count << " keys, " << rounds << " rounds" << std::endl;
+  BenchmarkMap<eCAL::Util::CExpMap<std::string, int>>    ("CExpMap    ", keys, rounds);
+  BenchmarkMap<eCAL::Util::CExpHashMap<std::string, int>>("CExpHashMap", keys, rounds);
+
+  return(0);
+}
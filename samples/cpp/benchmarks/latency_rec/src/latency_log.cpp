@@ -56,6 +56,9 @@ void evaluate(std::vector<long long>& lat_arr_, size_t rec_size_, size_t warmups
     ss << "Message average latency       : " << avg_time << " us" << std::endl;
     ss << "Message min latency           : " << min_time << " us @ " << min_pos << std::endl;
     ss << "Message max latency           : " << max_time << " us @ " << max_pos << std::endl;
+    std::vector<long long> sorted_arr(lat_arr_);
+    std::sort(sorted_arr.begin(), sorted_arr.end());
+    ss << "Message latency p50/p90/p99   : " << sorted_arr[sorted_arr.size() * 50 / 100] << " / " << sorted_arr[sorted_arr.size() * 90 / 100] << " / " << sorted_arr[sorted_arr.size() * 99 / 100] << " us" << std::endl;
     ss << "Throughput                    : " << static_cast<int>(((rec_size_ * sum_msg) / 1024.0 / 1024.0) / (sum_time / 1000.0 / 1000.0)) << " MB/s" << std::endl;
     ss << "                              : " << static_cast<int>(((rec_size_ * sum_msg) / 1024.0 / 1024.0 / 1024.0) / (sum_time / 1000.0 / 1000.0)) << " GB/s" << std::endl;
     ss << "                              : " << static_cast<int>((sum_msg / 1000.0) / (sum_time / 1000.0 / 1000.0)) << " kMsg/s" << std::endl;
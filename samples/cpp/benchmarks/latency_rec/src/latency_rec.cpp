@@ -56,7 +56,7 @@ void on_receive(const struct eCAL::SReceiveCallbackData* data_, SCallbackPar* pa
 }
 
 // single test run
-void do_run(int delay_, std::string& log_file_)
+void do_run(int delay_, int spin_, std::string& log_file_)
 {
   // initialize eCAL API
   eCAL::Initialize(0, nullptr, "latency_rec");
@@ -64,6 +64,9 @@ void do_run(int delay_, std::string& log_file_)
   // subscriber
   eCAL::CSubscriber sub("ping");
 
+  // busy poll shared memory for lower latency
+  sub.ShmSetSpinBudget(std::chrono::microseconds(spin_));
+
   // apply subscriber callback function
   SCallbackPar cb_par;
   auto callback = std::bind(on_receive, std::placeholders::_2, &cb_par, delay_);
@@ -102,15 +105,17 @@ int main(int argc, char** argv)
     // parse command line
     TCLAP::CmdLine cmd("latency_rec");
     TCLAP::ValueArg<int>         delay(   "d", "delay",    "Callback process delay in ms.",     false,  0, "int");
+    TCLAP::ValueArg<int>         spin(    "s", "spin",     "SHM receive spin budget in us.",    false,  0, "int");
     TCLAP::ValueArg<std::string> log_file("l", "log_file", "Base file name to export results.", false, "", "string");
     cmd.add(delay);
+    cmd.add(spin);
     cmd.add(log_file);
     cmd.parse(argc, argv);
 
     // run tests
     while(eCAL::Ok())
     {
-      do_run(delay.getValue(), log_file.getValue());
+      do_run(delay.getValue(), spin.getValue(), log_file.getValue());
     }
   }
   catch (TCLAP::ArgException& e)  // catch any exceptions
@@ -0,0 +1,146 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+// measures the payload copies of the publisher per send for the active transport layers
+// compare the results with [publisher] use_shm, use_udp_mc and use_tcp switched on and off
+//  - bytes serialized by the payload writer per send
+//  - send time per sample in multiples of a single memcpy of the payload
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  // payload writer copying a prepared buffer and counting the written bytes
+  class CCountingPayloadWriter : public eCAL::CPayloadWriter
+  {
+  public:
+    explicit CCountingPayloadWriter(const std::vector<char>& content_) : m_content(content_) {}
+
+    bool WriteFull(void* buf_, size_t len_) override
+    {
+      if (len_ < m_content.size()) return false;
+      std::memcpy(buf_, m_content.data(), m_content.size());
+      m_written_bytes += m_content.size();
+      return true;
+    }
+
+    size_t GetSize() override { return m_content.size(); }
+
+    size_t WrittenBytes() const { return m_written_bytes; }
+
+  private:
+    const std::vector<char>& m_content;
+    size_t                   m_written_bytes = 0;
+  };
+
+  std::string LayerMode(eCAL::TLayer::eSendMode mode_)
+  {
+    switch (mode_)
+    {
+    case eCAL::TLayer::smode_on:   return "on";
+    case eCAL::TLayer::smode_auto: return "auto";
+    default:                       return "off";
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  size_t payload_size_mb(8);
+  int    send_count(100);
+  if (argc > 1) payload_size_mb = static_cast<size_t>(std::max(1, std::atoi(argv[1])));
+  if (argc > 2) send_count      = std::max(1, std::atoi(argv[2]));
+  const size_t payload_size = payload_size_mb * 1024 * 1024;
+
+  // initialize eCAL API
+  eCAL::Initialize(argc, argv, "payload_copy_snd");
+
+  // the subscriber below lives in this process
+  eCAL::Util::EnableLoopback(true);
+
+  std::cout << "SHM layer          : " << LayerMode(eCAL::Config::GetPublisherShmMode())          << std::endl;
+  std::cout << "UDP layer          : " << LayerMode(eCAL::Config::GetPublisherUdpMulticastMode()) << std::endl;
+  std::cout << "TCP layer          : " << LayerMode(eCAL::Config::GetPublisherTcpMode())          << std::endl;
+  std::cout << "Payload size       : " << payload_size_mb << " MB" << std::endl;
+  std::cout << std::endl;
+
+  // reference, a single copy of the payload
+  const std::vector<char> content(payload_size, 'x');
+  std::vector<char>       copy_target(payload_size);
+  const auto copy_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < send_count; ++i)
+  {
+    std::memcpy(copy_target.data(), content.data(), payload_size);
+  }
+  const auto copy_time = (std::chrono::steady_clock::now() - copy_start) / send_count;
+
+  // publisher and a connected subscriber
+  eCAL::CPublisher pub("payload_copy");
+  std::atomic<int> received(0);
+  eCAL::CSubscriber sub("payload_copy");
+  sub.AddReceiveCallback([&received](const char*, const eCAL::SReceiveCallbackData*) { received++; });
+  const auto connect_start = std::chrono::steady_clock::now();
+  while (!pub.IsSubscribed() && eCAL::Ok() && (std::chrono::steady_clock::now() - connect_start < std::chrono::seconds(10)))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // send (the first sample creates the memory files)
+  CCountingPayloadWriter payload(content);
+  pub.Send(payload);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  const size_t written_bytes_start = payload.WrittenBytes();
+
+  std::chrono::steady_clock::duration send_time(0);
+  for (int i = 0; i < send_count && eCAL::Ok(); ++i)
+  {
+    const auto send_start = std::chrono::steady_clock::now();
+    pub.Send(payload);
+    send_time += std::chrono::steady_clock::now() - send_start;
+
+    // let the subscriber process the sample
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  send_time /= send_count;
+
+  const double copy_us = std::chrono::duration<double, std::micro>(copy_time).count();
+  const double send_us = std::chrono::duration<double, std::micro>(send_time).count();
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "Samples received   : " << received << std::endl;
+  std::cout << "Serialized / send  : " << static_cast<double>(payload.WrittenBytes() - written_bytes_start) / send_count / (1024.0 * 1024.0) << " MB" << std::endl;
+  std::cout << "Single memcpy      : " << copy_us << " us" << std::endl;
+  std::cout << "Send               : " << send_us << " us (" << std::setprecision(2) << send_us / copy_us << " memcpy equivalents)" << std::endl;
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
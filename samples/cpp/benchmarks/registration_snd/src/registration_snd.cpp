@@ -0,0 +1,102 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+// measures the registration costs of a process with many registered topics
+//  - cpu time used by the cyclic registration refresh
+//  - latency of forced topic registrations from a user thread while the refresh is running
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+  int topic_count(10000);
+  int duration_s(10);
+  if (argc > 1) topic_count = std::max(1, std::atoi(argv[1]));
+  if (argc > 2) duration_s  = std::max(1, std::atoi(argv[2]));
+
+  // initialize eCAL API
+  eCAL::Initialize(argc, argv, "registration_snd");
+
+  const std::string ttype("THIS IS THE TOPIC TYPE NAME");
+  const std::string tdesc(256, 'D');
+
+  // create publishers
+  std::cout << "Creating " << topic_count << " publishers .." << std::endl;
+  std::vector<std::unique_ptr<eCAL::CPublisher>> publishers;
+  publishers.reserve(static_cast<size_t>(topic_count));
+  for (int i = 0; i < topic_count; ++i)
+  {
+    std::ostringstream tname;
+    tname << "registration_" << std::setw(5) << std::setfill('0') << i;
+    publishers.emplace_back(new eCAL::CPublisher(tname.str(), eCAL::SDataTypeInformation{ ttype, "", tdesc }));
+  }
+
+  // let the registration refresh settle
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+
+  // force registrations (attribute changes) from this thread while the refresh thread is running
+  std::vector<double> latencies_us;
+  const std::clock_t cpu_start  = std::clock();
+  const auto        wall_start = std::chrono::steady_clock::now();
+  long long         counter(0);
+  while (eCAL::Ok() && (std::chrono::steady_clock::now() - wall_start < std::chrono::seconds(duration_s)))
+  {
+    auto& publisher = publishers[static_cast<size_t>(counter) % publishers.size()];
+    const auto start = std::chrono::steady_clock::now();
+    publisher->SetAttribute("counter", std::to_string(counter++));
+    latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  const std::clock_t cpu_end  = std::clock();
+  const auto        wall_end = std::chrono::steady_clock::now();
+
+  std::sort(latencies_us.begin(), latencies_us.end());
+  const auto percentile = [&latencies_us](double p_) { return latencies_us[static_cast<size_t>(p_ * static_cast<double>(latencies_us.size() - 1))]; };
+
+  // cpu time is process time (std::clock) and includes the registration receiver of this process
+  const double wall_s = std::chrono::duration<double>(wall_end - wall_start).count();
+  const double cpu_ms = 1000.0 * static_cast<double>(cpu_end - cpu_start) / CLOCKS_PER_SEC;
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "Registered topics        : " << topic_count << std::endl;
+  std::cout << "Process cpu time         : " << cpu_ms / wall_s << " ms per second" << std::endl;
+  std::cout << "Forced registration      : " << latencies_us.size() << " calls" << std::endl;
+  std::cout << "  median                 : " << percentile(0.5)  << " us" << std::endl;
+  std::cout << "  99 %                   : " << percentile(0.99) << " us" << std::endl;
+  std::cout << "  max                    : " << latencies_us.back() << " us" << std::endl;
+
+  publishers.clear();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
@@ -0,0 +1,116 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+// measures the process startup costs of many publishers
+// compare the results with [publisher] lazy_layer_creation and parallel_layer_creation switched on and off
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  double MilliSeconds(std::chrono::steady_clock::duration duration_)
+  {
+    return std::chrono::duration<double, std::milli>(duration_).count();
+  }
+
+  std::string TopicName(int index_)
+  {
+    std::ostringstream tname;
+    tname << "startup_" << std::setw(5) << std::setfill('0') << index_;
+    return tname.str();
+  }
+}
+
+int main(int argc, char** argv)
+{
+  int publisher_count(500);
+  if (argc > 1) publisher_count = std::max(1, std::atoi(argv[1]));
+
+  // initialize eCAL API
+  const auto init_start = std::chrono::steady_clock::now();
+  eCAL::Initialize(argc, argv, "startup_snd");
+  const auto init_end = std::chrono::steady_clock::now();
+
+  // the subscriber below lives in this process
+  eCAL::Util::EnableLoopback(true);
+
+  std::cout << "Lazy layer creation     : " << (eCAL::Config::IsLazyLayerCreationEnabled() ? "on" : "off") << std::endl;
+  std::cout << "Parallel layer creation : " << (eCAL::Config::IsParallelLayerCreationEnabled() ? "on" : "off") << std::endl;
+  std::cout << "Publisher count         : " << publisher_count << std::endl;
+  std::cout << std::endl;
+
+  // create publishers
+  const auto create_start = std::chrono::steady_clock::now();
+  std::vector<std::unique_ptr<eCAL::CPublisher>> publishers;
+  publishers.reserve(static_cast<size_t>(publisher_count));
+  for (int i = 0; i < publisher_count; ++i)
+  {
+    publishers.emplace_back(new eCAL::CPublisher(TopicName(i)));
+  }
+  const auto create_end = std::chrono::steady_clock::now();
+
+  // time from the first subscription to the first received sample
+  // (includes the deferred layer creation in lazy mode)
+  std::atomic<bool> received(false);
+  eCAL::CSubscriber subscriber(TopicName(0));
+  subscriber.AddReceiveCallback([&received](const char*, const eCAL::SReceiveCallbackData*) { received = true; });
+
+  const auto connect_start = std::chrono::steady_clock::now();
+  while (!received && eCAL::Ok() && (std::chrono::steady_clock::now() - connect_start < std::chrono::seconds(10)))
+  {
+    publishers[0]->Send("startup");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  const auto connect_end = std::chrono::steady_clock::now();
+
+  // destroy publishers
+  const auto destroy_start = std::chrono::steady_clock::now();
+  publishers.clear();
+  const auto destroy_end = std::chrono::steady_clock::now();
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "eCAL initialize         : " << MilliSeconds(init_end - init_start) << " ms" << std::endl;
+  std::cout << "Publisher creation      : " << MilliSeconds(create_end - create_start) << " ms ("
+            << MilliSeconds(create_end - create_start) * 1000.0 / publisher_count << " us per publisher)" << std::endl;
+  if (received)
+  {
+    std::cout << "First sample received   : " << MilliSeconds(connect_end - connect_start) << " ms" << std::endl;
+  }
+  else
+  {
+    std::cout << "First sample received   : timeout" << std::endl;
+  }
+  std::cout << "Publisher destruction   : " << MilliSeconds(destroy_end - destroy_start) << " ms" << std::endl;
+
+  // finalize eCAL API
+  eCAL::Finalize();
+
+  return(0);
+}
@@ -100,6 +100,20 @@ struct SReceiveCallbackDataC
   long long clock;  //!< source write clock
 };
 
+/**
+ * @brief eCAL subscriber borrowed buffer receive callback struct (C variant).
+ *
+ * The payload buffer is owned by eCAL and only valid for the duration of the callback.
+**/
+struct SReceiveBufferDataC
+{
+  const void* buf;    //!< payload buffer (borrowed, do not free or hold)
+  long long   size;   //!< payload buffer size
+  long long   id;     //!< source id
+  long long   time;   //!< source time stamp
+  long long   clock;  //!< source write clock
+};
+
 /**
  * @brief eCAL publisher event callback struct (C variant).
 **/
@@ -159,6 +173,35 @@ struct SServerEventCallbackDataC
 **/
 typedef void (*ReceiveCallbackCT)(const char* topic_name_, const struct SReceiveCallbackDataC* data_, void* par_);
 
+/**
+ * @brief eCAL borrowed buffer receive callback function
+ *
+ * @param topic_name_  Topic name of the data source (publisher).
+ * @param data_        Data payload struct, the payload buffer is only valid during the call.
+ * @param par_         Forwarded user defined parameter.
+**/
+typedef void (*ReceiveBufferCallbackCT)(const char* topic_name_, const struct SReceiveBufferDataC* data_, void* par_);
+
+/**
+ * @brief eCAL payload writer write function (see eCAL::CPayloadWriter::WriteFull / WriteModified)
+ *
+ * @param buf_      Target memory (shared memory file in zero copy mode) to write the payload into.
+ * @param buf_len_  Target memory size.
+ * @param par_      Forwarded user defined parameter.
+ *
+ * @return  None zero if succeeded.
+**/
+typedef int (*PayloadWriteCallbackCT)(void* buf_, int buf_len_, void* par_);
+
+/**
+ * @brief eCAL payload writer size function (see eCAL::CPayloadWriter::GetSize)
+ *
+ * @param par_  Forwarded user defined parameter.
+ *
+ * @return  Required payload size.
+**/
+typedef int (*PayloadSizeCallbackCT)(void* par_);
+
 /**
  * @brief eCAL timer callback function
  *
@@ -140,6 +140,24 @@ extern "C"
   **/
   ECALC_API int eCAL_Pub_Send(ECAL_HANDLE handle_, const void* const buf_, int buf_len_, long long time_);
 
+  /**
+   * @brief Send a message to all subscribers by letting the caller write the payload directly
+   *        into the transport memory (C variant of eCAL::CPayloadWriter).
+   *
+   * In zero copy mode write_full_ / write_modified_ operate on the shared memory file directly,
+   * so no intermediate user buffer is needed.
+   *
+   * @param handle_          Publisher handle. 
+   * @param write_full_      Function writing the complete payload into uninitialized memory.
+   * @param write_modified_  Function updating a previously written payload (NULL = use write_full_).
+   * @param get_size_        Function returning the required payload size.
+   * @param par_             User defined context that will be forwarded to the writer functions.
+   * @param time_            Send time (-1 = use eCAL system time in us, default = -1).
+   *
+   * @return  Number of bytes sent. 
+  **/
+  ECALC_API int eCAL_Pub_SendPayloadWriter(ECAL_HANDLE handle_, PayloadWriteCallbackCT write_full_, PayloadWriteCallbackCT write_modified_, PayloadSizeCallbackCT get_size_, void* par_, long long time_);
+
   /**
    * @brief Add callback function for publisher events.
    *
@@ -169,6 +169,22 @@ extern "C"
   **/
   ECALC_API int eCAL_Sub_AddReceiveCallback(ECAL_HANDLE handle_, ReceiveCallbackCT callback_, void* par_);
 
+  /**
+   * @brief Add borrowed buffer callback function for incoming receives. 
+   *
+   * The payload buffer handed to the callback points directly into the eCAL receive buffer
+   * (the shared memory file in zero copy mode). It must not be freed and is only valid until the
+   * callback returns. In contrast to eCAL_Sub_AddReceiveCallback the callback is not serialized
+   * with the callbacks of other subscribers.
+   *
+   * @param handle_    Subscriber handle. 
+   * @param callback_  The callback function to add.
+   * @param par_       User defined context that will be forwarded to the callback function.  
+   *
+   * @return  None zero if succeeded.
+  **/
+  ECALC_API int eCAL_Sub_AddReceiveBufferCallback(ECAL_HANDLE handle_, ReceiveBufferCallbackCT callback_, void* par_);
+
   /**
    * @brief Remove callback function for incoming receives. 
    *
@@ -29,6 +29,7 @@
 #include <ecal/ecal_types.h>
 
 #include <functional>
+#include <memory>
 #include <string>
 
 namespace eCAL
@@ -143,6 +144,17 @@ namespace eCAL
   **/
   using ReceiveCallbackT = std::function<void (const char *, const struct SReceiveCallbackData *)>;
 
+  /**
+   * @brief Held sample receive callback function type.
+   *
+   * The sample handle keeps the payload valid after the callback returned, as long as a copy of the
+   * handle exists. Shared memory samples are not copied, the memory file is released by the last handle.
+   *
+   * @param topic_name_  The topic name of the received message.
+   * @param sample_      Handle of the received sample (payload, timestamp and publication clock).
+  **/
+  using ReceiveSampleCallbackT = std::function<void (const char *, const std::shared_ptr<const SReceiveCallbackData>&)>;
+
   /**
    * @brief Timer callback function type.
   **/
@@ -43,6 +43,7 @@ namespace eCAL
     ECAL_API std::string       GetLoadedEcalIniPath                 ();
     ECAL_API int               GetRegistrationTimeoutMs             ();
     ECAL_API int               GetRegistrationRefreshMs             ();
+    ECAL_API bool              IsRegistrationUdpSampleListEnabled   ();
 
     /////////////////////////////////////
     // network
@@ -113,6 +114,19 @@ namespace eCAL
     ECAL_API int               GetMemfileAckTimeoutMs               ();
     ECAL_API bool              IsMemfileZerocopyEnabled             ();
     ECAL_API size_t            GetMemfileBufferCount                ();
+    ECAL_API bool              IsMemfileBroadcastNotifyEnabled      ();
+    ECAL_API bool              IsMemfileSubscriberFilterEnabled     ();
+    ECAL_API bool              IsMemfilePopulateEnabled             ();
+    ECAL_API bool              IsMemfileLockEnabled                 ();
+    ECAL_API int               GetMemfileHugePagesMode              ();
+    ECAL_API std::string       GetMemfileHugetlbfsPath              ();
+    ECAL_API int               GetMemfileNumaNode                   ();
+
+    ECAL_API bool              IsLazyLayerCreationEnabled           ();
+    ECAL_API bool              IsParallelLayerCreationEnabled       ();
+    ECAL_API bool              IsAsyncNetSendEnabled                ();
+    ECAL_API size_t            GetAsyncNetQueueSize                 ();
+    ECAL_API bool              IsAsyncNetBlockOnOverflowEnabled     ();
 
     ECAL_API bool              IsTopicTypeSharingEnabled            ();
     ECAL_API bool              IsTopicDescriptionSharingEnabled     ();
@@ -27,6 +27,10 @@
 #include <ecal/ecal_os.h>
 #include <ecal/types/monitoring.h>
 
+#include <cstdint>
+#include <memory>
+#include <string>
+
 namespace eCAL
 {
   namespace Monitoring
@@ -77,6 +81,31 @@ namespace eCAL
      * @return Number of struct elements if succeeded.
     **/
     ECAL_API int GetMonitoring(SMonitoring& mon_, unsigned int entities_ = Entity::All);
+
+    /**
+     * @brief Get an immutable snapshot of the monitoring registry.
+     *
+     * The snapshot is shared between all callers and only rebuilt if the registry changed since the last call.
+     * Unchanged entities are shared by reference between consecutive snapshots.
+     *
+     * @return Snapshot of the monitoring registry (nullptr if monitoring is not initialized).
+    **/
+    ECAL_API std::shared_ptr<const SMonitoringSnapshot> GetMonitoringSnapshot();
+
+    /**
+     * @brief Get all entities that changed since a given registry version.
+     *
+     * Removals have to be applied before changes, an entity may be removed and registered again within one delta.
+     * If the requested version is no longer covered by the removal history, delta_.full is set and
+     * delta_.changed contains the complete registry.
+     *
+     * @param       since_version_  Registry version of the last known state (0 to get the complete registry).
+     * @param [out] delta_          Target struct to store the changed and removed entities.
+     * @param       entities_       Entities definition.
+     *
+     * @return Number of changed and removed entities.
+    **/
+    ECAL_API int GetMonitoringDelta(uint64_t since_version_, SMonitoringDelta& delta_, unsigned int entities_ = Entity::All);
   }
   /** @example monitoring_rec.cpp
   * This is an example how the eCAL Monitoring API may be utilized to print monitoring information.
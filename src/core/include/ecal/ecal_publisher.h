@@ -28,15 +28,30 @@
 #include <ecal/ecal_deprecate.h>
 #include <ecal/ecal_callback.h>
 #include <ecal/ecal_payload_writer.h>
+#include <ecal/ecal_tlayer.h>
 #include <ecal/ecal_types.h>
+#include <ecal/types/monitoring.h>
 
 #include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
   class CDataWriter;
+  class CPublisher;
+  class CPublisherLoan;
+  struct SWriterLoan;
+
+  /**
+   * @brief Publisher / payload pair for sending multiple topics in one pass (see CPublisher::SendBatch).
+  **/
+  struct SPublisherPayload
+  {
+    const CPublisher* publisher;  //!< publisher to send with
+    CPayloadWriter*   payload;    //!< payload to send
+  };
 
   /**
    * @brief eCAL publisher class.
@@ -198,6 +213,18 @@ namespace eCAL
     **/
     ECAL_API bool SetID(long long id_);
 
+    /**
+     * @brief Set the payload compression of the network layers (udp multicast, tcp).
+     *
+     * The codec is announced in the registration, payloads are sent compressed as long as all
+     * subscribers support it and the payload gets smaller. Shared memory stays uncompressed.
+     *
+     * @param compression_  The compression codec (default TLayer::compression_none).
+     *
+     * @return  True if it succeeds, false if it fails.
+    **/
+    ECAL_API bool SetCompression(TLayer::eCompression compression_);
+
     /**
      * @brief Send a message to all subscribers. 
      *
@@ -229,6 +256,41 @@ namespace eCAL
     **/
     ECAL_API size_t Send(const std::string& s_, long long time_ = DEFAULT_TIME_ARGUMENT) const;
 
+    /**
+     * @brief Send a frame of messages of multiple publishers in one pass.
+     *
+     * All messages get the same send time. The local (shared memory) subscribers are signaled
+     * after all payloads of the frame are written, so a subscriber woken up by one topic of
+     * the frame will find the other topics of the frame already published.
+     * With a shared memory acknowledge timeout the subscribers of all topics are signaled
+     * before the first acknowledge is awaited, so the frame waits for the slowest subscriber
+     * only once instead of once per topic.
+     * A publisher occurring more than once in a batch sends its messages one after another
+     * like consecutive Send calls, each message is signaled before the next one is written.
+     *
+     * @param batch_  Publisher / payload pairs to send.
+     * @param time_   Send time of the frame (-1 = use eCAL system time in us, default = -1).
+     *
+     * @return  Sum of bytes sent.
+    **/
+    ECAL_API static size_t SendBatch(const std::vector<SPublisherPayload>& batch_, long long time_ = DEFAULT_TIME_ARGUMENT);
+
+    /**
+     * @brief Loan a writable payload buffer to produce the next message in place.
+     *
+     * If the shared memory layer is active, the buffer is part of the next free memory file, so the
+     * payload is written by the caller without any copy and without holding a lock. Several loans can be
+     * in flight, up to the number of memory files (see publisher setting memfile_buffer_count).
+     * Otherwise the buffer is allocated on the heap and copied on commit. While all memory files are
+     * loaned, Send can not use the shared memory layer.
+     * Loan, Commit, Discard and Send must not be called concurrently for the same publisher.
+     *
+     * @param len_  Size of the payload in bytes.
+     *
+     * @return  The loan, published with CPublisherLoan::Commit (invalid if the publisher is not created).
+    **/
+    ECAL_API CPublisherLoan Loan(size_t len_) const;
+
     /**
      * @brief Add callback function for publisher events.
      *
@@ -283,6 +345,13 @@ namespace eCAL
     **/
     ECAL_API SDataTypeInformation GetDataTypeInformation() const;
 
+    /**
+     * @brief Query the latency statistics of the publisher (shared memory write access wait time, all values in nanoseconds).
+     *
+     * @return  The latency histogram summaries measured since the publisher was created.
+    **/
+    ECAL_API Monitoring::STopicLatencyMon GetLatency() const;
+
     /**
      * @brief Dump the whole class state into a string. 
      *
@@ -299,4 +368,65 @@ namespace eCAL
     bool                             m_created;
     bool                             m_initialized;
   };
+
+  /**
+   * @brief Writable payload buffer loaned from a publisher (see CPublisher::Loan).
+   *
+   * The buffer is valid until the loan is committed or discarded (a pending loan is discarded
+   * on destruction) and as long as the publisher exists.
+  **/
+  class CPublisherLoan
+  {
+  public:
+    ECAL_API CPublisherLoan();
+    ECAL_API ~CPublisherLoan();
+
+    ECAL_API CPublisherLoan(const CPublisherLoan&) = delete;
+    ECAL_API CPublisherLoan& operator=(const CPublisherLoan&) = delete;
+
+    ECAL_API CPublisherLoan(CPublisherLoan&& rhs) noexcept;
+    ECAL_API CPublisherLoan& operator=(CPublisherLoan&& rhs) noexcept;
+
+    /**
+     * @brief Check if the loan is pending.
+     *
+     * @return  True if the buffer can be written and committed.
+    **/
+    ECAL_API bool IsValid() const;
+
+    /**
+     * @brief Get the writable payload buffer.
+     *
+     * @return  The buffer address (nullptr if the loan is not valid).
+    **/
+    ECAL_API void* Data() const;
+
+    /**
+     * @brief Get the size of the payload buffer.
+     *
+     * @return  The buffer size in bytes.
+    **/
+    ECAL_API size_t Size() const;
+
+    /**
+     * @brief Publish the loaned payload to all subscribers and release the loan.
+     *
+     * @param time_   Send time (-1 = use eCAL system time in us, default = -1).
+     *
+     * @return  Number of bytes sent.
+    **/
+    ECAL_API size_t Commit(long long time_ = CPublisher::DEFAULT_TIME_ARGUMENT);
+
+    /**
+     * @brief Release the loan without publishing it.
+    **/
+    ECAL_API void Discard();
+
+  protected:
+    friend class CPublisher;
+
+    std::shared_ptr<CDataWriter>     m_datawriter;
+    std::unique_ptr<SWriterLoan>     m_loan;
+    long long                        m_id;
+  };
 }
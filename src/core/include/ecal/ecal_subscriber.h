@@ -28,7 +28,9 @@
 #include <ecal/ecal_deprecate.h>
 #include <ecal/ecal_callback.h>
 #include <ecal/ecal_types.h>
+#include <ecal/types/monitoring.h>
 
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -37,6 +39,21 @@ namespace eCAL
 {
   class CDataReader;
 
+  /**
+   * @brief Latest received sample (see CSubscriber::ReadLatest).
+  **/
+  struct SLatestSample
+  {
+    const void* buf      = nullptr;  //!< payload buffer, valid until the next ReadLatest call
+    size_t      size     = 0;        //!< payload buffer size
+    long long   id       = 0;        //!< publisher id
+    long long   time     = 0;        //!< publisher send time in µs
+    long long   clock    = 0;        //!< publisher send clock
+    long long   sequence = 0;        //!< receive counter of the subscriber (increments with every received sample)
+    long long   age      = 0;        //!< time since the sample was received in µs
+    bool        is_new   = false;    //!< sample was not returned by ReadLatest before
+  };
+
   /**
    * @brief eCAL subscriber class.
    *
@@ -157,12 +174,67 @@ namespace eCAL
     /**
      * @brief Set a set of id's to prefiltering topics (see CPublisher::SetID).
      *
+     * The id's are advertised to the publishers, they do not send samples over the network
+     * (and do not write them to shared memory) if no subscriber accepts them.
+     *
      * @param id_set_  Set of id's.
      *
      * @return  True if it succeeds, false if it fails.
     **/
     ECAL_API bool SetID(const std::set<long long>& id_set_);
 
+    /**
+     * @brief Limit the receive frequency (downsampling by the publishers).
+     *
+     * Samples following the last accepted sample of a publisher within 1 / frequency_
+     * (publisher time stamps) are skipped. Like the id filter, the frequency is advertised
+     * to the publishers and applied to the received samples.
+     *
+     * @param frequency_  Maximum receive frequency per publisher in Hz (0 = unlimited, default).
+     *
+     * @return  True if it succeeds, false if it fails.
+    **/
+    ECAL_API bool SetMaxFrequency(double frequency_);
+
+    /**
+     * @brief Set the shared memory receive spin budget (busy polling).
+     *
+     * After each received sample the receive thread polls the memory file for the next
+     * sample for the given time before it falls back to blocking on the update event.
+     * This trades CPU load for lower latency. The receive thread of a memory file is shared
+     * by all subscribers of the process, the largest requested budget is used.
+     * The budget is applied with the next registration of the matching publishers
+     * and dropped when the subscriber is destroyed.
+     *
+     * @param spin_budget_  Busy poll time after a received sample (0 = always block, default).
+     *
+     * @return  True if it succeeds, false if it fails.
+    **/
+    ECAL_API bool ShmSetSpinBudget(std::chrono::microseconds spin_budget_);
+
+    /**
+     * @brief Keep only the latest received sample for polling with ReadLatest.
+     *
+     * The receive thread stores every sample into a wait free triple buffer with preallocated
+     * storage instead of the ReceiveBuffer queue, so polling never contends with the transport.
+     * Receive callbacks are called as usual.
+     *
+     * @param state_         Switch latest value mode on / off.
+     * @param reserve_size_  Payload size to preallocate (larger samples grow the storage once).
+     *
+     * @return  True if it succeeds, false if it fails.
+    **/
+    ECAL_API bool SetLatestValueMode(bool state_, size_t reserve_size_ = 0);
+
+    /**
+     * @brief Read the latest received sample (latest value mode, wait free, one polling thread only).
+     *
+     * @param [out] sample_  The latest sample, its payload stays valid until the next call.
+     *
+     * @return  True if a sample was received so far, false otherwise.
+    **/
+    ECAL_API bool ReadLatest(SLatestSample& sample_) const;
+
     /**
      * @brief Sets subscriber attribute. 
      *
@@ -210,6 +282,30 @@ namespace eCAL
     **/
     ECAL_API bool RemReceiveCallback();
 
+    /**
+     * @brief Add callback function for incoming receives, getting a handle to the received sample.
+     *
+     * Shared memory samples are passed without copying. The subscriber holds the memory file
+     * of the sample only until the receive thread handed it over, the publisher writes into its
+     * other memory files meanwhile (or renews a held memory file if all of them are held),
+     * so use more than one memory file (publisher setting memfile_buffer_count) if handles are kept for long.
+     * The memory file is released with the last copy of the handle, release all handles before eCAL::Finalize.
+     * Samples of other layers are copied into the handle.
+     * Like the spin budget this is applied with the next registration of the matching publishers.
+     *
+     * @param callback_  The callback function to add.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API bool AddReceiveSampleCallback(ReceiveSampleCallbackT callback_);
+
+    /**
+     * @brief Remove held sample callback function for incoming receives.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API bool RemReceiveSampleCallback();
+
     /**
      * @brief Add callback function for subscriber events.
      *
@@ -257,6 +353,13 @@ namespace eCAL
     **/
     ECAL_API SDataTypeInformation GetDataTypeInformation() const;
 
+    /**
+     * @brief Query the latency statistics of the subscriber (delivery latency (sample time stamp to receive time) and receive callback duration, all values in nanoseconds).
+     *
+     * @return  The latency histogram summaries measured since the subscriber was created.
+    **/
+    ECAL_API Monitoring::STopicLatencyMon GetLatency() const;
+
     /**
      * @brief Dump the whole class state into a string. 
      *
@@ -53,6 +53,15 @@ namespace eCAL
       smode_auto
     };
 
+    /**
+     * @brief eCAL network layer (udp multicast, tcp) payload compression.
+    **/
+    enum eCompression
+    {
+      compression_none = 0,
+      compression_lz   = 1
+    };
+
     /**
      * @brief eCAL transport layer state struct.
     **/
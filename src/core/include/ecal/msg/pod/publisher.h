@@ -0,0 +1,151 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @file   publisher.h
+ * @brief  eCAL publisher interface for trivially copyable (POD) message types
+**/
+
+#pragma once
+
+#include <ecal/ecal_payload_writer.h>
+#include <ecal/ecal_publisher.h>
+#include <ecal/msg/pod/type_info.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace eCAL
+{
+  namespace pod
+  {
+    /**
+     * @brief  eCAL publisher class for trivially copyable (POD) message types.
+     *
+     * The message is copied into the publisher payload (the memory file for the shm layer)
+     * without any serialization, subscribers get a view of the received payload (see eCAL::pod::CSubscriber).
+     * The type name, size and layout hash are registered as topic information, struct types
+     * need a TypeLayout specialization describing their fields (see eCAL::pod::TypeLayout).
+     * For details see documentation of CPublisher class.
+     *
+    **/
+    template <typename T>
+    class CPublisher : public eCAL::CPublisher
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "eCAL::pod::CPublisher needs a trivially copyable message type.");
+
+      class CPayload : public eCAL::CPayloadWriter
+      {
+      public:
+        explicit CPayload(const T& message_) :
+          message(message_) {};
+
+        ~CPayload() override = default;
+
+        CPayload(const CPayload&) = default;
+        CPayload(CPayload&&) noexcept = default;
+
+        CPayload& operator=(const CPayload&) = delete;
+        CPayload& operator=(CPayload&&) noexcept = delete;
+
+        bool WriteFull(void* buf_, size_t len_) override
+        {
+          if (len_ < sizeof(T)) return false;
+          std::memcpy(buf_, &message, sizeof(T));
+          return true;
+        }
+
+        size_t GetSize() override { return sizeof(T); };
+
+      private:
+        const T& message;
+      };
+
+    public:
+      /**
+       * @brief  Constructor.
+      **/
+      CPublisher() : eCAL::CPublisher()
+      {
+      }
+
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_  Unique topic name.
+      **/
+      explicit CPublisher(const std::string& topic_name_) : eCAL::CPublisher(topic_name_, eCAL::pod::GetDataTypeInformation<T>())
+      {
+      }
+
+      /**
+       * @brief  Copy Constructor is not available.
+      **/
+      CPublisher(const CPublisher&) = delete;
+
+      /**
+       * @brief  Move Constructor
+      **/
+      CPublisher(CPublisher&&) = default;
+
+      /**
+       * @brief  Destructor.
+      **/
+      ~CPublisher() override = default;
+
+      /**
+       * @brief  Copy assignment is not available.
+      **/
+      CPublisher& operator=(const CPublisher&) = delete;
+
+      /**
+       * @brief  Move assignment
+      **/
+      CPublisher& operator=(CPublisher&&) = default;
+
+      /**
+       * @brief  Creates this object.
+       *
+       * @param topic_name_  Unique topic name.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool Create(const std::string& topic_name_)
+      {
+        return(eCAL::CPublisher::Create(topic_name_, eCAL::pod::GetDataTypeInformation<T>()));
+      }
+
+      /**
+       * @brief Send a message to all subscribers.
+       *
+       * @param msg_   The message object.
+       * @param time_  Time stamp.
+       *
+       * @return  Number of bytes sent.
+      **/
+      size_t Send(const T& msg_, long long time_ = DEFAULT_TIME_ARGUMENT)
+      {
+        CPayload payload{ msg_ };
+        return(eCAL::CPublisher::Send(payload, time_));
+      }
+    };
+  }
+}
@@ -0,0 +1,245 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @file   subscriber.h
+ * @brief  eCAL subscriber interface for trivially copyable (POD) message types
+**/
+
+#pragma once
+
+#include <ecal/ecal_subscriber.h>
+#include <ecal/msg/pod/type_info.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+namespace eCAL
+{
+  namespace pod
+  {
+    /**
+     * @brief  eCAL subscriber class for trivially copyable (POD) message types.
+     *
+     * Received messages are not deserialized, the receive callback gets a view of the received
+     * payload (the memory file content for the shm layer in zero copy mode, see memfile_zero_copy).
+     * The payload is copied only if it is not aligned for T.
+     * Samples with a size different from sizeof(T) are dropped, use IsCompatible on the topic
+     * information of connecting publishers (sub_event_connected) to check the layout hash.
+     * For details see documentation of CSubscriber class.
+     *
+    **/
+    template <typename T>
+    class CSubscriber : public eCAL::CSubscriber
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "eCAL::pod::CSubscriber needs a trivially copyable message type.");
+
+    public:
+      /**
+       * @brief  Constructor.
+      **/
+      CSubscriber() : eCAL::CSubscriber()
+      {
+      }
+
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_  Unique topic name.
+      **/
+      explicit CSubscriber(const std::string& topic_name_) : eCAL::CSubscriber(topic_name_, eCAL::pod::GetDataTypeInformation<T>())
+      {
+      }
+
+      /**
+       * @brief  Destructor
+      **/
+      ~CSubscriber() override
+      {
+        this->Destroy();
+      }
+
+      /**
+       * @brief  Copy Constructor is not available.
+      **/
+      CSubscriber(const CSubscriber&) = delete;
+
+      /**
+       * @brief  Copy Assignment is not available.
+      **/
+      CSubscriber& operator=(const CSubscriber&) = delete;
+
+      /**
+       * @brief  Move Constructor
+      **/
+      CSubscriber(CSubscriber&& rhs)
+        : eCAL::CSubscriber(std::move(rhs))
+        , m_cb_callback(std::move(rhs.m_cb_callback))
+      {
+        // the callback bound to the CSubscriber belongs to rhs, bind to this callback instead
+        if (m_cb_callback != nullptr)
+        {
+          eCAL::CSubscriber::RemReceiveCallback();
+          eCAL::CSubscriber::AddReceiveCallback(std::bind(&CSubscriber::ReceiveCallback, this, std::placeholders::_1, std::placeholders::_2));
+        }
+      }
+
+      /**
+       * @brief  Move assignment
+      **/
+      CSubscriber& operator=(CSubscriber&& rhs)
+      {
+        eCAL::CSubscriber::operator=(std::move(rhs));
+
+        m_cb_callback = std::move(rhs.m_cb_callback);
+
+        // the callback bound to the CSubscriber belongs to rhs, bind to this callback instead
+        if (m_cb_callback != nullptr)
+        {
+          eCAL::CSubscriber::RemReceiveCallback();
+          eCAL::CSubscriber::AddReceiveCallback(std::bind(&CSubscriber::ReceiveCallback, this, std::placeholders::_1, std::placeholders::_2));
+        }
+
+        return *this;
+      }
+
+      /**
+       * @brief  Creates this object.
+       *
+       * @param topic_name_  Unique topic name.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool Create(const std::string& topic_name_)
+      {
+        return(eCAL::CSubscriber::Create(topic_name_, eCAL::pod::GetDataTypeInformation<T>()));
+      }
+
+      /**
+       * @brief  Destroys this object.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool Destroy()
+      {
+        RemReceiveCallback();
+        return(eCAL::CSubscriber::Destroy());
+      }
+
+      /**
+       * @brief  Receive a message (copy).
+       *
+       * @param [out] msg_    The message object.
+       * @param [out] time_   Optional receive time stamp.
+       * @param rcv_timeout_  Receive timeout in ms.
+       *
+       * @return  True if a message with the size of T could be received, false otherwise.
+      **/
+      bool Receive(T& msg_, long long* time_ = nullptr, int rcv_timeout_ = 0) const
+      {
+        assert(IsCreated());
+        std::string rec_buf;
+        if (!eCAL::CSubscriber::ReceiveBuffer(rec_buf, time_, rcv_timeout_)) return(false);
+        if (rec_buf.size() != sizeof(T)) return(false);
+        std::memcpy(&msg_, rec_buf.data(), sizeof(T));
+        return(true);
+      }
+
+      /**
+       * @brief eCAL message receive callback function
+       *
+       * @param topic_name_  Topic name of the data source (publisher).
+       * @param msg_         Message view, valid during the callback only.
+       * @param time_        Message time stamp.
+       * @param clock_       Message writer clock.
+       * @param id_          Message id.
+      **/
+      using MsgReceiveCallbackT = std::function<void(const char* topic_name_, const T& msg_, long long time_, long long clock_, long long id_)>;
+
+      /**
+       * @brief  Add receive callback for incoming messages.
+       *
+       * @param callback_  The callback function.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool AddReceiveCallback(MsgReceiveCallbackT callback_)
+      {
+        assert(IsCreated());
+        RemReceiveCallback();
+
+        {
+          const std::lock_guard<std::mutex> callback_lock(m_cb_callback_mutex);
+          m_cb_callback = std::move(callback_);
+        }
+        return(eCAL::CSubscriber::AddReceiveCallback(std::bind(&CSubscriber::ReceiveCallback, this, std::placeholders::_1, std::placeholders::_2)));
+      }
+
+      /**
+       * @brief  Remove receive callback for incoming messages.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool RemReceiveCallback()
+      {
+        const bool ret = eCAL::CSubscriber::RemReceiveCallback();
+
+        const std::lock_guard<std::mutex> callback_lock(m_cb_callback_mutex);
+        if (m_cb_callback == nullptr) return(false);
+        m_cb_callback = nullptr;
+        return(ret);
+      }
+
+    private:
+      void ReceiveCallback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      {
+        MsgReceiveCallbackT fn_callback = nullptr;
+        {
+          const std::lock_guard<std::mutex> callback_lock(m_cb_callback_mutex);
+          fn_callback = m_cb_callback;
+        }
+
+        if (fn_callback == nullptr) return;
+        if (data_->size != static_cast<long>(sizeof(T))) return;
+
+        // view the payload in place if it is aligned for T
+        if (reinterpret_cast<std::uintptr_t>(data_->buf) % alignof(T) == 0)
+        {
+          (fn_callback)(topic_name_, *static_cast<const T*>(data_->buf), data_->time, data_->clock, data_->id);
+        }
+        else
+        {
+          // T does not need to be default constructible, copy into aligned storage
+          typename std::aligned_storage<sizeof(T), alignof(T)>::type msg;
+          std::memcpy(&msg, data_->buf, sizeof(T));
+          (fn_callback)(topic_name_, *reinterpret_cast<const T*>(&msg), data_->time, data_->clock, data_->id);
+        }
+      }
+
+      std::mutex          m_cb_callback_mutex;
+      MsgReceiveCallbackT m_cb_callback;
+    };
+  }
+}
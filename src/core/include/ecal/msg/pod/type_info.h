@@ -0,0 +1,144 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   type_info.h
+ * @brief  eCAL type information for trivially copyable (POD) message types
+**/
+
+#pragma once
+
+#include <ecal/ecal_types.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+namespace eCAL
+{
+  namespace pod
+  {
+    /**
+     * @brief  Type name of a POD message type.
+     *
+     * The default name is the compiler specific type name (typeid), specialize this
+     * template to get stable names across compilers, e.g.
+     *
+     * @code
+     *            template <> struct TypeName<SPose> { static std::string Get() { return "my_robot::SPose"; } };
+     * @endcode
+    **/
+    template <typename T>
+    struct TypeName
+    {
+      static std::string Get() { return typeid(T).name(); }
+    };
+
+    /**
+     * @brief  Field layout of a POD message type, it has to be specialized for every struct type.
+     *
+     * C++ can not enumerate the fields of a struct, so the layout is described by the user
+     * (field types and names in declaration order) and has to be kept in sync with the type, e.g.
+     *
+     * @code
+     *            template <> struct TypeLayout<SPose> { static std::string Get() { return "double x;double y;double yaw;uint32 seq"; } };
+     * @endcode
+     *
+     * Arithmetic and enum types are described by name and size already and need no specialization.
+    **/
+    template <typename T, typename Enable = void>
+    struct TypeLayout
+    {
+      static_assert(sizeof(T) == 0, "eCAL::pod message types need an eCAL::pod::TypeLayout specialization describing their fields.");
+    };
+
+    template <typename T>
+    struct TypeLayout<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type>
+    {
+      static std::string Get() { return std::string(); }
+    };
+
+    /**
+     * @brief  Layout hash of a POD message type (FNV-1a of type name, size, alignment and field layout).
+     *
+     * The hash only detects layout changes reflected in the TypeLayout description (or in the
+     * size and alignment of the type), a field changed without updating the description goes unnoticed.
+     *
+     * @return  The layout hash.
+    **/
+    template <typename T>
+    std::uint64_t GetLayoutHash()
+    {
+      std::uint64_t hash(14695981039346656037ULL);
+      const auto hash_bytes = [&hash](const void* data_, size_t size_)
+      {
+        for (size_t idx = 0; idx < size_; ++idx)
+        {
+          hash ^= static_cast<const unsigned char*>(data_)[idx];
+          hash *= 1099511628211ULL;
+        }
+      };
+
+      const std::string   name   = TypeName<T>::Get();
+      const std::string   layout = TypeLayout<T>::Get();
+      const std::uint64_t size   = sizeof(T);
+      const std::uint64_t align  = alignof(T);
+      hash_bytes(name.data(), name.size());
+      hash_bytes(&size, sizeof(size));
+      hash_bytes(&align, sizeof(align));
+      hash_bytes(layout.data(), layout.size());
+      return hash;
+    }
+
+    /**
+     * @brief  Get the topic information of a POD message type.
+     *
+     * @return  Topic information ("pod", type name, "size=<bytes>;align=<bytes>;layout=<hash>").
+    **/
+    template <typename T>
+    SDataTypeInformation GetDataTypeInformation()
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "POD messages have to be trivially copyable.");
+
+      std::ostringstream descriptor;
+      descriptor << "size=" << sizeof(T) << ";align=" << alignof(T) << ";layout=" << std::hex << GetLayoutHash<T>();
+
+      SDataTypeInformation topic_info;
+      topic_info.encoding   = "pod";
+      topic_info.name       = TypeName<T>::Get();
+      topic_info.descriptor = descriptor.str();
+      return topic_info;
+    }
+
+    /**
+     * @brief  Check if the topic information of a connected publisher matches a POD message type.
+     *
+     * @param topic_info_  Topic information of the publisher (see sub_event_connected).
+     *
+     * @return  True if encoding, type name, size and layout hash match.
+    **/
+    template <typename T>
+    bool IsCompatible(const SDataTypeInformation& topic_info_)
+    {
+      return topic_info_ == GetDataTypeInformation<T>();
+    }
+  }
+}
@@ -25,11 +25,11 @@
 #pragma once
 
 #include <ecal/ecal_deprecate.h>
+#include <ecal/ecal_payload_writer.h>
 #include <ecal/ecal_publisher.h>
 #include <ecal/ecal_util.h>
 
 #include <string>
-#include <vector>
 #include <functional>
 #include <cassert>
 #include <cstring>
@@ -45,6 +45,34 @@ namespace eCAL
   template <typename T>
   class CMsgPublisher : public CPublisher
   {
+    // serializes the message straight into the publisher payload (the memory file for the shm layer)
+    class CPayload : public eCAL::CPayloadWriter
+    {
+    public:
+      CPayload(const CMsgPublisher& publisher_, const T& message_, size_t size_) :
+        publisher(publisher_), message(message_), size(size_) {};
+
+      ~CPayload() override = default;
+
+      CPayload(const CPayload&) = default;
+      CPayload(CPayload&&) noexcept = default;
+
+      CPayload& operator=(const CPayload&) = delete;
+      CPayload& operator=(CPayload&&) noexcept = delete;
+
+      bool WriteFull(void* buf_, size_t len_) override
+      {
+        return publisher.Serialize(message, static_cast<char*>(buf_), len_);
+      }
+
+      size_t GetSize() override { return size; };
+
+    private:
+      const CMsgPublisher& publisher;
+      const T&             message;
+      size_t               size;
+    };
+
   public:
     /**
      * @brief  Default Constructor. 
@@ -141,24 +169,19 @@ namespace eCAL
         return(CPublisher::Send(nullptr, 0, time_));
       }
 
-      // if we have a subscription allocate memory for the
-      // binary stream, serialize the message into the
-      // buffer and finally send it with a binary publisher
-      size_t size = GetSize(msg_);
+      // if we have a subscription the message is serialized
+      // by the payload writer straight into the target buffer
+      const size_t size = GetSize(msg_);
       if (size > 0)
       {
-        m_buffer.resize(size);
-        if (Serialize(msg_, &m_buffer[0], m_buffer.size()))
-        {
-          return(CPublisher::Send(&m_buffer[0], size, time_));
-        }
+        CPayload payload{ *this, msg_, size };
+        return(CPublisher::Send(payload, time_));
       }
       else
       {
         // send a zero payload length message to trigger the subscriber side
         return(CPublisher::Send(nullptr, 0, time_));
       }
-      return(0);
     }
 
   protected:
@@ -167,7 +190,5 @@ namespace eCAL
   private:
     virtual size_t GetSize(const T& msg_) const = 0;
     virtual bool Serialize(const T& msg_, char* buffer_, size_t size_) const = 0;
-
-    std::vector<char> m_buffer;
   };
 }
@@ -26,7 +26,9 @@
 
 #include <ecal/ecal_types.h>
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -66,6 +68,28 @@ namespace eCAL
       eTLayerType  type      = tl_none;                         //<! transport layer type
       int32_t      version   = 0;                               //<! transport layer version
       bool         confirmed = false;                           //<! transport layer used?
+      int32_t      queue_depth     = 0;                         //<! number of samples queued by the background sender (async_net_send)
+      int32_t      queue_max_depth = 0;                         //<! maximum number of samples queued by the background sender
+      int64_t      queue_drops     = 0;                         //<! number of samples dropped on send queue overflow
+    };
+
+    struct SLatencyMon                                          //<! eCAL latency histogram summary (all values in nanoseconds)
+    {
+      int64_t  count = 0;                                       //<! number of measured values
+      int64_t  min   = 0;                                       //<! minimum
+      int64_t  max   = 0;                                       //<! maximum
+      int64_t  mean  = 0;                                       //<! mean
+      int64_t  p50   = 0;                                       //<! median
+      int64_t  p90   = 0;                                       //<! 90 % percentile
+      int64_t  p99   = 0;                                       //<! 99 % percentile
+      int64_t  p999  = 0;                                       //<! 99.9 % percentile
+    };
+
+    struct STopicLatencyMon                                     //<! eCAL topic latencies (measured since topic creation)
+    {
+      SLatencyMon  delivery;                                    //<! sample time stamp to receive time (subscriber)
+      SLatencyMon  callback;                                    //<! receive callback duration (subscriber)
+      SLatencyMon  shm_lock;                                    //<! shared memory write access wait time (publisher)
     };
 
     struct STopicMon                                            //<! eCAL Topic struct
@@ -105,6 +129,8 @@ namespace eCAL
       int64_t                             dclock;               //!< data clock (send / receive action)
       int32_t                             dfreq;                //!< data frequency (send / receive samples per second) [mHz]
 
+      STopicLatencyMon                    latency;              //!< latency statistics
+
       std::map<std::string, std::string>  attr;                 //!< generic topic description
     };
 
@@ -227,5 +253,28 @@ namespace eCAL
       std::vector<SClientMon>   clients;                        //<! clients info vector
     };
 
+    struct SMonitoringEntities                                  //<! eCAL Monitoring entities (shared, immutable)
+    {
+      std::vector<std::shared_ptr<const SProcessMon>>  processes;  //<! process info
+      std::vector<std::shared_ptr<const STopicMon>>    publisher;  //<! publisher info vector
+      std::vector<std::shared_ptr<const STopicMon>>    subscriber; //<! subscriber info vector
+      std::vector<std::shared_ptr<const SServerMon>>   server;     //<! server info vector
+      std::vector<std::shared_ptr<const SClientMon>>   clients;    //<! clients info vector
+    };
+
+    struct SMonitoringSnapshot                                  //<! eCAL Monitoring snapshot
+    {
+      uint64_t             version = 0;                         //<! registry version the snapshot was built from
+      SMonitoringEntities  entities;                            //<! all entities known at that version
+    };
+
+    struct SMonitoringDelta                                     //<! eCAL Monitoring delta between two registry versions
+    {
+      uint64_t             version = 0;                         //<! registry version of this delta (pass it to the next delta query)
+      bool                 full    = false;                     //<! requested version is unknown, 'changed' holds the complete registry
+      SMonitoringEntities  changed;                             //<! entities created or updated since the requested version (a pure registration refresh is no update)
+      SMonitoringEntities  removed;                             //<! entities removed since the requested version (last known state)
+    };
+
   }
 }
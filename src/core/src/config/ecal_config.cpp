@@ -22,8 +22,11 @@
 
 #include "ecal_config_reader.h"
 #include "ecal_config_reader_hlp.h"
+#include "ecal_config_snapshot.h"
 #include "ecal_def.h"
 
+#include <memory>
+
 
 namespace
 {
@@ -85,103 +88,237 @@ namespace eCAL
 {
   namespace Config
   {
+    namespace
+    {
+      UdpConfigVersion ParseUdpConfigVersion(const std::string& udp_config_version_)
+      {
+        if (udp_config_version_ == "v1")
+          return UdpConfigVersion::V1;
+        if (udp_config_version_ == "v2")
+          return UdpConfigVersion::V2;
+        // TODO: Log error. However not sure if logging is initialized at this place.
+        return UdpConfigVersion::V1;
+      }
+
+      SConfigSnapshot BuildDefaultSnapshot()
+      {
+        SConfigSnapshot snapshot;
+        snapshot.udp_multicast_config_version = ParseUdpConfigVersion(NET_UDP_MULTICAST_CONFIG_VERSION);
+        snapshot.console_log_filter           = ParseLogLevel(MON_LOG_FILTER_CON);
+        snapshot.file_log_filter              = ParseLogLevel(MON_LOG_FILTER_FILE);
+        snapshot.udp_log_filter               = ParseLogLevel(MON_LOG_FILTER_UDP);
+        return snapshot;
+      }
+
+      // the published snapshot, only replaced on (de)initialization,
+      // readers share the ownership, so a replaced snapshot lives until its last reader is done
+      std::shared_ptr<const SConfigSnapshot> g_snapshot;
+    }
+
+    void LoadSnapshot()
+    {
+      std::unique_ptr<SConfigSnapshot> snapshot = std::make_unique<SConfigSnapshot>();
+
+      // common
+      snapshot->registration_timeout_ms        = eCALPAR(CMN, REGISTRATION_TO);
+      snapshot->registration_refresh_ms        = eCALPAR(CMN, REGISTRATION_REFRESH);
+      snapshot->registration_udp_sample_list   = (eCALPAR(CMN, REGISTRATION_UDP_SAMPLE_LIST) != 0);
+
+      // network
+      snapshot->network_enabled                = eCALPAR(NET, ENABLED);
+      snapshot->udp_multicast_config_version   = ParseUdpConfigVersion(eCALPAR(NET, UDP_MULTICAST_CONFIG_VERSION));
+      snapshot->udp_multicast_group            = eCALPAR(NET, UDP_MULTICAST_GROUP);
+      snapshot->udp_multicast_mask             = eCALPAR(NET, UDP_MULTICAST_MASK);
+      snapshot->udp_multicast_port             = eCALPAR(NET, UDP_MULTICAST_PORT);
+      snapshot->udp_multicast_ttl              = eCALPAR(NET, UDP_MULTICAST_TTL);
+      snapshot->udp_multicast_sndbuf           = eCALPAR(NET, UDP_MULTICAST_SNDBUF);
+      snapshot->udp_multicast_rcvbuf           = eCALPAR(NET, UDP_MULTICAST_RCVBUF);
+      snapshot->udp_multicast_join_all_if      = eCALPAR(NET, UDP_MULTICAST_JOIN_ALL_IF_ENABLED);
+      snapshot->udp_mc_rec_enabled             = eCALPAR(NET, UDP_MC_REC_ENABLED);
+      snapshot->shm_rec_enabled                = eCALPAR(NET, SHM_REC_ENABLED);
+      snapshot->tcp_rec_enabled                = eCALPAR(NET, TCP_REC_ENABLED);
+      snapshot->npcap_enabled                  = eCALPAR(NET, NPCAP_ENABLED);
+      snapshot->tcp_pubsub_num_executor_reader = eCALPAR(NET, TCP_PUBSUB_NUM_EXECUTOR_READER);
+      snapshot->tcp_pubsub_num_executor_writer = eCALPAR(NET, TCP_PUBSUB_NUM_EXECUTOR_WRITER);
+      snapshot->tcp_pubsub_max_reconnections   = eCALPAR(NET, TCP_PUBSUB_MAX_RECONNECTIONS);
+      snapshot->host_group_name                = eCALPAR(NET, HOST_GROUP_NAME);
+
+      // time
+      snapshot->timesync_module_name           = eCALPAR(TIME, SYNC_MOD_RT);
+
+      // process
+      snapshot->terminal_emulator              = eCALPAR(PROCESS, TERMINAL_EMULATOR);
+
+      // monitoring
+      snapshot->monitoring_timeout_ms          = eCALPAR(MON, TIMEOUT);
+      snapshot->monitoring_filter_excl         = eCALPAR(MON, FILTER_EXCL);
+      snapshot->monitoring_filter_incl         = eCALPAR(MON, FILTER_INCL);
+      snapshot->console_log_filter             = ParseLogLevel(eCALPAR(MON, LOG_FILTER_CON));
+      snapshot->file_log_filter                = ParseLogLevel(eCALPAR(MON, LOG_FILTER_FILE));
+      snapshot->udp_log_filter                 = ParseLogLevel(eCALPAR(MON, LOG_FILTER_UDP));
+
+      // sys
+      snapshot->sys_filter_excl                = eCALPAR(SYS, FILTER_EXCL);
+
+      // publisher
+      snapshot->pub_use_shm                    = TLayer::eSendMode(eCALPAR(PUB, USE_SHM));
+      snapshot->pub_use_tcp                    = TLayer::eSendMode(eCALPAR(PUB, USE_TCP));
+      snapshot->pub_use_udp_mc                 = TLayer::eSendMode(eCALPAR(PUB, USE_UDP_MC));
+      snapshot->memfile_minsize                = static_cast<size_t>(eCALPAR(PUB, MEMFILE_MINSIZE));
+      snapshot->memfile_reserve                = static_cast<size_t>(eCALPAR(PUB, MEMFILE_RESERVE));
+      snapshot->memfile_ack_timeout_ms         = eCALPAR(PUB, MEMFILE_ACK_TO);
+      snapshot->memfile_zero_copy              = (eCALPAR(PUB, MEMFILE_ZERO_COPY) != 0);
+      snapshot->memfile_buffer_count           = static_cast<size_t>(eCALPAR(PUB, MEMFILE_BUF_COUNT));
+      snapshot->memfile_broadcast_notify       = (eCALPAR(PUB, MEMFILE_BROADCAST_NOTIFY) != 0);
+      snapshot->memfile_subscriber_filter      = (eCALPAR(PUB, MEMFILE_SUBSCRIBER_FILTER) != 0);
+      snapshot->memfile_populate               = (eCALPAR(PUB, MEMFILE_POPULATE) != 0);
+      snapshot->memfile_lock                   = (eCALPAR(PUB, MEMFILE_LOCK) != 0);
+      snapshot->memfile_huge_pages             = eCALPAR(PUB, MEMFILE_HUGE_PAGES);
+      snapshot->memfile_hugetlbfs_path         = eCALPAR(PUB, MEMFILE_HUGETLBFS_PATH);
+      snapshot->memfile_numa_node              = eCALPAR(PUB, MEMFILE_NUMA_NODE);
+      snapshot->lazy_layer_creation            = (eCALPAR(PUB, LAZY_LAYER_CREATION) != 0);
+      snapshot->parallel_layer_creation        = (eCALPAR(PUB, PARALLEL_LAYER_CREATION) != 0);
+      snapshot->async_net_send                 = (eCALPAR(PUB, ASYNC_NET_SEND) != 0);
+      snapshot->async_net_queue_size           = static_cast<size_t>(eCALPAR(PUB, ASYNC_NET_QUEUE_SIZE));
+      snapshot->async_net_block_on_overflow    = (eCALPAR(PUB, ASYNC_NET_OVERFLOW_POLICY) != 0);
+      snapshot->share_ttype                    = (eCALPAR(PUB, SHARE_TTYPE) != 0);
+      snapshot->share_tdesc                    = (eCALPAR(PUB, SHARE_TDESC) != 0);
+
+      // service
+      snapshot->service_protocol_v0            = (eCALPAR(SERVICE, PROTOCOL_V0) != 0);
+      snapshot->service_protocol_v1            = (eCALPAR(SERVICE, PROTOCOL_V1) != 0);
+
+      // experimental
+      snapshot->shm_monitoring_enabled         = eCALPAR(EXP, SHM_MONITORING_ENABLED);
+      snapshot->network_monitoring_disabled    = eCALPAR(EXP, NETWORK_MONITORING_DISABLED);
+      snapshot->shm_monitoring_queue_size      = static_cast<size_t>(eCALPAR(EXP, SHM_MONITORING_QUEUE_SIZE));
+      snapshot->shm_monitoring_domain          = eCALPAR(EXP, SHM_MONITORING_DOMAIN);
+      snapshot->drop_out_of_order_messages     = eCALPAR(EXP, DROP_OUT_OF_ORDER_MESSAGES);
+
+      // publish it
+      std::atomic_store(&g_snapshot, std::shared_ptr<const SConfigSnapshot>(std::move(snapshot)));
+    }
+
+    void PublishSnapshot(const SConfigSnapshot& snapshot_)
+    {
+      std::atomic_store(&g_snapshot, std::make_shared<const SConfigSnapshot>(snapshot_));
+    }
+
+    void ResetSnapshot()
+    {
+      std::atomic_store(&g_snapshot, std::shared_ptr<const SConfigSnapshot>());
+    }
+
+    std::shared_ptr<const SConfigSnapshot> GetSnapshot()
+    {
+      std::shared_ptr<const SConfigSnapshot> snapshot = std::atomic_load(&g_snapshot);
+      if (snapshot != nullptr) return snapshot;
+
+      static const std::shared_ptr<const SConfigSnapshot> default_snapshot = std::make_shared<const SConfigSnapshot>(BuildDefaultSnapshot());
+      return default_snapshot;
+    }
+
     /////////////////////////////////////
     // common
     /////////////////////////////////////
     
     ECAL_API std::string       GetLoadedEcalIniPath                 () { return g_default_ini_file; }
-    ECAL_API int               GetRegistrationTimeoutMs             () { return eCALPAR(CMN, REGISTRATION_TO); }
-    ECAL_API int               GetRegistrationRefreshMs             () { return eCALPAR(CMN, REGISTRATION_REFRESH); }
+    ECAL_API int               GetRegistrationTimeoutMs             () { return GetSnapshot()->registration_timeout_ms; }
+    ECAL_API int               GetRegistrationRefreshMs             () { return GetSnapshot()->registration_refresh_ms; }
+    ECAL_API bool              IsRegistrationUdpSampleListEnabled   () { return GetSnapshot()->registration_udp_sample_list; }
 
     /////////////////////////////////////
     // network
     /////////////////////////////////////
 
-    ECAL_API bool              IsNetworkEnabled                     () { return eCALPAR(NET, ENABLED); }
+    ECAL_API bool              IsNetworkEnabled                     () { return GetSnapshot()->network_enabled; }
+    ECAL_API UdpConfigVersion  GetUdpMulticastConfigVersion         () { return GetSnapshot()->udp_multicast_config_version; }
 
-    ECAL_API UdpConfigVersion  GetUdpMulticastConfigVersion()
-    {
-      const std::string udp_config_version_string = eCALPAR(NET, UDP_MULTICAST_CONFIG_VERSION);
-      if (udp_config_version_string == "v1")
-        return UdpConfigVersion::V1;
-      if (udp_config_version_string == "v2")
-        return UdpConfigVersion::V2;
-      // TODO: Log error. However not sure if logging is initialized at this place.
-      return UdpConfigVersion::V1;
-    }
+    ECAL_API std::string       GetUdpMulticastGroup                 () { return GetSnapshot()->udp_multicast_group; }
+    ECAL_API std::string       GetUdpMulticastMask                  () { return GetSnapshot()->udp_multicast_mask; }
+    ECAL_API int               GetUdpMulticastPort                  () { return GetSnapshot()->udp_multicast_port; }
+    ECAL_API int               GetUdpMulticastTtl                   () { return GetSnapshot()->udp_multicast_ttl; }
 
-    ECAL_API std::string       GetUdpMulticastGroup                 () { return eCALPAR(NET, UDP_MULTICAST_GROUP); }
-    ECAL_API std::string       GetUdpMulticastMask                  () { return eCALPAR(NET, UDP_MULTICAST_MASK); }
-    ECAL_API int               GetUdpMulticastPort                  () { return eCALPAR(NET, UDP_MULTICAST_PORT); }
-    ECAL_API int               GetUdpMulticastTtl                   () { return eCALPAR(NET, UDP_MULTICAST_TTL); }
+    ECAL_API int               GetUdpMulticastSndBufSizeBytes       () { return GetSnapshot()->udp_multicast_sndbuf; }
+    ECAL_API int               GetUdpMulticastRcvBufSizeBytes       () { return GetSnapshot()->udp_multicast_rcvbuf; }
+    ECAL_API bool              IsUdpMulticastJoinAllIfEnabled       () { return GetSnapshot()->udp_multicast_join_all_if; }
 
-    ECAL_API int               GetUdpMulticastSndBufSizeBytes       () { return eCALPAR(NET, UDP_MULTICAST_SNDBUF); }
-    ECAL_API int               GetUdpMulticastRcvBufSizeBytes       () { return eCALPAR(NET, UDP_MULTICAST_RCVBUF); }
-    ECAL_API bool              IsUdpMulticastJoinAllIfEnabled       () { return eCALPAR(NET, UDP_MULTICAST_JOIN_ALL_IF_ENABLED); }
+    ECAL_API bool              IsUdpMulticastRecEnabled             () { return GetSnapshot()->udp_mc_rec_enabled; }
+    ECAL_API bool              IsShmRecEnabled                      () { return GetSnapshot()->shm_rec_enabled; }
+    ECAL_API bool              IsTcpRecEnabled                      () { return GetSnapshot()->tcp_rec_enabled; }
 
-    ECAL_API bool              IsUdpMulticastRecEnabled             () { return eCALPAR(NET, UDP_MC_REC_ENABLED); }
-    ECAL_API bool              IsShmRecEnabled                      () { return eCALPAR(NET, SHM_REC_ENABLED); }
-    ECAL_API bool              IsTcpRecEnabled                      () { return eCALPAR(NET, TCP_REC_ENABLED); }
+    ECAL_API bool              IsNpcapEnabled                       () { return GetSnapshot()->npcap_enabled; }
 
-    ECAL_API bool              IsNpcapEnabled                       () { return eCALPAR(NET, NPCAP_ENABLED); }
+    ECAL_API int               GetTcpPubsubReaderThreadpoolSize     () { return GetSnapshot()->tcp_pubsub_num_executor_reader; }
+    ECAL_API int               GetTcpPubsubWriterThreadpoolSize     () { return GetSnapshot()->tcp_pubsub_num_executor_writer; }
+    ECAL_API int               GetTcpPubsubMaxReconnectionAttemps   () { return GetSnapshot()->tcp_pubsub_max_reconnections; }
 
-    ECAL_API int               GetTcpPubsubReaderThreadpoolSize     () { return eCALPAR(NET, TCP_PUBSUB_NUM_EXECUTOR_READER); }
-    ECAL_API int               GetTcpPubsubWriterThreadpoolSize     () { return eCALPAR(NET, TCP_PUBSUB_NUM_EXECUTOR_WRITER); }
-    ECAL_API int               GetTcpPubsubMaxReconnectionAttemps   () { return eCALPAR(NET, TCP_PUBSUB_MAX_RECONNECTIONS); }
-
-    ECAL_API std::string       GetHostGroupName                     () { return eCALPAR(NET, HOST_GROUP_NAME); }
+    ECAL_API std::string       GetHostGroupName                     () { return GetSnapshot()->host_group_name; }
     
     /////////////////////////////////////
     // time
     /////////////////////////////////////
     
-    ECAL_API std::string       GetTimesyncModuleName                () { return eCALPAR(TIME, SYNC_MOD_RT); }
+    ECAL_API std::string       GetTimesyncModuleName                () { return GetSnapshot()->timesync_module_name; }
 
     /////////////////////////////////////
     // process
     /////////////////////////////////////
     
-    ECAL_API std::string       GetTerminalEmulatorCommand           () { return eCALPAR(PROCESS, TERMINAL_EMULATOR); }
+    ECAL_API std::string       GetTerminalEmulatorCommand           () { return GetSnapshot()->terminal_emulator; }
 
     /////////////////////////////////////
     // monitoring
     /////////////////////////////////////
     
-    ECAL_API int                 GetMonitoringTimeoutMs             () { return eCALPAR(MON, TIMEOUT); }
-    ECAL_API std::string         GetMonitoringFilterExcludeList     () { return eCALPAR(MON, FILTER_EXCL); }
-    ECAL_API std::string         GetMonitoringFilterIncludeList     () { return eCALPAR(MON, FILTER_INCL); }
-    ECAL_API eCAL_Logging_Filter GetConsoleLogFilter                () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_CON)); }
-    ECAL_API eCAL_Logging_Filter GetFileLogFilter                   () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_FILE)); }
-    ECAL_API eCAL_Logging_Filter GetUdpLogFilter                    () { return ParseLogLevel(eCALPAR(MON, LOG_FILTER_UDP)); }
+    ECAL_API int                 GetMonitoringTimeoutMs             () { return GetSnapshot()->monitoring_timeout_ms; }
+    ECAL_API std::string         GetMonitoringFilterExcludeList     () { return GetSnapshot()->monitoring_filter_excl; }
+    ECAL_API std::string         GetMonitoringFilterIncludeList     () { return GetSnapshot()->monitoring_filter_incl; }
+    ECAL_API eCAL_Logging_Filter GetConsoleLogFilter                () { return GetSnapshot()->console_log_filter; }
+    ECAL_API eCAL_Logging_Filter GetFileLogFilter                   () { return GetSnapshot()->file_log_filter; }
+    ECAL_API eCAL_Logging_Filter GetUdpLogFilter                    () { return GetSnapshot()->udp_log_filter; }
 
     /////////////////////////////////////
     // sys
     /////////////////////////////////////
     
-    ECAL_API std::string       GetEcalSysFilterExcludeList          () { return eCALPAR(SYS, FILTER_EXCL); }
+    ECAL_API std::string       GetEcalSysFilterExcludeList          () { return GetSnapshot()->sys_filter_excl; }
 
     /////////////////////////////////////
     // publisher
     /////////////////////////////////////
     
-    ECAL_API TLayer::eSendMode GetPublisherUdpMulticastMode         () { return TLayer::eSendMode(eCALPAR(PUB, USE_UDP_MC)); }
-    ECAL_API TLayer::eSendMode GetPublisherShmMode                  () { return TLayer::eSendMode(eCALPAR(PUB, USE_SHM)); }
-    ECAL_API TLayer::eSendMode GetPublisherTcpMode                  () { return TLayer::eSendMode(eCALPAR(PUB, USE_TCP)); }
+    ECAL_API TLayer::eSendMode GetPublisherUdpMulticastMode         () { return GetSnapshot()->pub_use_udp_mc; }
+    ECAL_API TLayer::eSendMode GetPublisherShmMode                  () { return GetSnapshot()->pub_use_shm; }
+    ECAL_API TLayer::eSendMode GetPublisherTcpMode                  () { return GetSnapshot()->pub_use_tcp; }
+
+    ECAL_API size_t            GetMemfileMinsizeBytes               () { return GetSnapshot()->memfile_minsize; }
+    ECAL_API size_t            GetMemfileOverprovisioningPercentage () { return GetSnapshot()->memfile_reserve; }
+    ECAL_API int               GetMemfileAckTimeoutMs               () { return GetSnapshot()->memfile_ack_timeout_ms; }
+    ECAL_API bool              IsMemfileZerocopyEnabled             () { return GetSnapshot()->memfile_zero_copy; }
+    ECAL_API size_t            GetMemfileBufferCount                () { return GetSnapshot()->memfile_buffer_count; }
+    ECAL_API bool              IsMemfileBroadcastNotifyEnabled      () { return GetSnapshot()->memfile_broadcast_notify; }
+    ECAL_API bool              IsMemfileSubscriberFilterEnabled     () { return GetSnapshot()->memfile_subscriber_filter; }
+    ECAL_API bool              IsMemfilePopulateEnabled             () { return GetSnapshot()->memfile_populate; }
+    ECAL_API bool              IsMemfileLockEnabled                 () { return GetSnapshot()->memfile_lock; }
+    ECAL_API int               GetMemfileHugePagesMode              () { return GetSnapshot()->memfile_huge_pages; }
+    ECAL_API std::string       GetMemfileHugetlbfsPath              () { return GetSnapshot()->memfile_hugetlbfs_path; }
+    ECAL_API int               GetMemfileNumaNode                   () { return GetSnapshot()->memfile_numa_node; }
 
-    ECAL_API size_t            GetMemfileMinsizeBytes               () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_MINSIZE)); }
-    ECAL_API size_t            GetMemfileOverprovisioningPercentage () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_RESERVE)); }
-    ECAL_API int               GetMemfileAckTimeoutMs               () { return eCALPAR(PUB, MEMFILE_ACK_TO); }
-    ECAL_API bool              IsMemfileZerocopyEnabled             () { return (eCALPAR(PUB, MEMFILE_ZERO_COPY) != 0); }
-    ECAL_API size_t            GetMemfileBufferCount                () { return static_cast<size_t>(eCALPAR(PUB, MEMFILE_BUF_COUNT)); }
+    ECAL_API bool              IsLazyLayerCreationEnabled           () { return GetSnapshot()->lazy_layer_creation; }
+    ECAL_API bool              IsParallelLayerCreationEnabled       () { return GetSnapshot()->parallel_layer_creation; }
+    ECAL_API bool              IsAsyncNetSendEnabled                () { return GetSnapshot()->async_net_send; }
+    ECAL_API size_t            GetAsyncNetQueueSize                 () { return GetSnapshot()->async_net_queue_size; }
+    ECAL_API bool              IsAsyncNetBlockOnOverflowEnabled     () { return GetSnapshot()->async_net_block_on_overflow; }
 
-    ECAL_API bool              IsTopicTypeSharingEnabled            () { return (eCALPAR(PUB, SHARE_TTYPE) != 0); }
-    ECAL_API bool              IsTopicDescriptionSharingEnabled     () { return (eCALPAR(PUB, SHARE_TDESC) != 0); }
+    ECAL_API bool              IsTopicTypeSharingEnabled            () { return GetSnapshot()->share_ttype; }
+    ECAL_API bool              IsTopicDescriptionSharingEnabled     () { return GetSnapshot()->share_tdesc; }
 
     /////////////////////////////////////
     // service
     /////////////////////////////////////
-    ECAL_API bool              IsServiceProtocolV0Enabled           () { return (eCALPAR(SERVICE, PROTOCOL_V0) != 0); }
-    ECAL_API bool              IsServiceProtocolV1Enabled           () { return (eCALPAR(SERVICE, PROTOCOL_V1) != 0); }
+    ECAL_API bool              IsServiceProtocolV0Enabled           () { return GetSnapshot()->service_protocol_v0; }
+    ECAL_API bool              IsServiceProtocolV1Enabled           () { return GetSnapshot()->service_protocol_v1; }
 
     /////////////////////////////////////
     // experimemtal
@@ -189,11 +326,11 @@ namespace eCAL
 
     namespace Experimental
     {
-      ECAL_API bool              IsShmMonitoringEnabled             () { return eCALPAR(EXP, SHM_MONITORING_ENABLED); }
-      ECAL_API bool              IsNetworkMonitoringDisabled        () { return eCALPAR(EXP, NETWORK_MONITORING_DISABLED); }
-      ECAL_API size_t            GetShmMonitoringQueueSize          () { return static_cast<size_t>(eCALPAR(EXP, SHM_MONITORING_QUEUE_SIZE)); }
-      ECAL_API std::string       GetShmMonitoringDomain             () { return eCALPAR(EXP, SHM_MONITORING_DOMAIN);}
-      ECAL_API bool              GetDropOutOfOrderMessages          () { return eCALPAR(EXP, DROP_OUT_OF_ORDER_MESSAGES); }
+      ECAL_API bool              IsShmMonitoringEnabled             () { return GetSnapshot()->shm_monitoring_enabled; }
+      ECAL_API bool              IsNetworkMonitoringDisabled        () { return GetSnapshot()->network_monitoring_disabled; }
+      ECAL_API size_t            GetShmMonitoringQueueSize          () { return GetSnapshot()->shm_monitoring_queue_size; }
+      ECAL_API std::string       GetShmMonitoringDomain             () { return GetSnapshot()->shm_monitoring_domain; }
+      ECAL_API bool              GetDropOutOfOrderMessages          () { return GetSnapshot()->drop_out_of_order_messages; }
     }
   }
 }
@@ -0,0 +1,142 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Typed, immutable snapshot of the eCAL configuration
+**/
+
+#pragma once
+
+#include <ecal/ecal_config.h>
+
+#include "ecal_def.h"
+
+#include <memory>
+#include <string>
+
+namespace eCAL
+{
+  namespace Config
+  {
+    // All Config::Get.. values, parsed once when the configuration is loaded.
+    // Member defaults are the compiled in ecal_def.h defaults, the default log filter strings
+    // are parsed when the default snapshot is built.
+    struct SConfigSnapshot
+    {
+      // common
+      int                 registration_timeout_ms            = CMN_REGISTRATION_TO;
+      int                 registration_refresh_ms            = CMN_REGISTRATION_REFRESH;
+      bool                registration_udp_sample_list       = (CMN_REGISTRATION_UDP_SAMPLE_LIST != 0);
+
+      // network
+      bool                network_enabled                    = NET_ENABLED;
+      UdpConfigVersion    udp_multicast_config_version       = UdpConfigVersion::V1;
+      std::string         udp_multicast_group                = NET_UDP_MULTICAST_GROUP;
+      std::string         udp_multicast_mask                 = NET_UDP_MULTICAST_MASK;
+      int                 udp_multicast_port                 = NET_UDP_MULTICAST_PORT;
+      int                 udp_multicast_ttl                  = NET_UDP_MULTICAST_TTL;
+      int                 udp_multicast_sndbuf               = NET_UDP_MULTICAST_SNDBUF;
+      int                 udp_multicast_rcvbuf               = NET_UDP_MULTICAST_RCVBUF;
+      bool                udp_multicast_join_all_if          = NET_UDP_MULTICAST_JOIN_ALL_IF_ENABLED;
+      bool                udp_mc_rec_enabled                 = NET_UDP_MC_REC_ENABLED;
+      bool                shm_rec_enabled                    = NET_SHM_REC_ENABLED;
+      bool                tcp_rec_enabled                    = NET_TCP_REC_ENABLED;
+      bool                npcap_enabled                      = NET_NPCAP_ENABLED;
+      int                 tcp_pubsub_num_executor_reader     = NET_TCP_PUBSUB_NUM_EXECUTOR_READER;
+      int                 tcp_pubsub_num_executor_writer     = NET_TCP_PUBSUB_NUM_EXECUTOR_WRITER;
+      int                 tcp_pubsub_max_reconnections       = NET_TCP_PUBSUB_MAX_RECONNECTIONS;
+      std::string         host_group_name                    = NET_HOST_GROUP_NAME;
+
+      // time
+      std::string         timesync_module_name               = TIME_SYNC_MOD_RT;
+
+      // process
+      std::string         terminal_emulator                  = PROCESS_TERMINAL_EMULATOR;
+
+      // monitoring
+      int                 monitoring_timeout_ms              = MON_TIMEOUT;
+      std::string         monitoring_filter_excl             = MON_FILTER_EXCL;
+      std::string         monitoring_filter_incl             = MON_FILTER_INCL;
+      eCAL_Logging_Filter console_log_filter                 = log_level_none;   // parsed from MON_LOG_FILTER_CON
+      eCAL_Logging_Filter file_log_filter                    = log_level_none;   // parsed from MON_LOG_FILTER_FILE
+      eCAL_Logging_Filter udp_log_filter                     = log_level_none;   // parsed from MON_LOG_FILTER_UDP
+
+      // sys
+      std::string         sys_filter_excl                    = SYS_FILTER_EXCL;
+
+      // publisher
+      TLayer::eSendMode   pub_use_shm                        = TLayer::eSendMode(PUB_USE_SHM);
+      TLayer::eSendMode   pub_use_tcp                        = TLayer::eSendMode(PUB_USE_TCP);
+      TLayer::eSendMode   pub_use_udp_mc                     = TLayer::eSendMode(PUB_USE_UDP_MC);
+      size_t              memfile_minsize                    = PUB_MEMFILE_MINSIZE;
+      size_t              memfile_reserve                    = PUB_MEMFILE_RESERVE;
+      int                 memfile_ack_timeout_ms             = PUB_MEMFILE_ACK_TO;
+      bool                memfile_zero_copy                  = (PUB_MEMFILE_ZERO_COPY != 0);
+      size_t              memfile_buffer_count               = PUB_MEMFILE_BUF_COUNT;
+      bool                memfile_broadcast_notify           = (PUB_MEMFILE_BROADCAST_NOTIFY != 0);
+      bool                memfile_subscriber_filter          = (PUB_MEMFILE_SUBSCRIBER_FILTER != 0);
+      bool                memfile_populate                   = (PUB_MEMFILE_POPULATE != 0);
+      bool                memfile_lock                       = (PUB_MEMFILE_LOCK != 0);
+      int                 memfile_huge_pages                 = PUB_MEMFILE_HUGE_PAGES;
+      std::string         memfile_hugetlbfs_path             = PUB_MEMFILE_HUGETLBFS_PATH;
+      int                 memfile_numa_node                  = PUB_MEMFILE_NUMA_NODE;
+      bool                lazy_layer_creation                = (PUB_LAZY_LAYER_CREATION != 0);
+      bool                parallel_layer_creation            = (PUB_PARALLEL_LAYER_CREATION != 0);
+      bool                async_net_send                     = (PUB_ASYNC_NET_SEND != 0);
+      size_t              async_net_queue_size               = PUB_ASYNC_NET_QUEUE_SIZE;
+      bool                async_net_block_on_overflow        = (PUB_ASYNC_NET_OVERFLOW_POLICY != 0);
+      bool                share_ttype                        = (PUB_SHARE_TTYPE != 0);
+      bool                share_tdesc                        = (PUB_SHARE_TDESC != 0);
+
+      // service
+      bool                service_protocol_v0                = (SERVICE_PROTOCOL_V0 != 0);
+      bool                service_protocol_v1                = (SERVICE_PROTOCOL_V1 != 0);
+
+      // experimental
+      bool                shm_monitoring_enabled             = EXP_SHM_MONITORING_ENABLED;
+      bool                network_monitoring_disabled        = EXP_NETWORK_MONITORING_DISABLED;
+      size_t              shm_monitoring_queue_size          = EXP_SHM_MONITORING_QUEUE_SIZE;
+      std::string         shm_monitoring_domain              = EXP_SHM_MONITORING_DOMAIN;
+      bool                drop_out_of_order_messages         = EXP_DROP_OUT_OF_ORDER_MESSAGES;
+    };
+
+    /**
+     * @brief Parse the loaded global configuration into a new snapshot and publish it.
+     *        Has to be called after the configuration is loaded and validated.
+    **/
+    void LoadSnapshot();
+
+    /**
+     * @brief Publish the given snapshot in place of the loaded one (until the next (de)initialization),
+     *        used to run with a modified configuration without an ini file.
+    **/
+    void PublishSnapshot(const SConfigSnapshot& snapshot_);
+
+    /**
+     * @brief Drop the published snapshot, the getters return the default values afterwards.
+    **/
+    void ResetSnapshot();
+
+    /**
+     * @brief Get the currently published snapshot, it stays valid while the returned pointer is held
+     *        (even if the configuration is reloaded or reset in the meantime).
+    **/
+    std::shared_ptr<const SConfigSnapshot> GetSnapshot();
+  }
+}
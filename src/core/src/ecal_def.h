@@ -46,6 +46,8 @@
 #define MON_FILTER_EXCL                            "_.*"
 /* topics whitelist as regular expression (will be monitored only) */
 #define MON_FILTER_INCL                            ""
+/* number of removed entities per entity type kept for monitoring delta queries */
+#define MON_DELTA_HISTORY                          1024
 
 /* logging filter settings */
 #define MON_LOG_FILTER_CON                         "info,warning,error,fatal"
@@ -135,6 +137,45 @@
 */
 #define PUB_MEMFILE_ZERO_COPY                      0
 
+/* wake up all subscribers of a memory file with one shared futex broadcast and collect their acknowledges
+   with one shared counter instead of signaling a named event per subscriber process (linux only)
+   publisher and subscriber processes have to be eCAL 5.13 or newer, older subscribers are not notified
+   [on = 1, off = 0]
+*/
+#define PUB_MEMFILE_BROADCAST_NOTIFY               0
+
+/* skip memory file writes if no local subscriber accepts the sample (subscriber id / frequency filter)
+   [on = 1, off = 0]
+*/
+#define PUB_MEMFILE_SUBSCRIBER_FILTER              1
+
+/* memory file mapping options (linux only)
+   pre-fault the mapped pages on creation          [on = 1, off = 0]
+   lock the mapped pages into RAM (mlock)          [on = 1, off = 0]
+   huge pages                                      [off = 0, transparent huge pages = 1, hugetlbfs = 2]
+   bind the pages of created memory files to a NUMA node (-1 = no binding)
+   hugetlbfs and NUMA binding have to be configured identically for publisher and subscriber processes
+*/
+#define PUB_MEMFILE_POPULATE                       0
+#define PUB_MEMFILE_LOCK                           0
+#define PUB_MEMFILE_HUGE_PAGES                     0
+#define PUB_MEMFILE_HUGETLBFS_PATH                 "/dev/hugepages"
+#define PUB_MEMFILE_NUMA_NODE                      (-1)
+
+/* create the transport layers of a publisher on the first matching subscription
+   instead of on publisher creation                [on = 1, off = 0] */
+#define PUB_LAZY_LAYER_CREATION                    0
+/* create the transport layers of a publisher concurrently [on = 1, off = 0] */
+#define PUB_PARALLEL_LAYER_CREATION                0
+
+/* send the udp multicast and tcp payloads from a background thread per layer,
+   the shm layer is still written by the sending thread [on = 1, off = 0] */
+#define PUB_ASYNC_NET_SEND                         0
+/* maximum number of samples queued per network layer */
+#define PUB_ASYNC_NET_QUEUE_SIZE                   32
+/* policy if a network layer queue is full         [drop oldest sample = 0, block sending thread = 1] */
+#define PUB_ASYNC_NET_OVERFLOW_POLICY              0
+
 /**********************************************************************************************/
 /*                                     service settings                                       */
 /**********************************************************************************************/
@@ -164,6 +205,15 @@
 /* time for resend registration info from publisher/subscriber in ms */
 #define CMN_REGISTRATION_REFRESH                       1000
 
+/* pack udp registration samples into sample lists up to the udp fragment size (0 = one datagram per sample) */
+#define CMN_REGISTRATION_UDP_SAMPLE_LIST               0
+
+/* minimum number of registration samples per additional serialization thread (0 = always serialize on the registration thread) */
+#define CMN_REGISTRATION_SERIALIZE_SAMPLES_PER_WORKER  1024
+
+/* udp sample name of packed registration sample lists */
+#define CMN_REGISTRATION_UDP_SAMPLE_LIST_NAME          "__ecal_registration_sample_list__"
+
 /* delta time to check timeout for data readers in ms */
 #define CMN_DATAREADER_TIMEOUT_RESOLUTION_MS           100
 
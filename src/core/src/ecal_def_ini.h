@@ -29,6 +29,7 @@
 #define  CMN_SECTION_S                             "common"
 #define  CMN_REGISTRATION_TO_S                     "registration_timeout"
 #define  CMN_REGISTRATION_REFRESH_S                "registration_refresh"
+#define  CMN_REGISTRATION_UDP_SAMPLE_LIST_S        "registration_udp_sample_list"
 
 /////////////////////////////////////
 // network
@@ -106,6 +107,20 @@
 #define  PUB_MEMFILE_ACK_TO_S                      "memfile_ack_timeout"
 #define  PUB_MEMFILE_ZERO_COPY_S                   "memfile_zero_copy"
 #define  PUB_MEMFILE_BUF_COUNT_S                   "memfile_buffer_count"
+#define  PUB_MEMFILE_BROADCAST_NOTIFY_S            "memfile_broadcast_notify"
+#define  PUB_MEMFILE_SUBSCRIBER_FILTER_S           "memfile_subscriber_filter"
+#define  PUB_MEMFILE_POPULATE_S                    "memfile_populate"
+#define  PUB_MEMFILE_LOCK_S                        "memfile_lock"
+#define  PUB_MEMFILE_HUGE_PAGES_S                  "memfile_huge_pages"
+#define  PUB_MEMFILE_HUGETLBFS_PATH_S              "memfile_hugetlbfs_path"
+#define  PUB_MEMFILE_NUMA_NODE_S                   "memfile_numa_node"
+
+#define  PUB_LAZY_LAYER_CREATION_S                 "lazy_layer_creation"
+#define  PUB_PARALLEL_LAYER_CREATION_S             "parallel_layer_creation"
+
+#define  PUB_ASYNC_NET_SEND_S                      "async_net_send"
+#define  PUB_ASYNC_NET_QUEUE_SIZE_S                "async_net_queue_size"
+#define  PUB_ASYNC_NET_OVERFLOW_POLICY_S           "async_net_overflow_policy"
 
 #define  PUB_SHARE_TTYPE_S                         "share_ttype"
 #define  PUB_SHARE_TDESC_S                         "share_tdesc"
@@ -28,7 +28,7 @@
 
 #include "ecal_global_accessors.h"
 #include "ecal_def.h"
-#include "util/ecal_expmap.h"
+#include "util/ecal_exphashmap.h"
 
 #include <shared_mutex>
 #include <string>
@@ -99,7 +99,7 @@ namespace eCAL
     };
 
     // key: topic name | value: topic (type/desc), quality
-    using TopicInfoMap = eCAL::Util::CExpMap<std::string, STopicInfoQuality>;      //!< Map containing { TopicName -> (Type, Description, Quality) } mapping of all topics that are currently known
+    using TopicInfoMap = eCAL::Util::CExpHashMap<std::string, STopicInfoQuality>;      //!< Map containing { TopicName -> (Type, Description, Quality) } mapping of all topics that are currently known
     struct STopicInfoMap
     {
       explicit STopicInfoMap(const std::chrono::milliseconds& timeout_) :
@@ -111,8 +111,16 @@ namespace eCAL
     };
     STopicInfoMap m_topic_info_map;
 
+    struct SServiceMethodHash
+    {
+      size_t operator()(const std::tuple<std::string, std::string>& service_method_) const
+      {
+        return Util::HashCombine(std::hash<std::string>()(std::get<0>(service_method_)), std::hash<std::string>()(std::get<1>(service_method_)));
+      }
+    };
+
     // key: tup<service name, method name> | value: request (type/desc), response (type/desc), quality
-    using ServiceMethodInfoMap = eCAL::Util::CExpMap<std::tuple<std::string, std::string>, SServiceMethodInfoQuality>; //!< Map { (ServiceName, MethodName) -> ( (ReqType, ReqDescription), (RespType, RespDescription), Quality ) } mapping of all currently known services
+    using ServiceMethodInfoMap = eCAL::Util::CExpHashMap<std::tuple<std::string, std::string>, SServiceMethodInfoQuality, SServiceMethodHash>; //!< Map { (ServiceName, MethodName) -> ( (ReqType, ReqDescription), (RespType, RespDescription), Quality ) } mapping of all currently known services
     struct SServiceMethodInfoMap
     {
       explicit SServiceMethodInfoMap(const std::chrono::milliseconds& timeout_) :
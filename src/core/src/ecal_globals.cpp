@@ -24,6 +24,7 @@
 #include "ecal_globals.h"
 
 #include "config/ecal_config_reader.h"
+#include "config/ecal_config_snapshot.h"
 
 #include <iostream>
 #include <stdexcept>
@@ -74,6 +75,9 @@ namespace eCAL
         throw std::runtime_error(emsg.c_str());
       }
 
+      // parse the configuration once, Config::Get.. are plain field reads afterwards
+      Config::LoadSnapshot();
+
       new_initialization = true;
     }
 
@@ -360,6 +364,7 @@ namespace eCAL
 #endif
     log_instance                    = nullptr;
     config_instance                 = nullptr;
+    Config::ResetSnapshot();
 
     initialized = false;
 
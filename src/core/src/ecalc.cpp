@@ -350,6 +350,43 @@ static void g_pub_event_callback(const char* topic_name_, const struct eCAL::SPu
   callback_(topic_name_, &data, par_);
 }
 
+namespace
+{
+  // forwards the eCAL payload writer interface to plain C functions
+  class CPayloadWriterC : public eCAL::CPayloadWriter
+  {
+  public:
+    CPayloadWriterC(PayloadWriteCallbackCT write_full_, PayloadWriteCallbackCT write_modified_, PayloadSizeCallbackCT get_size_, void* par_) :
+      m_write_full(write_full_), m_write_modified(write_modified_), m_get_size(get_size_), m_par(par_)
+    {
+    }
+
+    bool WriteFull(void* buffer_, size_t size_) override
+    {
+      return m_write_full(buffer_, static_cast<int>(size_), m_par) != 0;
+    }
+
+    bool WriteModified(void* buffer_, size_t size_) override
+    {
+      if (m_write_modified == nullptr) return WriteFull(buffer_, size_);
+      return m_write_modified(buffer_, static_cast<int>(size_), m_par) != 0;
+    }
+
+    size_t GetSize() override
+    {
+      const int size = m_get_size(m_par);
+      if (size < 0) return 0;
+      return static_cast<size_t>(size);
+    }
+
+  private:
+    PayloadWriteCallbackCT m_write_full;
+    PayloadWriteCallbackCT m_write_modified;
+    PayloadSizeCallbackCT  m_get_size;
+    void*                  m_par;
+  };
+}
+
 extern "C"
 {
   ECALC_API ECAL_HANDLE eCAL_Pub_New()
@@ -435,6 +472,15 @@ extern "C"
     return(0);
   }
 
+  ECALC_API int eCAL_Pub_SendPayloadWriter(ECAL_HANDLE handle_, PayloadWriteCallbackCT write_full_, PayloadWriteCallbackCT write_modified_, PayloadSizeCallbackCT get_size_, void* par_, long long time_)
+  {
+    if (handle_ == nullptr) return(0);
+    if (write_full_ == nullptr || get_size_ == nullptr) return(0);
+    auto* pub = static_cast<eCAL::CPublisher*>(handle_);
+    CPayloadWriterC payload(write_full_, write_modified_, get_size_, par_);
+    return(static_cast<int>(pub->Send(payload, time_)));
+  }
+
   ECALC_API int eCAL_Pub_AddEventCallback(ECAL_HANDLE handle_, eCAL_Publisher_Event type_, PubEventCallbackCT callback_, void* par_)
   {
     if (handle_ == NULL) return(0);
@@ -483,6 +529,18 @@ static void g_sub_receive_callback(const char* topic_name_, const struct eCAL::S
   callback_(topic_name_, &data, par_);
 }
 
+static void g_sub_receive_buffer_callback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_, const ReceiveBufferCallbackCT callback_, void* par_)
+{
+  // no global lock here, the subscriber serializes its own callbacks
+  SReceiveBufferDataC data{};
+  data.buf   = data_->buf;
+  data.size  = data_->size;
+  data.id    = data_->id;
+  data.time  = data_->time;
+  data.clock = data_->clock;
+  callback_(topic_name_, &data, par_);
+}
+
 static void g_sub_event_callback(const char* topic_name_, const struct eCAL::SSubEventCallbackData* data_, const SubEventCallbackCT callback_, void* par_)
 {
   const std::lock_guard<std::recursive_mutex> lock(g_sub_callback_mtx);
@@ -616,6 +674,16 @@ extern "C"
     return(0);
   }
 
+  ECALC_API int eCAL_Sub_AddReceiveBufferCallback(ECAL_HANDLE handle_, ReceiveBufferCallbackCT callback_, void* par_)
+  {
+    if(handle_ == nullptr) return(0);
+    if(callback_ == nullptr) return(0);
+    auto* sub = static_cast<eCAL::CSubscriber*>(handle_);
+    auto callback = std::bind(g_sub_receive_buffer_callback, std::placeholders::_1, std::placeholders::_2, callback_, par_);
+    if(sub->AddReceiveCallback(callback)) return(1);
+    return(0);
+  }
+
   ECALC_API int eCAL_Sub_RemReceiveCallback(ECAL_HANDLE handle_)
   {
     if(handle_ == nullptr) return(0);
@@ -25,11 +25,15 @@
 #include "ecal_memfile.h"
 #include "ecal_memfile_info.h"
 #include "ecal_memfile_db.h"
+#include "ecal_memfile_os.h"
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <random>
 
 #define SIZEOF_PARTIAL_STRUCT(_STRUCT_NAME_, _FIELD_NAME_) (reinterpret_cast<std::size_t>(&(reinterpret_cast<_STRUCT_NAME_*>(0)->_FIELD_NAME_)) + sizeof(_STRUCT_NAME_::_FIELD_NAME_)) //NOLINT
@@ -44,7 +48,10 @@ namespace eCAL
     m_created(false),
     m_auto_sanitizing(false),
     m_payload_initialized(false),
-    m_access_state(access_state::closed)
+    m_access_state(access_state::closed),
+    m_shared_read_seq(0),
+    m_hold_slot(0),
+    m_hold_slot_claimed(false)
   {
   }
 
@@ -82,6 +89,7 @@ namespace eCAL
       m_header       = SInternalHeader();
 
       m_memfile_info = SMemFileInfo();
+      m_memfile_info.options = m_map_options;
 
       // create memory file
       if (!memfile::db::AddFile(name_, create_, create_ ? len_ + m_header.int_hdr_size : SIZEOF_PARTIAL_STRUCT(SInternalHeader, int_hdr_size), m_memfile_info))
@@ -156,6 +164,11 @@ namespace eCAL
     return(m_created);
   }
 
+  void CMemoryFile::SetMapOptions(const SMemFileMapOptions& options_)
+  {
+    m_map_options = options_;
+  }
+
   bool CMemoryFile::Destroy(const bool remove_)
   {
     if (!m_created) return(false);
@@ -163,6 +176,9 @@ namespace eCAL
     // return state
     bool ret_state = true;
 
+    // give the hold slot of this process free (the holds of this object are released at this point)
+    ReleaseHoldSlot();
+
     if (!remove_)
       m_memfile_mutex.DropOwnership();
 
@@ -214,10 +230,60 @@ namespace eCAL
     return(true);
   }
 
+  bool CMemoryFile::GetSharedReadAccess()
+  {
+    if (!m_created)                             return(false);
+    if (m_access_state != access_state::closed) return(false);
+
+    // memory files of older writers do not support shared read access
+    std::atomic<std::uint64_t>* write_seq = GetWriteSequence();
+    if (write_seq == nullptr) return(false);
+
+    // odd sequence -> write in progress
+    m_shared_read_seq = write_seq->load(std::memory_order_acquire);
+    if ((m_shared_read_seq & 1) != 0) return(false);
+
+    // update compatible header part of m_header
+    memcpy(&m_header, m_memfile_info.mem_address, std::min(sizeof(SInternalHeader), static_cast<std::size_t>(m_header.int_hdr_size)));
+
+    // the mapping has to cover the whole file (remapping needs locked access)
+    if (m_header.cur_data_size > m_header.max_data_size) return(false);
+    if (static_cast<size_t>(m_header.int_hdr_size) + static_cast<size_t>(m_header.max_data_size) > m_memfile_info.size) return(false);
+
+    // mark as opened for shared read access
+    m_access_state = access_state::shared_read_access;
+
+    return(true);
+  }
+
+  bool CMemoryFile::ReleaseSharedReadAccess()
+  {
+    if (!m_created)                                         return(false);
+    if (m_access_state != access_state::shared_read_access) return(false);
+
+    // reset states
+    m_access_state = access_state::closed;
+
+    // content is consistent if no write started in the meantime
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return(GetWriteSequence()->load(std::memory_order_relaxed) == m_shared_read_seq);
+  }
+
+  std::atomic<std::uint64_t>* CMemoryFile::GetWriteSequence() const
+  {
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory write sequence needs lock free 64 bit atomics.");
+    static_assert(offsetof(SInternalHeader, write_seq) % 8 == 0, "Shared memory write sequence has to be 8 byte aligned.");
+
+    if (m_memfile_info.mem_address == nullptr) return(nullptr);
+    if (m_header.int_hdr_size < SIZEOF_PARTIAL_STRUCT(SInternalHeader, write_seq)) return(nullptr);
+    return(reinterpret_cast<std::atomic<std::uint64_t>*>(static_cast<char*>(m_memfile_info.mem_address) + offsetof(SInternalHeader, write_seq)));
+  }
+
   size_t CMemoryFile::GetReadAddress(const void*& buf_, const size_t len_)
   {
     if (!m_created)                                          return(0);
-    if (m_access_state != access_state::read_access)         return(0);
+    if ((m_access_state != access_state::read_access)
+     && (m_access_state != access_state::shared_read_access)) return(0);
     if (len_ == 0)                                           return(0);
     if (len_ > static_cast<size_t>(m_header.cur_data_size))  return(0);
     if (m_memfile_info.mem_address == nullptr)               return(0);
@@ -247,6 +313,20 @@ namespace eCAL
     }
   }
 
+  size_t CMemoryFile::Peek(void* buf_, const size_t len_, const size_t offset_) const
+  {
+    if (buf_ == nullptr)                       return(0);
+    if (!m_created)                            return(0);
+    if (m_memfile_info.mem_address == nullptr) return(0);
+    if (static_cast<size_t>(m_header.int_hdr_size) + offset_ + len_ > m_memfile_info.size) return(0);
+
+    // copy from the mapped file without locking
+    memcpy(buf_, static_cast<const char*>(m_memfile_info.mem_address) + m_header.int_hdr_size + offset_, len_);
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return(len_);
+  }
+
   bool CMemoryFile::GetWriteAccess(int timeout_)
   {
     // currently we do not differ between read and write access
@@ -255,6 +335,14 @@ namespace eCAL
       // mark as opened for write access
       m_access_state = access_state::write_access;
 
+      // make the write visible to shared readers (odd sequence)
+      std::atomic<std::uint64_t>* write_seq = GetWriteSequence();
+      if (write_seq != nullptr)
+      {
+        write_seq->store(write_seq->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+      }
+
       return(true);
     }
 
@@ -269,6 +357,13 @@ namespace eCAL
     // reset access state
     m_access_state = access_state::closed;
 
+    // write finished (even sequence)
+    std::atomic<std::uint64_t>* write_seq = GetWriteSequence();
+    if (write_seq != nullptr)
+    {
+      write_seq->store(write_seq->load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
     // unlock mutex
     m_memfile_mutex.Unlock();
 
@@ -294,6 +389,20 @@ namespace eCAL
     return(len_);
   }
 
+  size_t CMemoryFile::GetWrittenAddress(const void*& buf_, const size_t len_) const
+  {
+    if (!m_created)                                          return(0);
+    if (m_access_state == access_state::write_access)        return(0);
+    if (len_ == 0)                                           return(0);
+    if (len_ > static_cast<size_t>(m_header.cur_data_size))  return(0);
+    if (m_memfile_info.mem_address == nullptr)               return(0);
+
+    // return address of the written content
+    buf_ = static_cast<const char*>(m_memfile_info.mem_address) + m_header.int_hdr_size;
+
+    return(len_);
+  }
+
   size_t CMemoryFile::WriteBuffer(const void* buf_, const size_t len_, const size_t offset_)
   {
     if (!m_created)      return(0);
@@ -328,11 +437,10 @@ namespace eCAL
         if (!success)
         {
           printf("Could not write payload content to the memory file (CPayload::WriteFull returned false): %s.\n\n", m_name.c_str());
+          m_payload_initialized = false;
+          return(0);
         }
-        else
-        {
-          m_payload_initialized = true;
-        }
+        m_payload_initialized = true;
       }
       else
       {
@@ -341,6 +449,9 @@ namespace eCAL
         if (!success)
         {
           printf("Could not write payload content to the memory file (CPayload::WriteModified returned false): %s.\n\n", m_name.c_str());
+          // the content may be partially modified, the next write has to be a full one
+          m_payload_initialized = false;
+          return(0);
         }
       }
 
@@ -353,6 +464,217 @@ namespace eCAL
     }
   }
 
+  bool CMemoryFile::SetBroadcastNotification(bool enable_)
+  {
+    if (!m_created) return(false);
+    if (enable_ && !memfile::os::SupportsWordWait()) return(false);
+
+    std::atomic<std::uint32_t>* notify_mode = GetHeaderWord(offsetof(SInternalHeader, notify_mode));
+    if (notify_mode == nullptr) return(false);
+
+    notify_mode->store(enable_ ? 1 : 0, std::memory_order_release);
+    return(true);
+  }
+
+  bool CMemoryFile::IsBroadcastNotification() const
+  {
+    const std::atomic<std::uint32_t>* notify_mode = GetHeaderWord(offsetof(SInternalHeader, notify_mode));
+    return((notify_mode != nullptr) && (notify_mode->load(std::memory_order_acquire) == 1));
+  }
+
+  bool CMemoryFile::NotifyAll()
+  {
+    std::atomic<std::uint32_t>* notify_seq = GetHeaderWord(offsetof(SInternalHeader, notify_seq));
+    std::atomic<std::uint32_t>* notify_ack = GetHeaderWord(offsetof(SInternalHeader, notify_ack));
+    if ((notify_seq == nullptr) || (notify_ack == nullptr)) return(false);
+
+    // open the acknowledge round of the new sequence before the readers can see it
+    // (there is only one writer, so the sequence can not change in between)
+    const std::uint32_t seq = notify_seq->load(std::memory_order_relaxed) + 1;
+    notify_ack->store(seq << 16, std::memory_order_release);
+
+    // one sequence increment and one wake up for all waiting readers
+    notify_seq->store(seq, std::memory_order_release);
+    memfile::os::WakeAllOnWord(notify_seq);
+    return(true);
+  }
+
+  std::uint32_t CMemoryFile::GetNotificationSequence() const
+  {
+    const std::atomic<std::uint32_t>* notify_seq = GetHeaderWord(offsetof(SInternalHeader, notify_seq));
+    return((notify_seq != nullptr) ? notify_seq->load(std::memory_order_acquire) : 0);
+  }
+
+  bool CMemoryFile::WaitForNotification(std::uint32_t& seq_, int timeout_ms_)
+  {
+    const std::atomic<std::uint32_t>* notify_seq = GetHeaderWord(offsetof(SInternalHeader, notify_seq));
+    if (notify_seq == nullptr) return(false);
+    if (!memfile::os::SupportsWordWait()) return(false);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms_);
+    for (;;)
+    {
+      const std::uint32_t current_seq = notify_seq->load(std::memory_order_acquire);
+      if (current_seq != seq_)
+      {
+        seq_ = current_seq;
+        return(true);
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now >= deadline) return(false);
+
+      // sleep until the writer notifies (or the word changed already)
+      const auto time_to_wait_ms = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1;
+      memfile::os::WaitOnWord(notify_seq, seq_, time_to_wait_ms);
+    }
+  }
+
+  void CMemoryFile::Acknowledge(std::uint32_t seq_)
+  {
+    std::atomic<std::uint32_t>* notify_ack = GetHeaderWord(offsetof(SInternalHeader, notify_ack));
+    if ((notify_ack == nullptr) || m_memfile_info.read_only) return;
+
+    // count the acknowledge only if it belongs to the current round
+    std::uint32_t current_ack = notify_ack->load(std::memory_order_acquire);
+    do
+    {
+      if ((current_ack >> 16) != (seq_ & 0xFFFF)) return;
+    } while (!notify_ack->compare_exchange_weak(current_ack, current_ack + 1, std::memory_order_release, std::memory_order_acquire));
+    memfile::os::WakeAllOnWord(notify_ack);
+  }
+
+  bool CMemoryFile::WaitForAcknowledges(std::uint32_t seq_, std::uint32_t count_, int timeout_ms_)
+  {
+    const std::atomic<std::uint32_t>* notify_ack = GetHeaderWord(offsetof(SInternalHeader, notify_ack));
+    if (notify_ack == nullptr) return(false);
+    if (!memfile::os::SupportsWordWait()) return(false);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms_);
+    for (;;)
+    {
+      const std::uint32_t current_ack = notify_ack->load(std::memory_order_acquire);
+      // a newer round was opened in the meantime, this one can not complete anymore
+      if ((current_ack >> 16) != (seq_ & 0xFFFF)) return(false);
+      if ((current_ack & 0xFFFF) >= count_)       return(true);
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now >= deadline) return(false);
+
+      const auto time_to_wait_ms = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1;
+      memfile::os::WaitOnWord(notify_ack, current_ack, time_to_wait_ms);
+    }
+  }
+
+  bool CMemoryFile::Hold(std::uint32_t process_id_)
+  {
+    if (m_access_state != access_state::read_access) return(false);
+
+    std::atomic<std::uint32_t>* hold_count = GetHeaderWord(offsetof(SInternalHeader, hold_count));
+    if ((hold_count == nullptr) || m_memfile_info.read_only) return(false);
+
+    // a slot is claimed once, the holds taken without one stay unattributed until they are released
+    if (!m_hold_slot_claimed) ClaimHoldSlot(process_id_);
+
+    // the writer checks the hold count under write access
+    hold_count->fetch_add(1, std::memory_order_relaxed);
+    std::atomic<std::uint32_t>* slot_count = GetHoldSlotWord(offsetof(SInternalHeader, hold_pid_count), m_hold_slot);
+    if (slot_count != nullptr) slot_count->fetch_add(1, std::memory_order_relaxed);
+    return(true);
+  }
+
+  void CMemoryFile::Unhold()
+  {
+    std::atomic<std::uint32_t>* hold_count = GetHeaderWord(offsetof(SInternalHeader, hold_count));
+    if (hold_count == nullptr) return;
+
+    // the content must not be overwritten before the holder is done with it
+    std::atomic<std::uint32_t>* slot_count = GetHoldSlotWord(offsetof(SInternalHeader, hold_pid_count), m_hold_slot);
+    if (slot_count != nullptr) slot_count->fetch_sub(1, std::memory_order_release);
+    hold_count->fetch_sub(1, std::memory_order_release);
+  }
+
+  std::uint32_t CMemoryFile::GetHoldCount() const
+  {
+    const std::atomic<std::uint32_t>* hold_count = GetHeaderWord(offsetof(SInternalHeader, hold_count));
+    return((hold_count != nullptr) ? hold_count->load(std::memory_order_acquire) : 0);
+  }
+
+  std::uint32_t CMemoryFile::GetHoldCount(std::uint32_t process_id_) const
+  {
+    const std::uint32_t hold_count = GetHoldCount();
+    if (GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), 0) == nullptr) return(hold_count);
+
+    // holds of readers without a slot (older ones or all slots taken) count for every process
+    std::uint32_t attributed(0);
+    std::uint32_t process_count(0);
+    for (std::size_t slot = 0; slot < m_header.hold_pid.size(); ++slot)
+    {
+      const std::uint32_t slot_count = GetHoldSlotWord(offsetof(SInternalHeader, hold_pid_count), slot)->load(std::memory_order_acquire);
+      attributed += slot_count;
+      if (GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), slot)->load(std::memory_order_relaxed) == process_id_) process_count += slot_count;
+    }
+    return(process_count + ((hold_count > attributed) ? hold_count - attributed : 0));
+  }
+
+  void CMemoryFile::ClaimHoldSlot(std::uint32_t process_id_)
+  {
+    // called with read access, so readers do not claim concurrently
+    m_hold_slot_claimed = true;
+    m_hold_slot         = m_header.hold_pid.size();
+    if ((process_id_ == 0) || (GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), 0) == nullptr)) return;
+
+    // take over the slot of this process (left by a former reader object), otherwise a free one
+    std::size_t free_slot(m_header.hold_pid.size());
+    for (std::size_t slot = 0; slot < m_header.hold_pid.size(); ++slot)
+    {
+      const std::uint32_t slot_pid = GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), slot)->load(std::memory_order_relaxed);
+      if (slot_pid == process_id_)
+      {
+        m_hold_slot = slot;
+        return;
+      }
+      if ((slot_pid == 0) && (free_slot == m_header.hold_pid.size())) free_slot = slot;
+    }
+    if (free_slot == m_header.hold_pid.size()) return;
+
+    GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), free_slot)->store(process_id_, std::memory_order_relaxed);
+    m_hold_slot = free_slot;
+  }
+
+  void CMemoryFile::ReleaseHoldSlot()
+  {
+    if (!m_hold_slot_claimed) return;
+    m_hold_slot_claimed = false;
+
+    // a slot with holds left keeps its process, the writer replaces the content when the process departs
+    std::atomic<std::uint32_t>* slot_count = GetHoldSlotWord(offsetof(SInternalHeader, hold_pid_count), m_hold_slot);
+    if ((slot_count != nullptr) && (slot_count->load(std::memory_order_acquire) == 0))
+    {
+      GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), m_hold_slot)->store(0, std::memory_order_relaxed);
+    }
+    m_hold_slot = m_header.hold_pid.size();
+  }
+
+  std::atomic<std::uint32_t>* CMemoryFile::GetHeaderWord(std::size_t offset_) const
+  {
+    static_assert(offsetof(SInternalHeader, notify_seq) % 4 == 0, "Shared memory notification words have to be 4 byte aligned.");
+
+    // memory files of older writers do not support broadcast notification or holds
+    if (m_memfile_info.mem_address == nullptr) return(nullptr);
+    if (m_header.int_hdr_size < SIZEOF_PARTIAL_STRUCT(SInternalHeader, hold_count)) return(nullptr);
+    return(reinterpret_cast<std::atomic<std::uint32_t>*>(static_cast<char*>(m_memfile_info.mem_address) + offset_));
+  }
+
+  std::atomic<std::uint32_t>* CMemoryFile::GetHoldSlotWord(std::size_t offset_, std::size_t slot_) const
+  {
+    // memory files of older writers do not count the holds per process
+    if (m_memfile_info.mem_address == nullptr) return(nullptr);
+    if (m_header.int_hdr_size < SIZEOF_PARTIAL_STRUCT(SInternalHeader, hold_pid_count)) return(nullptr);
+    if (slot_ >= m_header.hold_pid.size()) return(nullptr);
+    return(reinterpret_cast<std::atomic<std::uint32_t>*>(static_cast<char*>(m_memfile_info.mem_address) + offset_ + slot_ * sizeof(std::uint32_t)));
+  }
+
   bool CMemoryFile::GetAccess(int timeout_)
   {
     if (!m_created)                            return(false);
@@ -371,6 +693,25 @@ namespace eCAL
     if (m_auto_sanitizing && m_memfile_mutex.WasRecovered())
     {
       m_header.cur_data_size = 0;
+      // move the write sequence forward to an even value (the crashed writer may have left it odd)
+      const std::atomic<std::uint64_t>* write_seq = GetWriteSequence();
+      if (write_seq != nullptr) m_header.write_seq = (write_seq->load(std::memory_order_relaxed) | 1) + 1;
+      // keep the notification words and the holds, readers may be waiting on them or using the content
+      if (GetHeaderWord(offsetof(SInternalHeader, hold_count)) != nullptr)
+      {
+        m_header.notify_seq  = GetHeaderWord(offsetof(SInternalHeader, notify_seq))->load(std::memory_order_relaxed);
+        m_header.notify_ack  = GetHeaderWord(offsetof(SInternalHeader, notify_ack))->load(std::memory_order_relaxed);
+        m_header.notify_mode = GetHeaderWord(offsetof(SInternalHeader, notify_mode))->load(std::memory_order_relaxed);
+        m_header.hold_count  = GetHeaderWord(offsetof(SInternalHeader, hold_count))->load(std::memory_order_relaxed);
+      }
+      if (GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), 0) != nullptr)
+      {
+        for (std::size_t slot = 0; slot < m_header.hold_pid.size(); ++slot)
+        {
+          m_header.hold_pid[slot]       = GetHoldSlotWord(offsetof(SInternalHeader, hold_pid), slot)->load(std::memory_order_relaxed);
+          m_header.hold_pid_count[slot] = GetHoldSlotWord(offsetof(SInternalHeader, hold_pid_count), slot)->load(std::memory_order_relaxed);
+        }
+      }
       *reinterpret_cast<SInternalHeader*>(m_memfile_info.mem_address) = m_header;
     }
 
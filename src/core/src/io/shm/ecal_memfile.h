@@ -25,6 +25,7 @@
 
 #include <string>
 #include <array>
+#include <atomic>
 #include <cstdint>
 
 #include <ecal/ecal_payload_writer.h>
@@ -61,6 +62,14 @@ namespace eCAL
     **/
     bool Create(const char* name_, const bool create_, const size_t len_ = 0, const bool auto_sanitizing_ = false);
 
+    /**
+     * @brief Set the os specific mapping options (pre-faulting, locking, huge pages, NUMA binding).
+     *        They apply to memory files mapped by following Create calls.
+     *
+     * @param options_  The mapping options.
+    **/
+    void SetMapOptions(const SMemFileMapOptions& options_);
+
     /**
      * @brief Delete the associated memory file from system. 
      *
@@ -86,6 +95,25 @@ namespace eCAL
     **/
     bool ReleaseReadAccess();
 
+    /**
+     * @brief Get lock free (shared) memory file read access.
+     *
+     * Readers with shared access do not block the writer or each other. The content read
+     * between GetSharedReadAccess and ReleaseSharedReadAccess is only valid if
+     * ReleaseSharedReadAccess confirms that no write happened in the meantime.
+     * Memory files of writers without write sequence support can only be read with GetReadAccess.
+     *
+     * @return  true if shared access is supported and no write is in progress.
+    **/
+    bool GetSharedReadAccess();
+
+    /**
+     * @brief Release the shared read access and validate the read content.
+     *
+     * @return  true if the content read with shared access is consistent.
+    **/
+    bool ReleaseSharedReadAccess();
+
     /**
      * @brief Get payload buffer pointer from an opened memory file for reading.
      *
@@ -107,6 +135,20 @@ namespace eCAL
     **/
     size_t Read(void* buf_, const size_t len_, const size_t offset_);
 
+    /**
+     * @brief Read bytes from the memory file without acquiring read access.
+     *
+     * The content may be written concurrently, so it can only be used as a hint
+     * (like polling a header clock) that has to be confirmed under read access.
+     *
+     * @param buf_     The destination address.
+     * @param len_     The length of the allocated memory (has to be allocated by caller).
+     * @param offset_  The offset where to start reading.
+     *
+     * @return         Number of copied bytes (or zero if it fails).
+    **/
+    size_t Peek(void* buf_, const size_t len_, const size_t offset_) const;
+
     /**
      * @brief Get memory file write access.
      *
@@ -133,6 +175,19 @@ namespace eCAL
     **/
     size_t GetWriteAddress(void*& buf_, const size_t len_);
 
+    /**
+     * @brief Get payload buffer pointer of the content written by the owner of the memory file.
+     *
+     * Only the process that created the memory file writes into it, so that process can
+     * access its own last written content without locking until it writes again.
+     *
+     * @param buf_     The destination address.
+     * @param len_     Expected length of the available payload.
+     *
+     * @return         Number of available bytes (or zero if it fails).
+    **/
+    size_t GetWrittenAddress(const void*& buf_, const size_t len_) const;
+
     /**
      * @brief Write bytes to the memory file.
      *
@@ -152,10 +207,112 @@ namespace eCAL
      * @param offset_             The offset for writing the data.
      * @param force_full_write_   Force full write action.
      *
-     * @return          Number of bytes accessed (len if succeeded otherwise zero).
+     * @return          Number of bytes accessed (len if succeeded, zero if the memory file or the payload writer failed).
     **/
     size_t WritePayload(CPayloadWriter& payload_, size_t len_, size_t offset_, bool force_full_write_ = false);
 
+    /**
+     * @brief Switch the memory file (creator only) to broadcast notification.
+     *
+     * In broadcast mode the writer wakes up all readers with one shared futex broadcast and
+     * collects their acknowledges with one shared counter (linux only).
+     *
+     * @param enable_  Enable or disable broadcast notification.
+     *
+     * @return  true if broadcast notification is supported by the memory file and the os.
+    **/
+    bool SetBroadcastNotification(bool enable_);
+
+    /**
+     * @brief Check if the writer of the memory file notifies its readers by broadcast.
+     *
+     * @return  true if broadcast notification is enabled.
+    **/
+    bool IsBroadcastNotification() const;
+
+    /**
+     * @brief Wake up all readers waiting for a notification (broadcast mode).
+     *
+     * Every notification starts a new acknowledge round, acknowledges of older
+     * notifications arriving late are not counted anymore.
+     *
+     * @return  true if it succeeds, false if it fails.
+    **/
+    bool NotifyAll();
+
+    /**
+     * @brief Get the current notification sequence (broadcast mode).
+     *
+     * @return  The notification sequence.
+    **/
+    std::uint32_t GetNotificationSequence() const;
+
+    /**
+     * @brief Wait until the notification sequence differs from the given one (broadcast mode).
+     *
+     * @param seq_         The last seen notification sequence, updated on success.
+     * @param timeout_ms_  The timeout in ms.
+     *
+     * @return  true if the writer notified in the meantime.
+    **/
+    bool WaitForNotification(std::uint32_t& seq_, int timeout_ms_);
+
+    /**
+     * @brief Acknowledge a notification to the writer (broadcast mode).
+     *
+     * @param seq_  The notification sequence the acknowledge belongs to, it is dropped
+     *              if the writer notified again in the meantime.
+    **/
+    void Acknowledge(std::uint32_t seq_);
+
+    /**
+     * @brief Wait until the given number of readers acknowledged a notification (broadcast mode).
+     *
+     * @param seq_         The notification sequence to wait for.
+     * @param count_       The number of acknowledges to wait for.
+     * @param timeout_ms_  The timeout in ms.
+     *
+     * @return  true if all acknowledges arrived in time.
+    **/
+    bool WaitForAcknowledges(std::uint32_t seq_, std::uint32_t count_, int timeout_ms_);
+
+    /**
+     * @brief Hold the current content (needs read access), the writer does not overwrite
+     *        held content, so it stays valid after the read access is released.
+     *
+     * The held content stays mapped as long as this memory file object exists, even if
+     * the memory file is remapped to a larger size in the meantime.
+     *
+     * @param process_id_  The holding process, its holds are counted in a slot of its own
+     *                     (as long as there is a free one), so the writer can tell which
+     *                     content a departed process still holds.
+     *
+     * @return  true if the memory file supports holding content.
+    **/
+    bool Hold(std::uint32_t process_id_);
+
+    /**
+     * @brief Release content held with Hold (no access needed).
+    **/
+    void Unhold();
+
+    /**
+     * @brief Get the number of holds of the current content.
+     *
+     * @return  The hold count.
+    **/
+    std::uint32_t GetHoldCount() const;
+
+    /**
+     * @brief Get the number of holds of the current content by the given process
+     *        (holds without a process slot can not be attributed and are included).
+     *
+     * @param process_id_  The holding process.
+     *
+     * @return  The hold count of the process.
+    **/
+    std::uint32_t GetHoldCount(std::uint32_t process_id_) const;
+
     /**
      * @brief Maximum data size of the whole memory file.
      *
@@ -176,6 +333,7 @@ namespace eCAL
 
     bool IsOpened()          const {return(m_access_state != access_state::closed);};
     bool HasReadAccess()     const {return(m_access_state == access_state::read_access);};
+    bool HasSharedReadAccess() const {return(m_access_state == access_state::shared_read_access);};
     bool HasWriteAccess()    const {return(m_access_state == access_state::write_access);};
 
     
@@ -201,26 +359,46 @@ namespace eCAL
       // New fields should only declare well defined data types and be aligned to 8 bytes
       // std::uint8_t                 _new_field  = 0;
       // std::array<std::uint8_t, 7>  _reserved_1 = {};
+#if _WIN32 || _WIN64 || (INTPTR_MAX == INT32_MAX)
+      std::array<std::uint8_t, 4> _reserved_1   = {}; // Add 4 bytes padding to align write_seq to 8 bytes
+#endif
+      std::uint64_t               write_seq     = 0;  // Sequence lock for shared readers (odd while written), eCAL > 5.13
+      std::uint32_t               notify_seq    = 0;  // Broadcast notification sequence (futex word), eCAL > 5.13
+      std::uint32_t               notify_ack    = 0;  // Broadcast acknowledge round (futex word, notify_seq << 16 | count), eCAL > 5.13
+      std::uint32_t               notify_mode   = 0;  // Readers are notified by broadcast (1) or by named events (0), eCAL > 5.13
+      std::uint32_t               hold_count    = 0;  // Number of samples held by readers without read access, eCAL > 5.13
+      std::array<std::uint32_t, 8> hold_pid       = {};  // Processes holding samples, one slot per process (0 = free slot), eCAL > 5.13
+      std::array<std::uint32_t, 8> hold_pid_count = {};  // Number of samples held by the process of the slot, eCAL > 5.13
     };
 #pragma pack(pop)
 
   protected:
     bool GetAccess(int timeout_);
+    std::atomic<std::uint64_t>* GetWriteSequence() const;
+    std::atomic<std::uint32_t>* GetHeaderWord(std::size_t offset_) const;
+    std::atomic<std::uint32_t>* GetHoldSlotWord(std::size_t offset_, std::size_t slot_) const;
+    void ClaimHoldSlot(std::uint32_t process_id_);
+    void ReleaseHoldSlot();
 
     enum class access_state
     {
       closed,
       read_access,
+      shared_read_access,
       write_access
     };
-    bool            m_created;
-    bool            m_auto_sanitizing;
-    bool            m_payload_initialized;
-    access_state    m_access_state;
-    std::string     m_name;
-    SInternalHeader m_header;
-    SMemFileInfo    m_memfile_info;
-    CNamedMutex     m_memfile_mutex;
+    bool               m_created;
+    bool               m_auto_sanitizing;
+    bool               m_payload_initialized;
+    access_state       m_access_state;
+    std::string        m_name;
+    SInternalHeader    m_header;
+    std::uint64_t      m_shared_read_seq;
+    std::size_t        m_hold_slot;
+    bool               m_hold_slot_claimed;
+    SMemFileInfo       m_memfile_info;
+    SMemFileMapOptions m_map_options;
+    CNamedMutex        m_memfile_mutex;
 
   private:
     CMemoryFile(const CMemoryFile&);                 // prevent copy-construction
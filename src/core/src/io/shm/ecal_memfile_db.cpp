@@ -56,6 +56,13 @@ namespace eCAL
 
     // clear map
     m_memfile_map.clear();
+
+    // unmap all retired mappings
+    for (auto& retired_files : m_retired_memfile_map)
+    {
+      for (auto& retired_file : retired_files.second) memfile::os::UnMapFile(retired_file);
+    }
+    m_retired_memfile_map.clear();
   }
 
   bool CMemFileMap::AddFile(const std::string& name_, const bool create_, const size_t len_, SMemFileInfo& mem_file_info_)
@@ -95,7 +102,7 @@ namespace eCAL
       iter->second.refcnt++;
 
       // check memory file size
-      memfile::os::CheckFileSize(len_, false, iter->second);
+      GrowFile(name_, len_, iter->second);
 
       // copy info from memory file map
       mem_file_info_ = iter->second;
@@ -127,6 +134,7 @@ namespace eCAL
 
         // unmap memory file
         memfile::os::UnMapFile(memfile_info);
+        UnMapRetiredFiles(name_);
 
         // remove memory file from system
         if (remove_from_system) memfile::os::RemoveFile(memfile_info);
@@ -146,18 +154,54 @@ namespace eCAL
 
   bool CMemFileMap::CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_)
   {
-    // check and correct file size
-    memfile::os::CheckFileSize(len_, false, mem_file_info_);
-
     // lock memory map access
     const std::lock_guard<std::mutex> lock(m_memfile_map_mtx);
 
-    // update/set info
-    m_memfile_map[name_] = mem_file_info_;
+    const MemFileMapT::iterator iter = m_memfile_map.find(name_);
+    if (iter == m_memfile_map.end())
+    {
+      // check and correct file size
+      memfile::os::CheckFileSize(len_, false, mem_file_info_);
+
+      // set info
+      m_memfile_map[name_] = mem_file_info_;
+    }
+    else
+    {
+      // check and correct file size of the shared mapping
+      GrowFile(name_, len_, iter->second);
+
+      // and update info (another memory file object may have mapped it larger already)
+      mem_file_info_ = iter->second;
+    }
 
     return(true);
   }
 
+  void CMemFileMap::GrowFile(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_)
+  {
+    // called with locked memory map access
+    if ((len_ > mem_file_info_.size) && (mem_file_info_.mem_address != nullptr))
+    {
+      // the old mapping may still be in use (held samples, memory file objects that did not
+      // update their info yet), so it is kept until the memory file is removed from the map
+      m_retired_memfile_map[name_].push_back(mem_file_info_);
+      mem_file_info_.mem_address = nullptr;
+      mem_file_info_.map_region  = MapRegionT();
+    }
+    memfile::os::CheckFileSize(len_, false, mem_file_info_);
+  }
+
+  void CMemFileMap::UnMapRetiredFiles(const std::string& name_)
+  {
+    // called with locked memory map access
+    const RetiredMemFileMapT::iterator iter = m_retired_memfile_map.find(name_);
+    if (iter == m_retired_memfile_map.end()) return;
+
+    for (auto& retired_file : iter->second) memfile::os::UnMapFile(retired_file);
+    m_retired_memfile_map.erase(iter);
+  }
+
   namespace memfile
   {
     namespace db
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "ecal_memfile_info.h"
 
@@ -44,9 +45,14 @@ namespace eCAL
     bool CheckFileSize(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
 
   protected:
-    using MemFileMapT = std::unordered_map<std::string, SMemFileInfo>;
-    std::mutex  m_memfile_map_mtx;
-    MemFileMapT m_memfile_map;
+    void GrowFile(const std::string& name_, const size_t len_, SMemFileInfo& mem_file_info_);
+    void UnMapRetiredFiles(const std::string& name_);
+
+    using MemFileMapT        = std::unordered_map<std::string, SMemFileInfo>;
+    using RetiredMemFileMapT = std::unordered_map<std::string, std::vector<SMemFileInfo>>;
+    std::mutex         m_memfile_map_mtx;
+    MemFileMapT        m_memfile_map;
+    RetiredMemFileMapT m_retired_memfile_map;
   };
 
   namespace memfile
@@ -46,6 +46,15 @@ typedef int  MapRegionT;
 
 namespace eCAL
 {
+  struct SMemFileMapOptions
+  {
+    bool         populate    = false;   //!< pre-fault the mapping on creation (MAP_POPULATE)
+    bool         lock        = false;   //!< lock the mapping into RAM (mlock)
+    int          huge_pages  = 0;       //!< 0 = off, 1 = transparent huge pages, 2 = hugetlbfs backed file
+    std::string  hugetlbfs_path;        //!< hugetlbfs mount point (huge_pages == 2)
+    int          numa_node   = -1;      //!< bind the pages of created files to this NUMA node (-1 = off)
+  };
+
   struct SMemFileInfo
   {
     int          refcnt      = 0;
@@ -56,5 +65,7 @@ namespace eCAL
     std::string  name;
     size_t       size        = 0;
     bool         exists      = false;
+    bool         read_only   = false;   //!< opened without write permission, readers can not hold content or acknowledge
+    SMemFileMapOptions options;
   };
 }
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 
 #include "ecal_memfile.h"
@@ -41,6 +43,11 @@ namespace eCAL
       bool UnMapFile(SMemFileInfo& mem_file_info_);
 
       bool CheckFileSize(const size_t len_, const bool create_, SMemFileInfo& mem_file_info_);
+
+      // process shared wait / wake up on a 32 bit word inside a memory file (futex, linux only)
+      bool SupportsWordWait();
+      bool WaitOnWord(const std::atomic<uint32_t>* word_, uint32_t expected_, int64_t timeout_ms_);
+      void WakeAllOnWord(std::atomic<uint32_t>* word_);
     }
   }
 }
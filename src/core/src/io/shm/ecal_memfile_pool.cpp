@@ -22,11 +22,16 @@
  * @brief  memory file pool handler
 **/
 
+#include <ecal/ecal_config.h>
+#include <ecal/ecal_process.h>
+
 #include "ecal_def.h"
 #include "ecal_event.h"
 #include "ecal_memfile_pool.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 
 namespace eCAL
 {
@@ -37,7 +42,11 @@ namespace eCAL
     m_created(false),
     m_do_stop(false),
     m_is_observing(false),
-    m_time_of_last_life_signal(std::chrono::steady_clock::now())
+    m_time_of_last_life_signal(std::chrono::steady_clock::now()),
+    m_spin_budget_us(0),
+    m_hold_samples(false),
+    m_hold_supported(true),
+    m_notify_seq(0)
   {
   }
 
@@ -58,9 +67,18 @@ namespace eCAL
     gOpenNamedEvent(&m_event_snd, memfile_event_, false);
     gOpenNamedEvent(&m_event_ack, memfile_event_ + "_ack", false);
 
-    // create memory file access
+    // create memory file access, mapped the same way as by the publisher
+    SMemFileMapOptions map_options;
+    map_options.populate       = Config::IsMemfilePopulateEnabled();
+    map_options.lock           = Config::IsMemfileLockEnabled();
+    map_options.huge_pages     = Config::GetMemfileHugePagesMode();
+    map_options.hugetlbfs_path = Config::GetMemfileHugetlbfsPath();
+    m_memfile.SetMapOptions(map_options);
     m_memfile.Create(memfile_name_.c_str(), false);
 
+    // updates are notified from now on (broadcast notification mode)
+    m_notify_seq = m_memfile.GetNotificationSequence();
+
     m_created = true;
 
 #ifndef NDEBUG
@@ -115,18 +133,25 @@ namespace eCAL
   }
 
 
+  void CMemFileObserver::RequestStop()
+  {
+    if (!m_created)      return;
+    if (!m_is_observing) return;
+
+    // signal observer to stop
+    m_do_stop = true;
+
+    // set sync event to unlock loop
+    // (in broadcast notification mode the loop notices the stop request within 20 ms)
+    gSetEvent(m_event_snd);
+  }
+
   bool CMemFileObserver::Stop()
   {
     if (!m_created) return false;
 
-    if (m_is_observing)
-    {
-      // signal observer to stop
-      m_do_stop = true;
-
-      // set sync event to unlock loop
-      gSetEvent(m_event_snd);
-    }
+    // signal observer to stop
+    RequestStop();
 
     // wait for finalization
     if(m_thread.joinable()) m_thread.join();
@@ -143,6 +168,57 @@ namespace eCAL
     return true;
   }
 
+  void CMemFileObserver::ApplyReaderRequest(const std::string& reader_id_, std::chrono::microseconds spin_budget_, bool hold_samples_, std::chrono::milliseconds expiry_)
+  {
+    const std::lock_guard<std::mutex> lock(m_reader_requests_sync);
+    if ((spin_budget_.count() > 0) || hold_samples_) m_reader_requests[reader_id_] = { spin_budget_, hold_samples_, std::chrono::steady_clock::now() + expiry_ };
+    else                                             m_reader_requests.erase(reader_id_);
+    UpdateReaderRequests();
+  }
+
+  void CMemFileObserver::RemoveReaderRequest(const std::string& reader_id_)
+  {
+    const std::lock_guard<std::mutex> lock(m_reader_requests_sync);
+    if (m_reader_requests.erase(reader_id_) != 0) UpdateReaderRequests();
+  }
+
+  void CMemFileObserver::ExpireReaderRequests()
+  {
+    // requests are refreshed with every registration of the writer,
+    // requests of subscribers gone without unsubscribing expire
+    const std::lock_guard<std::mutex> lock(m_reader_requests_sync);
+    const auto now = std::chrono::steady_clock::now();
+    bool expired(false);
+    for (auto iter = m_reader_requests.begin(); iter != m_reader_requests.end();)
+    {
+      if (iter->second.expiry < now)
+      {
+        iter    = m_reader_requests.erase(iter);
+        expired = true;
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+    if (expired) UpdateReaderRequests();
+  }
+
+  void CMemFileObserver::UpdateReaderRequests()
+  {
+    // the observer is shared by all subscribers of this process,
+    // so the most demanding live subscriber defines the spin budget and if samples are held
+    std::chrono::microseconds spin_budget(0);
+    bool hold_samples(false);
+    for (const auto& request : m_reader_requests)
+    {
+      spin_budget   = std::max(spin_budget, request.second.spin_budget);
+      hold_samples |= request.second.hold_samples;
+    }
+    m_spin_budget_us = spin_budget.count();
+    m_hold_samples   = hold_samples;
+  }
+
   void CMemFileObserver::Observe(const std::string& topic_name_, const std::string& topic_id_, const int timeout_)
   {
     // internal clock sample update checking
@@ -160,9 +236,19 @@ namespace eCAL
     {
       if (!has_unprocessed_data)
       {
-        // Only wait for the new-data-event, if we haven't processed the data, yet
-        // check for memory file update event from shm writer (20 ms)
-        has_unprocessed_data = gWaitForEvent(m_event_snd, 20);
+        // Busy poll the header clock first if a spin budget is requested,
+        // the update event of the detected sample is consumed without waiting
+        if (SpinForUpdate(last_sample_clock))
+        {
+          ConsumeUpdate();
+          has_unprocessed_data = true;
+        }
+        else
+        {
+          // Only wait for the new-data-event, if we haven't processed the data, yet
+          // check for memory file update event from shm writer (20 ms)
+          has_unprocessed_data = WaitForUpdate(20);
+        }
 
         if (has_unprocessed_data)
         {
@@ -177,8 +263,39 @@ namespace eCAL
         // last chance to stop ..
         if(m_do_stop) break;
 
+        // hold the sample in the memory file and release the lock right away,
+        // the writer moves on to other memory files until the sample is released
+        if (m_hold_samples && m_hold_supported)
+        {
+          if (ReadHeld(topic_name_, topic_id_, last_sample_clock)) has_unprocessed_data = false;
+          continue;
+        }
+
+        // try to copy the sample lock free first, so readers neither block the writer nor each other
+        // (buffered mode and writers supporting shared read access only)
+        SMemFileHeader shared_hdr;
+        const eSharedRead shared_read = ReadShared(shared_hdr, receive_buffer, last_sample_clock);
+        if (shared_read != eSharedRead::failed)
+        {
+          has_unprocessed_data = false;
+
+          if (shared_read == eSharedRead::new_sample)
+          {
+            // store clock
+            last_sample_clock = shared_hdr.clock;
+
+            // add sample to data reader (and call user callback function)
+            if (m_data_callback) m_data_callback(topic_name_, topic_id_, receive_buffer.data(), receive_buffer.size(), (long long)shared_hdr.id, (long long)shared_hdr.clock, (long long)shared_hdr.time, (size_t)shared_hdr.hash, nullptr);
+
+            // send acknowledge event
+            if (shared_hdr.ack_timout_ms != 0)
+            {
+              SendAcknowledge();
+            }
+          }
+        }
         // try to open memory file (timeout 5 ms)
-        if(m_memfile.GetReadAccess(5))
+        else if(m_memfile.GetReadAccess(5))
         {
           // We have gotten access! Now the data qualifies as processed, so next loop we will wait for the signal for new data, again.
           has_unprocessed_data = false;
@@ -214,7 +331,7 @@ namespace eCAL
                 // calculate data buffer offset
                 const char* data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
                 // add sample to data reader (and call user callback function)
-                if (m_data_callback) m_data_callback(topic_name_, topic_id_, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
+                if (m_data_callback) m_data_callback(topic_name_, topic_id_, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, nullptr);
               }
             }
             // -------------------------------------------------------------------------
@@ -248,13 +365,13 @@ namespace eCAL
             if (post_process_buffer)
             {
               // add sample to data reader (and call user callback function)
-              if (m_data_callback) m_data_callback(topic_name_, topic_id_, receive_buffer.data(), receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
+              if (m_data_callback) m_data_callback(topic_name_, topic_id_, receive_buffer.data(), receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, nullptr);
             }
 
             // send acknowledge event
             if (mfile_hdr.ack_timout_ms != 0)
             {
-              gSetEvent(m_event_ack);
+              SendAcknowledge();
             }
           }
         }
@@ -277,6 +394,124 @@ namespace eCAL
     m_is_observing = false; //-V1020
   }
 
+  bool CMemFileObserver::SpinForUpdate(uint64_t last_sample_clock_)
+  {
+    const std::chrono::microseconds spin_budget(m_spin_budget_us.load(std::memory_order_relaxed));
+    if (spin_budget.count() <= 0) return false;
+
+    // poll the header clock without locking the memory file until the spin budget is exhausted,
+    // a detected update is verified under read access later on
+    const auto spin_end = std::chrono::steady_clock::now() + spin_budget;
+    do
+    {
+      uint64_t clock(0);
+      if ((m_memfile.Peek(&clock, sizeof(clock), offsetof(SMemFileHeader, clock)) == sizeof(clock)) && (clock > last_sample_clock_))
+      {
+        return true;
+      }
+    } while (!m_do_stop && (std::chrono::steady_clock::now() < spin_end));
+
+    return false;
+  }
+
+  bool CMemFileObserver::WaitForUpdate(int timeout_ms_)
+  {
+    // one shared broadcast for all subscribers of the memory file
+    if (m_memfile.IsBroadcastNotification()) return m_memfile.WaitForNotification(m_notify_seq, timeout_ms_);
+
+    // or the update event of this process
+    return gWaitForEvent(m_event_snd, timeout_ms_);
+  }
+
+  void CMemFileObserver::ConsumeUpdate()
+  {
+    if (m_memfile.IsBroadcastNotification()) m_notify_seq = m_memfile.GetNotificationSequence();
+    else                                     gWaitForEvent(m_event_snd, 0);
+  }
+
+  void CMemFileObserver::SendAcknowledge()
+  {
+    if (m_memfile.IsBroadcastNotification()) m_memfile.Acknowledge(m_notify_seq);
+    else                                     gSetEvent(m_event_ack);
+  }
+
+  bool CMemFileObserver::ReadHeld(const std::string& topic_name_, const std::string& topic_id_, uint64_t& last_sample_clock_)
+  {
+    // try to open memory file (timeout 5 ms)
+    if (!m_memfile.GetReadAccess(5)) return false;
+
+    // read the file header and check for new content
+    SMemFileHeader mfile_hdr;
+    if (!ReadFileHeader(mfile_hdr) || (mfile_hdr.clock <= last_sample_clock_))
+    {
+      m_memfile.ReleaseReadAccess();
+      return true;
+    }
+
+    // acquire memory file payload pointer and hold the content
+    const void* buf(nullptr);
+    const bool held = (m_memfile.GetReadAddress(buf, mfile_hdr.hdr_size + mfile_hdr.data_size) > 0) && m_memfile.Hold(static_cast<std::uint32_t>(Process::GetProcessID()));
+    m_memfile.ReleaseReadAccess();
+    if (!held)
+    {
+      // writer does not support holding content, fall back to the copying read
+      m_hold_supported = false;
+      return false;
+    }
+
+    // store clock
+    last_sample_clock_ = mfile_hdr.clock;
+
+    // the content is held (and the memory file kept mapped, see CMemoryFile::Hold) until the last handle is released
+    auto self = shared_from_this();
+    const std::shared_ptr<const void> hold(buf, [self](const void*) { self->m_memfile.Unhold(); });
+
+    // add sample to data reader (and call user callback function)
+    const char* data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
+    if (m_data_callback) m_data_callback(topic_name_, topic_id_, data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash, hold);
+
+    // send acknowledge event
+    if (mfile_hdr.ack_timout_ms != 0)
+    {
+      SendAcknowledge();
+    }
+
+    return true;
+  }
+
+  CMemFileObserver::eSharedRead CMemFileObserver::ReadShared(SMemFileHeader& mfile_hdr_, std::vector<char>& receive_buffer_, uint64_t last_sample_clock_)
+  {
+    // retry a few times if the writer interferes, then fall back to locked access
+    for (int attempt = 0; attempt < 3; ++attempt)
+    {
+      if (!m_memfile.GetSharedReadAccess()) return eSharedRead::failed;
+
+      const bool header_read = ReadFileHeader(mfile_hdr_);
+      const bool new_sample  = header_read && (mfile_hdr_.clock > last_sample_clock_);
+
+      // zero copy samples are processed within the locked memory file
+      const bool copy_sample = new_sample
+                            && (mfile_hdr_.options.zero_copy == 0)
+                            && (mfile_hdr_.hdr_size + mfile_hdr_.data_size <= m_memfile.CurDataSize());
+      if (copy_sample)
+      {
+        receive_buffer_.resize((size_t)mfile_hdr_.data_size);
+        if (mfile_hdr_.data_size != 0)
+        {
+          m_memfile.Read(receive_buffer_.data(), (size_t)mfile_hdr_.data_size, mfile_hdr_.hdr_size);
+        }
+      }
+
+      // writer interfered -> content may be torn, try again
+      if (!m_memfile.ReleaseSharedReadAccess()) continue;
+
+      if (!new_sample)  return header_read ? eSharedRead::no_new_sample : eSharedRead::failed;
+      if (!copy_sample) return eSharedRead::failed;
+      return eSharedRead::new_sample;
+    }
+    return eSharedRead::failed;
+  }
+
   bool CMemFileObserver::ReadFileHeader(SMemFileHeader& mfile_hdr_)
   {
     // retrieve size of received buffer
@@ -341,6 +576,8 @@ namespace eCAL
     const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
 
     // stop all running observers
+    // (request all stops first, so the observers finish concurrently)
+    for (auto & observer : m_observer_pool) observer.second->RequestStop();
     for (auto & observer : m_observer_pool) observer.second->Stop();
 
     // clear pool (and destroy all)
@@ -349,7 +586,7 @@ namespace eCAL
     m_created = false;
   }
 
-  bool CMemFileThreadPool::ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_)
+  bool CMemFileThreadPool::ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, const std::string& reader_id_, int timeout_observation_ms, std::chrono::microseconds spin_budget_, bool hold_samples_, const MemFileDataCallbackT& callback_)
   {
     if(!m_created)            return(false);
     if(memfile_name_.empty()) return(false);
@@ -365,6 +602,7 @@ namespace eCAL
     if(observer_it != m_observer_pool.end())
     {
       auto& observer = observer_it->second;
+      observer->ApplyReaderRequest(reader_id_, spin_budget_, hold_samples_, std::chrono::milliseconds(timeout_observation_ms));
       if (observer->IsObserving())
       {
         observer->ResetTimeout();
@@ -382,6 +620,7 @@ namespace eCAL
     {
       auto observer = std::make_shared<CMemFileObserver>();
       observer->Create(memfile_name_, memfile_event_);
+      observer->ApplyReaderRequest(reader_id_, spin_budget_, hold_samples_, std::chrono::milliseconds(timeout_observation_ms));
       observer->Start(topic_name_, topic_id_, timeout_observation_ms, callback_);
       m_observer_pool[memfile_name_] = observer;
 #ifndef NDEBUG
@@ -392,6 +631,18 @@ namespace eCAL
     }
   }
 
+  void CMemFileThreadPool::RemoveReader(const std::string& reader_id_)
+  {
+    // lock pool
+    const std::lock_guard<std::mutex> lock(m_observer_pool_sync);
+
+    // drop the requests of an unsubscribed reader
+    for (auto& observer : m_observer_pool)
+    {
+      observer.second->RemoveReaderRequest(reader_id_);
+    }
+  }
+
   void CMemFileThreadPool::CleanupPoolThread()
   {
     for (;;)
@@ -429,6 +680,7 @@ namespace eCAL
       }
       else
       {
+        observer->second->ExpireReaderRequests();
         observer++;
       }
     }
@@ -30,21 +30,26 @@
 #include "ecal_memfile_header.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <condition_variable>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace eCAL
 {
-  using MemFileDataCallbackT = std::function<size_t (const std::string &, const std::string &, const char *, size_t, long long, long long, long long, size_t)>;
+  // the last argument keeps a held sample valid (nullptr if the content was copied or is only valid during the call)
+  using MemFileDataCallbackT = std::function<size_t (const std::string &, const std::string &, const char *, size_t, long long, long long, long long, size_t, const std::shared_ptr<const void> &)>;
 
   ////////////////////////////////////////
   // CMemFileObserver
   ////////////////////////////////////////
-  class CMemFileObserver
+  class CMemFileObserver : public std::enable_shared_from_this<CMemFileObserver>
   {
   public:
     CMemFileObserver();
@@ -59,13 +64,33 @@ namespace eCAL
     bool Destroy();
 
     bool Start(const std::string& topic_name_, const std::string& topic_id_, const int timeout_, const MemFileDataCallbackT& callback_);
+    void RequestStop();
     bool Stop();
     bool IsObserving() {return(m_is_observing);};
 
     bool ResetTimeout();
+    // requests of the subscribers sharing this observer (the largest live spin budget is used,
+    // samples are held as long as one live subscriber asks for it)
+    void ApplyReaderRequest(const std::string& reader_id_, std::chrono::microseconds spin_budget_, bool hold_samples_, std::chrono::milliseconds expiry_);
+    void RemoveReaderRequest(const std::string& reader_id_);
+    void ExpireReaderRequests();
 
   protected:
+    enum class eSharedRead
+    {
+      new_sample,
+      no_new_sample,
+      failed
+    };
+
     void Observe(const std::string& topic_name_, const std::string& topic_id_, const int timeout_);
+    void UpdateReaderRequests();
+    bool SpinForUpdate(uint64_t last_sample_clock_);
+    bool WaitForUpdate(int timeout_ms_);
+    void ConsumeUpdate();
+    void SendAcknowledge();
+    bool ReadHeld(const std::string& topic_name_, const std::string& topic_id_, uint64_t& last_sample_clock_);
+    eSharedRead ReadShared(SMemFileHeader& mfile_hdr_, std::vector<char>& receive_buffer_, uint64_t last_sample_clock_);
     bool ReadFileHeader(SMemFileHeader& memfile_hdr);
 
     std::atomic<bool>       m_created;
@@ -73,6 +98,18 @@ namespace eCAL
     std::atomic<bool>       m_is_observing;
 
     std::atomic<std::chrono::steady_clock::time_point> m_time_of_last_life_signal;
+    std::atomic<std::chrono::microseconds::rep>        m_spin_budget_us;
+
+    struct SReaderRequest
+    {
+      std::chrono::microseconds             spin_budget;
+      bool                                  hold_samples;
+      std::chrono::steady_clock::time_point expiry;
+    };
+    std::mutex                                         m_reader_requests_sync;
+    std::map<std::string, SReaderRequest>              m_reader_requests;
+    std::atomic<bool>                                  m_hold_samples;
+    std::atomic<bool>                                  m_hold_supported;
 
     MemFileDataCallbackT    m_data_callback;
 
@@ -80,6 +117,7 @@ namespace eCAL
     EventHandleT            m_event_snd;
     EventHandleT            m_event_ack;
     CMemoryFile             m_memfile;
+    uint32_t                m_notify_seq;
   };
 
   ////////////////////////////////////////
@@ -94,7 +132,8 @@ namespace eCAL
     void Create();
     void Destroy();
 
-    bool ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, int timeout_observation_ms, const MemFileDataCallbackT& callback_);
+    bool ObserveFile(const std::string& memfile_name_, const std::string& memfile_event_, const std::string& topic_name_, const std::string& topic_id_, const std::string& reader_id_, int timeout_observation_ms, std::chrono::microseconds spin_budget_, bool hold_samples_, const MemFileDataCallbackT& callback_);
+    void RemoveReader(const std::string& reader_id_);
 
   protected:
     void CleanupPoolThread();
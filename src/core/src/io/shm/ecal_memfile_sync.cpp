@@ -29,6 +29,7 @@
 #include "ecal_memfile_sync.h"
 
 #include <chrono>
+#include <cstdint>
 #include <sstream>
 
 namespace eCAL
@@ -134,6 +135,47 @@ namespace eCAL
   }
 
   bool CSyncMemoryFile::Write(CPayloadWriter& payload_, const SWriterAttr& data_, bool force_full_write_/* = false*/)
+  {
+    // a loan replaced the content the payload writer may want to modify
+    force_full_write_ |= m_loan_written;
+    m_loan_written = false;
+
+    return WriteContent(&payload_, data_, force_full_write_);
+  }
+
+  char* CSyncMemoryFile::Loan(size_t len_)
+  {
+    if (!m_created) return nullptr;
+
+    // we recreate a memory file if the file size is too small (see CheckSize)
+    if (m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + len_)) return nullptr;
+
+    // invalidate the current content with an empty header (clock 0),
+    // so subscribers skip the memory file while the loan is filled
+    struct SMemFileHeader memfile_hdr;
+    if (!m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms))) return nullptr;
+    if (m_memfile.GetHoldCount() != 0)
+    {
+      m_memfile.ReleaseWriteAccess();
+      return nullptr;
+    }
+    m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
+    void* buf(nullptr);
+    m_memfile.GetWriteAddress(buf, memfile_hdr.hdr_size + len_);
+    m_memfile.ReleaseWriteAccess();
+
+    if (buf == nullptr) return nullptr;
+    m_loan_written = true;
+    return static_cast<char*>(buf) + memfile_hdr.hdr_size;
+  }
+
+  bool CSyncMemoryFile::Commit(const SWriterAttr& data_)
+  {
+    // the payload is in place already, publish the header
+    return WriteContent(nullptr, data_, false);
+  }
+
+  bool CSyncMemoryFile::WriteContent(CPayloadWriter* payload_, const SWriterAttr& data_, bool force_full_write_)
   {
     if (!m_created)
     {
@@ -168,10 +210,17 @@ namespace eCAL
     memfile_hdr.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
 
     // acquire write access
+    const auto lock_start = std::chrono::steady_clock::now();
     bool write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+    if (m_attr.lock_latency != nullptr) m_attr.lock_latency->Record(std::chrono::steady_clock::now() - lock_start);
 
     // maybe it's locked by a zombie or a crashed process
-    // so we try to recreate a new one
+    // so we try to recreate a new one (not for a loan, its payload lives in this file)
+    if (!write_access && (payload_ == nullptr))
+    {
+      Logging::Log(log_level_error, m_base_name + "::CSyncMemoryFile::Commit::GetWriteAccess - FAILED");
+      return false;
+    }
     if (!write_access)
     {
 #ifndef NDEBUG
@@ -191,6 +240,16 @@ namespace eCAL
       }
     }
 
+    // subscribers hold the current content, it must not be overwritten
+    if (m_memfile.GetHoldCount() != 0)
+    {
+      m_memfile.ReleaseWriteAccess();
+#ifndef NDEBUG
+      Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::Write - content held by subscribers");
+#endif
+      return false;
+    }
+
     // now write content
     bool written(true);
     size_t wbytes(0);
@@ -199,15 +258,33 @@ namespace eCAL
     written &= m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, wbytes) > 0;
     wbytes += memfile_hdr.hdr_size;
     // write the buffer
-    if (data_.len > 0)
+    if ((payload_ != nullptr) && (data_.len > 0))
     {
-      written &= m_memfile.WritePayload(payload_, data_.len, wbytes, force_full_write_) > 0;
+      written &= m_memfile.WritePayload(*payload_, data_.len, wbytes, force_full_write_) > 0;
+    }
+    // or restore the content size of the loaned payload (the header write reset it)
+    else if (payload_ == nullptr)
+    {
+      void* buf(nullptr);
+      written &= m_memfile.GetWriteAddress(buf, wbytes + data_.len) > 0;
+    }
+    // the payload writer failed, invalidate the incomplete content with an empty header (clock 0),
+    // so subscribers skip the memory file
+    if (!written)
+    {
+      const struct SMemFileHeader empty_hdr;
+      m_memfile.WriteBuffer(&empty_hdr, empty_hdr.hdr_size, 0);
     }
     // release write access
     m_memfile.ReleaseWriteAccess();
 
     // and fire the publish event for local subscriber
-    if (written) SyncContent();
+    // (or leave it to SyncPendingContent for batched writes)
+    if (written)
+    {
+      m_sync_pending = data_.defer_sync;
+      if (!m_sync_pending) SyncContent();
+    }
 
     if (written)
     {
@@ -224,6 +301,39 @@ namespace eCAL
     return written;
   }
 
+  void CSyncMemoryFile::SignalPendingContent()
+  {
+    if (!m_sync_pending) return;
+    m_sync_pending = false;
+    SignalContent();
+  }
+
+  const char* CSyncMemoryFile::GetWrittenPayload(size_t len_) const
+  {
+    // the payload follows the user file header written in Write
+    const void* buf(nullptr);
+    if (m_memfile.GetWrittenAddress(buf, sizeof(SMemFileHeader) + len_) == 0) return nullptr;
+    return static_cast<const char*>(buf) + sizeof(SMemFileHeader);
+  }
+
+  bool CSyncMemoryFile::IsHeld() const
+  {
+    if (!m_created) return false;
+    return m_memfile.GetHoldCount() != 0;
+  }
+
+  bool CSyncMemoryFile::IsHeldBy(std::uint32_t process_id_) const
+  {
+    if (!m_created) return false;
+    return m_memfile.GetHoldCount(process_id_) != 0;
+  }
+
+  bool CSyncMemoryFile::Renew()
+  {
+    if (!m_created) return false;
+    return Recreate(m_memfile.MaxDataSize());
+  }
+
   std::string CSyncMemoryFile::GetName() const
   {
     return m_memfile_name;
@@ -249,6 +359,7 @@ namespace eCAL
     if (memfile_size < m_attr.min_size) memfile_size = m_attr.min_size;
 
     // create the memory file
+    m_memfile.SetMapOptions(m_attr.map_options);
     if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size))
     {
       Logging::Log(log_level_error, std::string("CSyncMemoryFile::Create FAILED : ") + m_memfile_name);
@@ -265,6 +376,12 @@ namespace eCAL
     m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
     m_memfile.ReleaseWriteAccess();
 
+    // notify the subscribers by broadcast if requested and supported
+    if (m_attr.broadcast_notify && !m_memfile.SetBroadcastNotification(true))
+    {
+      Logging::Log(log_level_warning, std::string("CSyncMemoryFile::Create - broadcast notification not supported, using events : ") + m_memfile_name);
+    }
+
     // it's created
     m_created = true;
 
@@ -327,6 +444,12 @@ namespace eCAL
   }
 
   void CSyncMemoryFile::SyncContent()
+  {
+    SignalContent();
+    WaitForAcknowledges();
+  }
+
+  void CSyncMemoryFile::SignalContent()
   {
     if (!m_created) return;
 
@@ -335,6 +458,16 @@ namespace eCAL
 
     const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
 
+    // all acknowledges of this content have to arrive until then
+    m_ack_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_attr.timeout_ack_ms);
+
+    // one shared wake up for all subscribers
+    if (m_memfile.IsBroadcastNotification())
+    {
+      SignalContentBroadcast();
+      return;
+    }
+
     // "eat" old acknowledge events :)
     if (m_attr.timeout_ack_ms != 0)
     {
@@ -345,51 +478,109 @@ namespace eCAL
     }
 
     // send sync (memory file update) event
-    for (const auto& event_handle : m_event_handle_map)
+    for (auto& event_handle : m_event_handle_map)
     {
       // send sync event
       gSetEvent(event_handle.second.event_snd);
+
+      // The ack event has timeouted before. Thus, we don't wait for it
+      // anymore, until the subscriber notifies us via registration layer
+      // that it is still alive.
+      event_handle.second.event_ack_is_pending = (m_attr.timeout_ack_ms != 0) && !event_handle.second.event_ack_is_invalid;
     }
 
-    // wait for acknowledgment event from receiver side
-    if (m_attr.timeout_ack_ms != 0)
+#ifndef NDEBUG
+    Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::SignalWritten");
+#endif
+  }
+
+  void CSyncMemoryFile::WaitForAcknowledges()
+  {
+    if (!m_created) return;
+
+    const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+
+    if (m_memfile.IsBroadcastNotification())
     {
-      // take start time for all acknowledge timeouts
-      const auto start_time = std::chrono::steady_clock::now();
+      WaitForAcknowledgesBroadcast();
+      return;
+    }
 
-      for (auto& event_handle : m_event_handle_map)
+    // wait for acknowledgment event from receiver side (subscribers connected after the signal are not waited for)
+    for (auto& event_handle : m_event_handle_map)
+    {
+      if (!event_handle.second.event_ack_is_pending) continue;
+      event_handle.second.event_ack_is_pending = false;
+
+      if (!gWaitForEvent(event_handle.second.event_ack, TimeToAckDeadlineMs()))
       {
-        const auto time_since_start = std::chrono::steady_clock::now() - start_time;
-        const auto time_to_wait     = std::chrono::milliseconds(m_attr.timeout_ack_ms)- time_since_start;
-        long       time_to_wait_ms  = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait).count());
-        if (time_to_wait_ms <= 0) time_to_wait_ms = 0;
-
-        if (event_handle.second.event_ack_is_invalid)
-        {
-          // The ack event has timeouted before. Thus, we don't wait for it
-          // anymore, until the subscriber notifies us via registration layer
-          // that it is still alive.
-          continue;
-        }
-
-        if (!gWaitForEvent(event_handle.second.event_ack, time_to_wait_ms))
-        {
-          // Remember that this event has timeouted. This will not cause the
-          // publisher to wait for it anymore, until the subscriber actively
-          // requests that via registration layer again.
-          event_handle.second.event_ack_is_invalid = true;
+        // Remember that this event has timeouted. This will not cause the
+        // publisher to wait for it anymore, until the subscriber actively
+        // requests that via registration layer again.
+        event_handle.second.event_ack_is_invalid = true;
 #ifndef NDEBUG
-          Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::SignalWritten - ACK event timeout");
+        Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::SignalWritten - ACK event timeout");
 #endif
-        }
       }
     }
+  }
+
+  void CSyncMemoryFile::SignalContentBroadcast()
+  {
+    m_broadcast_ack_pending = false;
+
+    // no connected subscriber, nobody to notify
+    if (m_event_handle_map.empty()) return;
+
+    // send sync (memory file update) broadcast, this starts a new acknowledge round
+    // (late acknowledges of earlier notifications do not count for it)
+    m_memfile.NotifyAll();
+
+    // wait once for the acknowledges of all subscribers that did not time out before
+    if (m_attr.timeout_ack_ms != 0)
+    {
+      std::uint32_t ack_count(0);
+      for (const auto& event_handle : m_event_handle_map)
+      {
+        if (!event_handle.second.event_ack_is_invalid) ++ack_count;
+      }
+      m_broadcast_ack_seq     = m_memfile.GetNotificationSequence();
+      m_broadcast_ack_count   = ack_count;
+      m_broadcast_ack_pending = (ack_count != 0);
+    }
 
 #ifndef NDEBUG
     Logging::Log(log_level_debug4, m_base_name + "::CSyncMemoryFile::SignalWritten");
 #endif
   }
 
+  void CSyncMemoryFile::WaitForAcknowledgesBroadcast()
+  {
+    if (!m_broadcast_ack_pending) return;
+    m_broadcast_ack_pending = false;
+
+    if (!m_memfile.WaitForAcknowledges(m_broadcast_ack_seq, m_broadcast_ack_count, static_cast<int>(TimeToAckDeadlineMs())))
+    {
+      // The shared counter does not tell which subscriber is missing. So we
+      // stop waiting for all of them, until they request that via registration
+      // layer again.
+      for (auto& event_handle : m_event_handle_map)
+      {
+        event_handle.second.event_ack_is_invalid = true;
+      }
+#ifndef NDEBUG
+      Logging::Log(log_level_debug2, m_base_name + "::CSyncMemoryFile::SignalWritten - ACK broadcast timeout");
+#endif
+    }
+  }
+
+  long CSyncMemoryFile::TimeToAckDeadlineMs() const
+  {
+    const auto time_to_wait = m_ack_deadline - std::chrono::steady_clock::now();
+    const long time_to_wait_ms = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(time_to_wait).count());
+    return (time_to_wait_ms > 0) ? time_to_wait_ms : 0;
+  }
+
   void CSyncMemoryFile::DisconnectAll()
   {
     const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
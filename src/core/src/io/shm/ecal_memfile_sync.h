@@ -26,9 +26,12 @@
 #include <ecal/ecal_payload_writer.h>
 
 #include "readwrite/ecal_writer_data.h"
+#include "util/ecal_latency_histogram.h"
 #include "ecal_eventhandle.h"
 #include "ecal_memfile.h"
 
+#include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -37,10 +40,13 @@ namespace eCAL
 {
   struct SSyncMemoryFileAttr
   {
-    size_t  min_size;           //!< memory file minimum size [Bytes]
-    size_t  reserve;            //!< dynamic file size reserve before recreating memory file if payload size changes [%]
-    int64_t timeout_open_ms;    //!< timeout to open a memory file using mutex lock [ms]
-    int64_t timeout_ack_ms;     //!< timeout for memory read acknowledge signal from data reader [ms]
+    size_t             min_size;         //!< memory file minimum size [Bytes]
+    size_t             reserve;          //!< dynamic file size reserve before recreating memory file if payload size changes [%]
+    int64_t            timeout_open_ms;  //!< timeout to open a memory file using mutex lock [ms]
+    int64_t            timeout_ack_ms;   //!< timeout for memory read acknowledge signal from data reader [ms]
+    bool               broadcast_notify; //!< notify all subscribers with one shared wake up instead of one event per subscriber (linux only)
+    SMemFileMapOptions map_options;      //!< os specific mapping options (pre-faulting, locking, huge pages, NUMA binding)
+    Util::CLatencyHistogram* lock_latency; //!< optional histogram recording the write access wait time
   };
 
   class CSyncMemoryFile
@@ -55,6 +61,23 @@ namespace eCAL
     bool CheckSize(size_t size_);
     bool Write(CPayloadWriter& payload_, const SWriterAttr& data_, bool force_full_write_ = false);
 
+    // signal content written with a deferred sync, the acknowledges are awaited separately,
+    // so the waits of several memory files signaled in a row overlap
+    void SignalPendingContent();
+    void WaitForAcknowledges();
+
+    // loaned write, the caller fills the payload between Loan and Commit without holding the memory file lock
+    char* Loan(size_t len_);
+    bool Commit(const SWriterAttr& data_);
+
+    const char* GetWrittenPayload(size_t len_) const;
+
+    // content held by subscribers must not be overwritten, a held memory file can be renewed
+    // (subscribers keep the old one mapped until they release their samples)
+    bool IsHeld() const;
+    bool IsHeldBy(std::uint32_t process_id_) const;
+    bool Renew();
+
     std::string GetName() const;
     size_t GetSize() const;
     bool IsCreated() const { return m_created; };
@@ -64,7 +87,12 @@ namespace eCAL
     bool Destroy();
     bool Recreate(size_t size_);
 
+    bool WriteContent(CPayloadWriter* payload_, const SWriterAttr& data_, bool force_full_write_);
     void SyncContent();
+    void SignalContent();
+    void SignalContentBroadcast();
+    void WaitForAcknowledgesBroadcast();
+    long TimeToAckDeadlineMs() const;
     void DisconnectAll();
 
     std::string         m_base_name;
@@ -72,12 +100,20 @@ namespace eCAL
     CMemoryFile         m_memfile;
     SSyncMemoryFileAttr m_attr;
     bool                m_created;
+    bool                m_sync_pending = false;
+    bool                m_loan_written = false;
+
+    std::chrono::steady_clock::time_point m_ack_deadline;
+    bool                m_broadcast_ack_pending = false;
+    std::uint32_t       m_broadcast_ack_seq     = 0;
+    std::uint32_t       m_broadcast_ack_count   = 0;
 
     struct SEventHandlePair
     {
       EventHandleT event_snd;
       EventHandleT event_ack;
       bool         event_ack_is_invalid = false;    //!< The ack event has timeouted. Thus, we don't wait for it anymore, until the subscriber notifies us via registration layer that it is still alive.
+      bool         event_ack_is_pending = false;    //!< The sync event was sent, the ack event was not awaited yet.
     };
     using EventHandleMapT = std::unordered_map<std::string, SEventHandlePair>;
     std::mutex       m_event_handle_map_sync;
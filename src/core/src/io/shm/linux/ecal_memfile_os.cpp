@@ -23,16 +23,88 @@
 
 #include "io/shm/ecal_memfile.h"
 
+#include <atomic>
+#include <climits>
 #include <iostream>
 #include <string.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
 
+#ifdef __linux__
+#include <sys/vfs.h>
+#include <linux/futex.h>
+#endif
+
+namespace
+{
+  // hugetlbfs backed files are created in the hugetlbfs mount instead of /dev/shm
+  bool UseHugetlbfs(const eCAL::SMemFileInfo& mem_file_info_)
+  {
+    return (mem_file_info_.options.huge_pages == 2) && !mem_file_info_.options.hugetlbfs_path.empty();
+  }
+
+  std::string HugetlbfsFilePath(const eCAL::SMemFileInfo& mem_file_info_)
+  {
+    return mem_file_info_.options.hugetlbfs_path + mem_file_info_.name;
+  }
+
+  size_t GetPageSize(const eCAL::SMemFileInfo& mem_file_info_)
+  {
+#ifdef __linux__
+    if (UseHugetlbfs(mem_file_info_))
+    {
+      // the block size of a hugetlbfs mount is its huge page size
+      struct statfs fs_info = {};
+      if ((::fstatfs(mem_file_info_.memfile, &fs_info) == 0) && (fs_info.f_bsize > 0))
+      {
+        return static_cast<size_t>(fs_info.f_bsize);
+      }
+    }
+#else
+    (void)mem_file_info_;
+#endif
+    return static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+  }
+
+  bool BindToNumaNode(void* address_, size_t len_, int numa_node_)
+  {
+#if defined(__linux__) && defined(SYS_mbind)
+    const int mpol_bind = 2; // MPOL_BIND from numaif.h, we do not want to depend on libnuma
+    unsigned long node_mask = 1UL << numa_node_;
+    if ((numa_node_ >= static_cast<int>(sizeof(node_mask) * 8))
+      || (::syscall(SYS_mbind, address_, len_, mpol_bind, &node_mask, sizeof(node_mask) * 8 + 1, 0) != 0))
+    {
+      std::cerr << "mbind failed to bind memory file to NUMA node " << numa_node_ << " (memfile::os::MapFile) errno: " << strerror(errno) << std::endl;
+      return(false);
+    }
+    return(true);
+#else
+    (void)address_;
+    (void)len_;
+    (void)numa_node_;
+    return(false);
+#endif
+  }
+
+  void PrefaultPages(const void* address_, size_t len_)
+  {
+    // touch every page, so the first access after (re)creation does not fault
+    const volatile char* pages = static_cast<const volatile char*>(address_);
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+    for (size_t offset = 0; offset < len_; offset += page_size)
+    {
+      (void)pages[offset];
+    }
+  }
+}
+
 namespace eCAL
 {
   namespace memfile
@@ -44,17 +116,32 @@ namespace eCAL
       {
         int previous_umask = umask(000);  // set umask to nothing, so we can create files with all possible permission bits
         mem_file_info_.name = name_.size() ? ((name_[0] != '/') ? "/" + name_ : name_) : name_; // make memory file path compatible for all posix systems
+        // regular files in the hugetlbfs mount or posix shared memory objects
+        const bool        hugetlbfs = UseHugetlbfs(mem_file_info_);
+        const std::string file_path = hugetlbfs ? HugetlbfsFilePath(mem_file_info_) : mem_file_info_.name;
+        auto open_file = [hugetlbfs, &file_path](int flags_)
+        {
+          const mode_t mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+          return hugetlbfs ? ::open(file_path.c_str(), flags_, mode) : ::shm_open(file_path.c_str(), flags_, mode);
+        };
         if(create_)
         {
-          mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), O_CREAT | O_RDWR | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+          mem_file_info_.memfile = open_file(O_CREAT | O_RDWR | O_EXCL);
           if(mem_file_info_.memfile == -1 && errno == EEXIST)
           {
             mem_file_info_.exists = true;
-            mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+            mem_file_info_.memfile = open_file(O_RDWR);
           }
         }
         else {
-          mem_file_info_.memfile = ::shm_open(mem_file_info_.name.c_str(), O_RDONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+          // readers update the hold and acknowledge words of the header,
+          // without write permission they fall back to read only access
+          mem_file_info_.memfile = open_file(O_RDWR);
+          if (mem_file_info_.memfile == -1)
+          {
+            mem_file_info_.memfile   = open_file(O_RDONLY);
+            mem_file_info_.read_only = true;
+          }
           mem_file_info_.exists = true;
         }
         umask(previous_umask);            // reset umask to previous permissions
@@ -95,7 +182,8 @@ namespace eCAL
 
       bool RemoveFile(const SMemFileInfo& mem_file_info_)
       {
-        ::shm_unlink(mem_file_info_.name.c_str());
+        if (UseHugetlbfs(mem_file_info_)) ::unlink(HugetlbfsFilePath(mem_file_info_).c_str());
+        else                              ::shm_unlink(mem_file_info_.name.c_str());
         return(true);
       }
 
@@ -114,15 +202,58 @@ namespace eCAL
 
           // get address
           int         prot = PROT_READ;
-          if (create_) prot |= PROT_WRITE;
+          if (create_ || !mem_file_info_.read_only) prot |= PROT_WRITE;
+
+          // pages can only be pre-faulted by mmap if their placement does not need to be advised before
+          const SMemFileMapOptions& options = mem_file_info_.options;
+          const bool advise_pages = (options.huge_pages == 1) || (create_ && (options.numa_node >= 0));
+          int        flags = MAP_SHARED;
+#ifdef __linux__
+          if (options.populate && !advise_pages) flags |= MAP_POPULATE;
+          const bool prefault = options.populate && advise_pages;
+#else
+          // no MAP_POPULATE outside linux, the pages are touched after mapping instead
+          const bool prefault = options.populate;
+#endif
 
-          mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, MAP_SHARED, mem_file_info_.memfile, 0);
+          mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, flags, mem_file_info_.memfile, 0);
           if (mem_file_info_.mem_address == MAP_FAILED)
           {
             mem_file_info_.mem_address = nullptr;
             std::cerr << "mmap failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
             return(false);
           }
+
+#ifdef __linux__
+          // transparent huge pages (needs /sys/kernel/mm/transparent_hugepage/shmem_enabled = advise)
+          if (options.huge_pages == 1)
+          {
+            if (::madvise(mem_file_info_.mem_address, mem_file_info_.size, MADV_HUGEPAGE) != 0)
+            {
+              std::cerr << "madvise failed to enable transparent huge pages (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+            }
+          }
+#endif
+
+          // the writer decides on the page placement
+          if (create_ && (options.numa_node >= 0))
+          {
+            BindToNumaNode(mem_file_info_.mem_address, mem_file_info_.size, options.numa_node);
+          }
+
+          if (prefault)
+          {
+            PrefaultPages(mem_file_info_.mem_address, mem_file_info_.size);
+          }
+
+          // lock pages into RAM (limited by RLIMIT_MEMLOCK for unprivileged processes)
+          if (options.lock)
+          {
+            if (::mlock(mem_file_info_.mem_address, mem_file_info_.size) != 0)
+            {
+              std::cerr << "mlock failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+            }
+          }
         }
 
         return(true);
@@ -144,10 +275,16 @@ namespace eCAL
       {
         if (mem_file_info_.memfile == 0) return(false);
 
+        const size_t page_size = GetPageSize(mem_file_info_);
         size_t len = len_;
-        if (len < (size_t)sysconf(_SC_PAGE_SIZE))
+        if (len < page_size)
+        {
+          len = page_size;
+        }
+        // hugetlbfs files can only be truncated and mapped in multiples of the huge page size
+        if (UseHugetlbfs(mem_file_info_))
         {
-          len = sysconf(_SC_PAGE_SIZE);
+          len = ((len + page_size - 1) / page_size) * page_size;
         }
 
         if (mem_file_info_.mem_address == nullptr)
@@ -182,6 +319,42 @@ namespace eCAL
 
         return(true);
       }
+
+      bool SupportsWordWait()
+      {
+#if defined(__linux__) && defined(SYS_futex)
+        return(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+#else
+        return(false);
+#endif
+      }
+
+      bool WaitOnWord(const std::atomic<uint32_t>* word_, uint32_t expected_, int64_t timeout_ms_)
+      {
+#if defined(__linux__) && defined(SYS_futex)
+        // no FUTEX_PRIVATE_FLAG, the word is shared between processes
+        struct timespec timeout = {};
+        timeout.tv_sec  = static_cast<time_t>(timeout_ms_ / 1000);
+        timeout.tv_nsec = static_cast<long>((timeout_ms_ % 1000) * 1000000);
+        const long ret = ::syscall(SYS_futex, reinterpret_cast<const uint32_t*>(word_), FUTEX_WAIT, expected_, (timeout_ms_ < 0) ? nullptr : &timeout, nullptr, 0);
+        // woken up, value already changed (EAGAIN) or interrupted (EINTR), the caller checks the word again
+        return((ret == 0) || (errno != ETIMEDOUT));
+#else
+        (void)word_;
+        (void)expected_;
+        (void)timeout_ms_;
+        return(false);
+#endif
+      }
+
+      void WakeAllOnWord(std::atomic<uint32_t>* word_)
+      {
+#if defined(__linux__) && defined(SYS_futex)
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word_), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+        (void)word_;
+#endif
+      }
     }
   }
 }
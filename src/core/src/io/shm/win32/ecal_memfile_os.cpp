@@ -23,6 +23,9 @@
 
 #include "io/shm/ecal_memfile.h"
 
+#include <atomic>
+#include <cstdint>
+
 namespace eCAL
 {
   namespace memfile
@@ -48,19 +51,12 @@ namespace eCAL
         return(true);
       }
 
-      bool MapFile(const bool create_, SMemFileInfo& mem_file_info_)
+      bool MapFile(const bool /*create_*/, SMemFileInfo& mem_file_info_)
       {
         if (mem_file_info_.map_region == nullptr)
         {
-          DWORD flProtect = 0;
-          if (create_)
-          {
-            flProtect = PAGE_READWRITE;
-          }
-          else
-          {
-            flProtect = PAGE_READONLY;
-          }
+          // readers update the hold and acknowledge words of the header as well
+          const DWORD flProtect = PAGE_READWRITE;
           mem_file_info_.map_region = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, flProtect, 0, (DWORD)mem_file_info_.size, mem_file_info_.name.c_str());
           if (mem_file_info_.map_region == NULL) return(false);
           if (GetLastError() == ERROR_ALREADY_EXISTS) mem_file_info_.exists = true;
@@ -68,15 +64,7 @@ namespace eCAL
 
         if (mem_file_info_.mem_address == nullptr)
         {
-          DWORD dwDesiredAccess = 0;
-          if (create_)
-          {
-            dwDesiredAccess = FILE_MAP_ALL_ACCESS;
-          }
-          else
-          {
-            dwDesiredAccess = FILE_MAP_READ;
-          }
+          const DWORD dwDesiredAccess = FILE_MAP_ALL_ACCESS;
           mem_file_info_.mem_address = (LPTSTR)MapViewOfFile(mem_file_info_.map_region,    // handle to map object
             dwDesiredAccess,                                                               // read/write permission
             0,
@@ -129,6 +117,21 @@ namespace eCAL
 
         return(mem_file_info_.mem_address != nullptr);
       }
+
+      bool SupportsWordWait()
+      {
+        // the subscribers are notified by named events
+        return(false);
+      }
+
+      bool WaitOnWord(const std::atomic<uint32_t>* /*word_*/, uint32_t /*expected_*/, int64_t /*timeout_ms_*/)
+      {
+        return(false);
+      }
+
+      void WakeAllOnWord(std::atomic<uint32_t>* /*word_*/)
+      {
+      }
     }
   }
 }
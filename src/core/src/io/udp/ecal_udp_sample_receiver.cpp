@@ -52,7 +52,7 @@ namespace eCAL
       if (m_sample_receiver->m_has_sample_callback(sample_name))
       {
         // apply sample
-        m_sample_receiver->m_apply_sample_callback(msg_buffer_.data() + sizeof(sample_name_size) + sample_name_size, static_cast<int>(msg_buffer_.size() - (sizeof(sample_name_size) + sample_name_size)));
+        m_sample_receiver->m_apply_sample_callback(sample_name, msg_buffer_.data() + sizeof(sample_name_size) + sample_name_size, static_cast<int>(msg_buffer_.size() - (sizeof(sample_name_size) + sample_name_size)));
       }
 
       return(0);
@@ -178,7 +178,7 @@ namespace eCAL
         if (m_has_sample_callback(sample_name))
         {
           // apply sample
-          m_apply_sample_callback(ecal_message->payload + static_cast<size_t>(sizeof(sample_name_size) + sample_name_size), static_cast<int>(static_cast<size_t>(ecal_message->header.len) - (sizeof(sample_name_size) + sample_name_size)));
+          m_apply_sample_callback(sample_name, ecal_message->payload + static_cast<size_t>(sizeof(sample_name_size) + sample_name_size), static_cast<int>(static_cast<size_t>(ecal_message->header.len) - (sizeof(sample_name_size) + sample_name_size)));
         }
       }
       break;
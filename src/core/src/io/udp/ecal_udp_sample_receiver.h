@@ -42,7 +42,7 @@ namespace eCAL
     {
     public:
       using HasSampleCallbackT   = std::function<bool(const std::string& sample_name_)>;
-      using ApplySampleCallbackT = std::function<void(const char* serialized_sample_data_, size_t serialized_sample_size_)>;
+      using ApplySampleCallbackT = std::function<void(const std::string& sample_name_, const char* serialized_sample_data_, size_t serialized_sample_size_)>;
 
       CSampleReceiver(const IO::UDP::SReceiverAttr& attr_, HasSampleCallbackT has_sample_callback_, ApplySampleCallbackT apply_sample_callback_);
       virtual ~CSampleReceiver();
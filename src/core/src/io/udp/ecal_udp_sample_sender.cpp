@@ -25,6 +25,8 @@
 #include "io/udp/fragmentation/snd_fragments.h"
 
 #include <iostream>
+#include <map>
+#include <tuple>
 
 namespace
 {
@@ -32,15 +34,57 @@ namespace
   {
     return (sample_sender_->Send(buf_, len_, mcast_address_.c_str()));
   }
+
+  // sockets are shared process wide by all sample senders with the same socket options,
+  // the destination group is passed explicitly with every send
+  struct SUDPSenderKey
+  {
+    int  port;
+    int  ttl;
+    bool broadcast;
+    bool loopback;
+    int  sndbuf;
+
+    bool operator<(const SUDPSenderKey& rhs) const
+    {
+      return std::tie(port, ttl, broadcast, loopback, sndbuf) < std::tie(rhs.port, rhs.ttl, rhs.broadcast, rhs.loopback, rhs.sndbuf);
+    }
+  };
+
+  std::shared_ptr<IO::UDP::CUDPSender> GetSharedUDPSender(const IO::UDP::SSenderAttr& attr_)
+  {
+    static std::mutex                                                   sender_pool_mtx;
+    static std::map<SUDPSenderKey, std::weak_ptr<IO::UDP::CUDPSender>> sender_pool;
+
+    const std::lock_guard<std::mutex> lock(sender_pool_mtx);
+
+    // drop sockets not used by any sample sender anymore
+    for (auto iter = sender_pool.begin(); iter != sender_pool.end();)
+    {
+      if (iter->second.expired()) iter = sender_pool.erase(iter);
+      else                        ++iter;
+    }
+
+    const SUDPSenderKey key{ attr_.port, attr_.ttl, attr_.broadcast, attr_.loopback, attr_.sndbuf };
+    auto& pool_entry = sender_pool[key];
+    std::shared_ptr<IO::UDP::CUDPSender> udp_sender = pool_entry.lock();
+    if (!udp_sender)
+    {
+      udp_sender = std::make_shared<IO::UDP::CUDPSender>(attr_);
+      pool_entry = udp_sender;
+    }
+    return udp_sender;
+  }
 }
 
 namespace eCAL
 {
   namespace UDP
   {
-    CSampleSender::CSampleSender(const IO::UDP::SSenderAttr& attr_)
+    CSampleSender::CSampleSender(const IO::UDP::SSenderAttr& attr_) :
+      m_attr(attr_)
     {
-      m_udp_sender = std::make_shared<IO::UDP::CUDPSender>(attr_);
+      m_udp_sender = GetSharedUDPSender(attr_);
     }
 
     size_t CSampleSender::Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
@@ -26,6 +26,10 @@
 #include "linux/socket_os.h"
 #endif
 
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
 #include <iostream>
 
 namespace IO
@@ -98,6 +102,17 @@ namespace IO
         }
       }
 
+      // switch to non blocking mode, receive waits with poll
+      {
+        asio::error_code ec;
+        m_socket.non_blocking(true, ec);
+        if (ec)
+        {
+          std::cerr << "CUDPReceiverAsio: Unable to set non blocking mode: " << ec.message() << std::endl;
+          return;
+        }
+      }
+
       // join multicast group
       AddMultiCastGroup(attr_.address.c_str());
 
@@ -174,18 +189,17 @@ namespace IO
     {
       if (!m_created) return 0;
 
-      size_t reclen(0);
-      m_socket.async_receive_from(asio::buffer(buf_, len_), m_sender_endpoint,
-        [&reclen](std::error_code ec, std::size_t length)
-        {
-          if (!ec)
-          {
-            reclen = length;
-          }
-        });
-
-      // run for timeout ms
-      RunIOContext(asio::chrono::milliseconds(timeout_));
+      // the socket is non blocking, so already queued datagrams are read
+      // without any wait and the io_context is not needed at all
+      asio::error_code ec;
+      size_t reclen = m_socket.receive_from(asio::buffer(buf_, len_), m_sender_endpoint, 0, ec);
+      if (ec == asio::error::would_block)
+      {
+        // wait for timeout ms and try again
+        if (!WaitForData(timeout_)) return(0);
+        reclen = m_socket.receive_from(asio::buffer(buf_, len_), m_sender_endpoint, 0, ec);
+      }
+      if (ec) return(0);
 
       // retrieve underlying raw socket information
       if (address_ != nullptr)
@@ -207,23 +221,19 @@ namespace IO
       return (reclen);
     }
 
-    void CUDPReceiverAsio::RunIOContext(const asio::chrono::steady_clock::duration& timeout)
+    bool CUDPReceiverAsio::WaitForData(int timeout_)
     {
-      // restart the io_context, as it may have been left in the "stopped" state by a previous operation
-      m_iocontext.restart();
-
-      // block until the asynchronous operation has completed, or timed out
-      m_iocontext.run_for(timeout);
-
-      // stop the context if even the operation was not successful completed
-      if (!m_iocontext.stopped())
-      {
-        // cancel the outstanding asynchronous operation
-        m_socket.cancel();
-
-        // run the io_context again until the operation completes
-        m_iocontext.run();
-      }
+#ifdef _WIN32
+      WSAPOLLFD poll_fd{};
+      poll_fd.fd     = m_socket.native_handle();
+      poll_fd.events = POLLRDNORM;
+      return(WSAPoll(&poll_fd, 1, timeout_) > 0);
+#else
+      pollfd poll_fd{};
+      poll_fd.fd     = m_socket.native_handle();
+      poll_fd.events = POLLIN;
+      return(::poll(&poll_fd, 1, timeout_) > 0);
+#endif
     }
   }
 }
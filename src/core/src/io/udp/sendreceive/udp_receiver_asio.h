@@ -48,7 +48,7 @@ namespace IO
       size_t Receive(char* buf_, size_t len_, int timeout_, ::sockaddr_in* address_) override;
 
     protected:
-      void RunIOContext(const asio::chrono::steady_clock::duration& timeout);
+      bool WaitForData(int timeout_);
 
       bool                    m_created;
       bool                    m_broadcast;
@@ -102,6 +102,8 @@ namespace IO
 
     size_t CUDPSenderImpl::Send(const void* buf_, const size_t len_, const char* ipaddr_)
     {
+      // a synchronous send_to is a single sendto call on the socket,
+      // so one sender can be used by multiple threads concurrently
       const asio::socket_base::message_flags flags(0);
       asio::error_code                 ec;
       size_t                           sent(0);
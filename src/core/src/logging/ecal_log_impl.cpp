@@ -160,7 +160,7 @@ namespace eCAL
     attr.rcvbuf    = Config::GetUdpMulticastRcvBufSizeBytes();
 
     // start logging receiver
-    m_log_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CLog::HasSample, this, std::placeholders::_1), std::bind(&CLog::ApplySample, this, std::placeholders::_1, std::placeholders::_2));
+    m_log_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CLog::HasSample, this, std::placeholders::_1), std::bind(&CLog::ApplySample, this, std::placeholders::_2, std::placeholders::_3));
 
     m_created = true;
   }
@@ -74,6 +74,16 @@ namespace eCAL
     m_monitoring_impl->GetMonitoring(monitoring_, entities_);
   }
 
+  std::shared_ptr<const Monitoring::SMonitoringSnapshot> CMonitoring::GetMonitoringSnapshot()
+  {
+    return m_monitoring_impl->GetMonitoringSnapshot();
+  }
+
+  void CMonitoring::GetMonitoringDelta(uint64_t since_version_, Monitoring::SMonitoringDelta& delta_, unsigned int entities_)
+  {
+    m_monitoring_impl->GetMonitoringDelta(since_version_, delta_, entities_);
+  }
+
   namespace Monitoring
   {
     ////////////////////////////////////////////////////////
@@ -113,5 +123,26 @@ namespace eCAL
       }
       return(0);
     }
+
+    std::shared_ptr<const SMonitoringSnapshot> GetMonitoringSnapshot()
+    {
+      if (g_monitoring() != nullptr) return(g_monitoring()->GetMonitoringSnapshot());
+      return(nullptr);
+    }
+
+    int GetMonitoringDelta(uint64_t since_version_, SMonitoringDelta& delta_, unsigned int entities_)
+    {
+      delta_ = SMonitoringDelta();
+      if (g_monitoring() != nullptr)
+      {
+        g_monitoring()->GetMonitoringDelta(since_version_, delta_, entities_);
+        const auto count = [](const SMonitoringEntities& set_)
+        {
+          return(set_.processes.size() + set_.publisher.size() + set_.subscriber.size() + set_.server.size() + set_.clients.size());
+        };
+        return(static_cast<int>(count(delta_.changed) + count(delta_.removed)));
+      }
+      return(0);
+    }
   }
 }
@@ -25,6 +25,7 @@
 
 #include <ecal/types/monitoring.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -50,6 +51,9 @@ namespace eCAL
     void GetMonitoring(std::string& monitoring_, unsigned int entities_ = Monitoring::Entity::All);
     void GetMonitoring(eCAL::Monitoring::SMonitoring& monitoring_, unsigned int entities_ = Monitoring::Entity::All);
 
+    std::shared_ptr<const Monitoring::SMonitoringSnapshot> GetMonitoringSnapshot();
+    void GetMonitoringDelta(uint64_t since_version_, Monitoring::SMonitoringDelta& delta_, unsigned int entities_ = Monitoring::Entity::All);
+
   protected:
     std::unique_ptr<CMonitoringImpl> m_monitoring_impl;
 
@@ -28,11 +28,99 @@
 #include "config/ecal_config_reader_hlp.h"
 #include "ecal_monitoring_impl.h"
 
+#include <algorithm>
+#include <list>
 #include <regex>
+#include <tuple>
 
 #include "registration/ecal_registration_receiver.h"
 #include "serialization/ecal_serialize_monitoring.h"
 
+namespace
+{
+  eCAL::Monitoring::SLatencyMon LatencyMonFromHistogram(const eCAL::Registration::LatencyHistogram& histogram_)
+  {
+    eCAL::Monitoring::SLatencyMon latency;
+    latency.count = histogram_.count;
+    latency.min   = histogram_.min;
+    latency.max   = histogram_.max;
+    latency.mean  = histogram_.mean;
+    latency.p50   = histogram_.p50;
+    latency.p90   = histogram_.p90;
+    latency.p99   = histogram_.p99;
+    latency.p999  = histogram_.p999;
+    return latency;
+  }
+
+  // content comparison of the monitoring entities, the registration clock (heart beat) is ignored
+  bool EqualContent(const eCAL::Monitoring::SLatencyMon& l_, const eCAL::Monitoring::SLatencyMon& r_)
+  {
+    return std::tie(l_.count, l_.min, l_.max, l_.mean, l_.p50, l_.p90, l_.p99, l_.p999)
+        == std::tie(r_.count, r_.min, r_.max, r_.mean, r_.p50, r_.p90, r_.p99, r_.p999);
+  }
+
+  bool EqualContent(const eCAL::Monitoring::TLayer& l_, const eCAL::Monitoring::TLayer& r_)
+  {
+    return std::tie(l_.type, l_.version, l_.confirmed, l_.queue_depth, l_.queue_max_depth, l_.queue_drops)
+        == std::tie(r_.type, r_.version, r_.confirmed, r_.queue_depth, r_.queue_max_depth, r_.queue_drops);
+  }
+
+  bool EqualContent(const eCAL::Monitoring::SMethodMon& l_, const eCAL::Monitoring::SMethodMon& r_)
+  {
+    return std::tie(l_.mname, l_.req_type, l_.req_desc, l_.resp_type, l_.resp_desc, l_.call_count)
+        == std::tie(r_.mname, r_.req_type, r_.req_desc, r_.resp_type, r_.resp_desc, r_.call_count);
+  }
+
+  template <typename T>
+  bool EqualContent(const std::vector<T>& l_, const std::vector<T>& r_)
+  {
+    return std::equal(l_.begin(), l_.end(), r_.begin(), r_.end(), [](const T& l, const T& r) { return EqualContent(l, r); });
+  }
+
+  bool EqualContent(const eCAL::Monitoring::STopicMon& l_, const eCAL::Monitoring::STopicMon& r_)
+  {
+    return std::tie(l_.hname, l_.hgname, l_.pid, l_.pname, l_.uname, l_.tid, l_.tname, l_.direction, l_.tdatatype, l_.tsize,
+                    l_.connections_loc, l_.connections_ext, l_.message_drops, l_.did, l_.dclock, l_.dfreq, l_.attr)
+        == std::tie(r_.hname, r_.hgname, r_.pid, r_.pname, r_.uname, r_.tid, r_.tname, r_.direction, r_.tdatatype, r_.tsize,
+                    r_.connections_loc, r_.connections_ext, r_.message_drops, r_.did, r_.dclock, r_.dfreq, r_.attr)
+        && EqualContent(l_.tlayer, r_.tlayer)
+        && EqualContent(l_.latency.delivery, r_.latency.delivery)
+        && EqualContent(l_.latency.callback, r_.latency.callback)
+        && EqualContent(l_.latency.shm_lock, r_.latency.shm_lock);
+  }
+
+  bool EqualContent(const eCAL::Monitoring::SProcessMon& l_, const eCAL::Monitoring::SProcessMon& r_)
+  {
+    return std::tie(l_.hname, l_.hgname, l_.pid, l_.pname, l_.uname, l_.pparam, l_.datawrite, l_.dataread, l_.state_severity, l_.state_severity_level,
+                    l_.state_info, l_.tsync_state, l_.tsync_mod_name, l_.component_init_state, l_.component_init_info, l_.ecal_runtime_version)
+        == std::tie(r_.hname, r_.hgname, r_.pid, r_.pname, r_.uname, r_.pparam, r_.datawrite, r_.dataread, r_.state_severity, r_.state_severity_level,
+                    r_.state_info, r_.tsync_state, r_.tsync_mod_name, r_.component_init_state, r_.component_init_info, r_.ecal_runtime_version);
+  }
+
+  bool EqualContent(const eCAL::Monitoring::SServerMon& l_, const eCAL::Monitoring::SServerMon& r_)
+  {
+    return std::tie(l_.hname, l_.pname, l_.uname, l_.pid, l_.sname, l_.sid, l_.tcp_port_v0, l_.tcp_port_v1)
+        == std::tie(r_.hname, r_.pname, r_.uname, r_.pid, r_.sname, r_.sid, r_.tcp_port_v0, r_.tcp_port_v1)
+        && EqualContent(l_.methods, r_.methods);
+  }
+
+  bool EqualContent(const eCAL::Monitoring::SClientMon& l_, const eCAL::Monitoring::SClientMon& r_)
+  {
+    return std::tie(l_.hname, l_.pname, l_.uname, l_.pid, l_.sname, l_.sid)
+        == std::tie(r_.hname, r_.pname, r_.uname, r_.pid, r_.sname, r_.sid);
+  }
+
+  void ApplyLayerQueueStatistics(const std::vector<eCAL::Registration::TLayer>& layers_, eCAL::eTLayerType type_, eCAL::Monitoring::TLayer& tlayer_)
+  {
+    for (const auto& layer : layers_)
+    {
+      if (layer.type != type_) continue;
+      tlayer_.queue_depth     = layer.queue_depth;
+      tlayer_.queue_max_depth = layer.queue_max_depth;
+      tlayer_.queue_drops     = layer.queue_drops;
+    }
+  }
+}
 
 namespace eCAL
 {
@@ -45,7 +133,11 @@ namespace eCAL
     m_publisher_map (std::chrono::milliseconds(Config::GetMonitoringTimeoutMs())),
     m_subscriber_map(std::chrono::milliseconds(Config::GetMonitoringTimeoutMs())),
     m_server_map    (std::chrono::milliseconds(Config::GetMonitoringTimeoutMs())),
-    m_clients_map   (std::chrono::milliseconds(Config::GetMonitoringTimeoutMs()))
+    m_clients_map   (std::chrono::milliseconds(Config::GetMonitoringTimeoutMs())),
+    m_registry_version(0),
+    m_refresh_count(0),
+    m_snapshot_refresh_count(0),
+    m_serialized_entities(Monitoring::Entity::None)
   {
   }
 
@@ -272,60 +364,68 @@ namespace eCAL
       std::string topic_datatype_desc     = sample_topic.tdatatype.desc;
       auto attr                           = sample_topic.attr;
 
-      // try to get topic info
-      const std::string topic_name_id  = topic_name + topic_id;
-      Monitoring::STopicMon& TopicInfo = (*pTopicMap->map)[topic_name_id];
-
-      // set static content
-      TopicInfo.hname     = host_name;
-      TopicInfo.hgname    = host_group_name;
-      TopicInfo.pid       = process_id;
-      TopicInfo.pname     = process_name;
-      TopicInfo.uname     = unit_name;
-      TopicInfo.tname     = topic_name;
-      TopicInfo.direction = direction;
-      TopicInfo.tid       = topic_id;
-
-      // update flexible content
-      TopicInfo.rclock++;
-      TopicInfo.tdatatype.encoding   = std::move(topic_datatype_encoding);
-      TopicInfo.tdatatype.name       = std::move(topic_datatype_name);
-      TopicInfo.tdatatype.descriptor = std::move(topic_datatype_desc);
-
-      // attributes
-      TopicInfo.attr = std::map<std::string, std::string>{attr.begin(), attr.end()};
-
-      // layer
-      TopicInfo.tlayer.clear();
-      // tlayer udp_mc
-      {
-        eCAL::Monitoring::TLayer tlayer;
-        tlayer.type      = eCAL::Monitoring::tl_ecal_udp_mc;
-        tlayer.confirmed = topic_tlayer_ecal_udp_mc;
-        TopicInfo.tlayer.push_back(tlayer);
-      }
-      // tlayer shm
-      {
-        eCAL::Monitoring::TLayer tlayer;
-        tlayer.type      = eCAL::Monitoring::tl_ecal_shm;
-        tlayer.confirmed = topic_tlayer_ecal_shm;
-        TopicInfo.tlayer.push_back(tlayer);
-      }
-      // tlayer tcp
+      // update topic info, a pure heart beat is no change
+      const std::string topic_name_id = topic_name + topic_id;
+      UpdateEntry((*pTopicMap->map)[topic_name_id], [&](Monitoring::STopicMon& TopicInfo)
       {
-        eCAL::Monitoring::TLayer tlayer;
-        tlayer.type      = eCAL::Monitoring::tl_ecal_tcp;
-        tlayer.confirmed = topic_tlayer_ecal_tcp;
-        TopicInfo.tlayer.push_back(tlayer);
-      }
+        // set static content
+        TopicInfo.hname     = host_name;
+        TopicInfo.hgname    = host_group_name;
+        TopicInfo.pid       = process_id;
+        TopicInfo.pname     = process_name;
+        TopicInfo.uname     = unit_name;
+        TopicInfo.tname     = topic_name;
+        TopicInfo.direction = direction;
+        TopicInfo.tid       = topic_id;
+
+        // update flexible content
+        TopicInfo.rclock++;
+        TopicInfo.tdatatype.encoding   = std::move(topic_datatype_encoding);
+        TopicInfo.tdatatype.name       = std::move(topic_datatype_name);
+        TopicInfo.tdatatype.descriptor = std::move(topic_datatype_desc);
+
+        // attributes
+        TopicInfo.attr = std::map<std::string, std::string>{attr.begin(), attr.end()};
+
+        // layer
+        TopicInfo.tlayer.clear();
+        // tlayer udp_mc
+        {
+          eCAL::Monitoring::TLayer tlayer;
+          tlayer.type      = eCAL::Monitoring::tl_ecal_udp_mc;
+          tlayer.confirmed = topic_tlayer_ecal_udp_mc;
+          ApplyLayerQueueStatistics(sample_topic.tlayer, tl_ecal_udp_mc, tlayer);
+          TopicInfo.tlayer.push_back(tlayer);
+        }
+        // tlayer shm
+        {
+          eCAL::Monitoring::TLayer tlayer;
+          tlayer.type      = eCAL::Monitoring::tl_ecal_shm;
+          tlayer.confirmed = topic_tlayer_ecal_shm;
+          ApplyLayerQueueStatistics(sample_topic.tlayer, tl_ecal_shm, tlayer);
+          TopicInfo.tlayer.push_back(tlayer);
+        }
+        // tlayer tcp
+        {
+          eCAL::Monitoring::TLayer tlayer;
+          tlayer.type      = eCAL::Monitoring::tl_ecal_tcp;
+          tlayer.confirmed = topic_tlayer_ecal_tcp;
+          ApplyLayerQueueStatistics(sample_topic.tlayer, tl_ecal_tcp, tlayer);
+          TopicInfo.tlayer.push_back(tlayer);
+        }
+
+        TopicInfo.tsize           = static_cast<int>(topic_size);
+        TopicInfo.connections_loc = static_cast<int>(connections_loc);
+        TopicInfo.connections_ext = static_cast<int>(connections_ext);
+        TopicInfo.did             = did;
+        TopicInfo.dclock          = dclock;
+        TopicInfo.message_drops   = message_drops;
+        TopicInfo.dfreq           = dfreq;
 
-      TopicInfo.tsize           = static_cast<int>(topic_size);
-      TopicInfo.connections_loc = static_cast<int>(connections_loc);
-      TopicInfo.connections_ext = static_cast<int>(connections_ext);
-      TopicInfo.did             = did;
-      TopicInfo.dclock          = dclock;
-      TopicInfo.message_drops   = message_drops;
-      TopicInfo.dfreq           = dfreq;
+        TopicInfo.latency.delivery = LatencyMonFromHistogram(sample_topic.latency.delivery);
+        TopicInfo.latency.callback = LatencyMonFromHistogram(sample_topic.latency.callback);
+        TopicInfo.latency.shm_lock = LatencyMonFromHistogram(sample_topic.latency.shm_lock);
+      });
     }
 
     return(true);
@@ -346,7 +446,7 @@ namespace eCAL
 
       // remove topic info
       const std::string topic_name_id = topic_name + topic_id;
-      pTopicMap->map->erase(topic_name_id);
+      RemoveEntry(*pTopicMap, topic_name_id);
     }
 
     return(true);
@@ -379,29 +479,30 @@ namespace eCAL
     // acquire access
     const std::lock_guard<std::mutex> lock(m_process_map.sync);
 
-    // try to get process info
-    Monitoring::SProcessMon& ProcessInfo = (*m_process_map.map)[process_name_id];
-
-    // set static content
-    ProcessInfo.hname  = host_name;
-    ProcessInfo.hgname = host_group_name;
-    ProcessInfo.pname  = process_name;
-    ProcessInfo.uname  = unit_name;
-    ProcessInfo.pid    = process_id;
-    ProcessInfo.pparam = process_param;
-
-    // update flexible content
-    ProcessInfo.rclock++;
-    ProcessInfo.datawrite            = process_datawrite;
-    ProcessInfo.dataread             = process_dataread;
-    ProcessInfo.state_severity       = process_state_severity;
-    ProcessInfo.state_severity_level = process_state_severity_level;
-    ProcessInfo.state_info           = process_state_info;
-    ProcessInfo.tsync_state          = process_tsync_state;
-    ProcessInfo.tsync_mod_name       = process_tsync_mod_name;
-    ProcessInfo.component_init_state = component_init_state;
-    ProcessInfo.component_init_info  = component_init_info;
-    ProcessInfo.ecal_runtime_version = ecal_runtime_version;
+    // update process info, a pure heart beat is no change
+    UpdateEntry((*m_process_map.map)[process_name_id], [&](Monitoring::SProcessMon& ProcessInfo)
+    {
+      // set static content
+      ProcessInfo.hname  = host_name;
+      ProcessInfo.hgname = host_group_name;
+      ProcessInfo.pname  = process_name;
+      ProcessInfo.uname  = unit_name;
+      ProcessInfo.pid    = process_id;
+      ProcessInfo.pparam = process_param;
+
+      // update flexible content
+      ProcessInfo.rclock++;
+      ProcessInfo.datawrite            = process_datawrite;
+      ProcessInfo.dataread             = process_dataread;
+      ProcessInfo.state_severity       = process_state_severity;
+      ProcessInfo.state_severity_level = process_state_severity_level;
+      ProcessInfo.state_info           = process_state_info;
+      ProcessInfo.tsync_state          = process_tsync_state;
+      ProcessInfo.tsync_mod_name       = process_tsync_mod_name;
+      ProcessInfo.component_init_state = component_init_state;
+      ProcessInfo.component_init_info  = component_init_info;
+      ProcessInfo.ecal_runtime_version = ecal_runtime_version;
+    });
 
     return(true);
   }
@@ -419,7 +520,7 @@ namespace eCAL
     const std::lock_guard<std::mutex> lock(m_process_map.sync);
 
     // remove process info
-    m_process_map.map->erase(process_name_id);
+    RemoveEntry(m_process_map, process_name_id);
 
     return(true);
   }
@@ -442,34 +543,35 @@ namespace eCAL
     // acquire access
     const std::lock_guard<std::mutex> lock(m_server_map.sync);
 
-    // try to get service info
-    Monitoring::SServerMon& ServerInfo = (*m_server_map.map)[service_name_id];
-
-    // set static content
-    ServerInfo.hname       = host_name;
-    ServerInfo.sname       = service_name;
-    ServerInfo.sid         = service_id;
-    ServerInfo.pname       = process_name;
-    ServerInfo.uname       = unit_name;
-    ServerInfo.pid         = process_id;
-    ServerInfo.tcp_port_v0 = tcp_port_v0;
-    ServerInfo.tcp_port_v1 = tcp_port_v1;
-
-    // update flexible content
-    ServerInfo.rclock++;
-    ServerInfo.methods.clear();
-    for (int i = 0; i < sample_.service.methods.size(); ++i)
-    {
-      struct Monitoring::SMethodMon method;
-      auto sample_service_methods = sample_.service.methods[i];
-      method.mname      = sample_service_methods.mname;
-      method.req_type   = sample_service_methods.req_type;
-      method.req_desc   = sample_service_methods.req_desc;
-      method.resp_type  = sample_service_methods.resp_type;
-      method.resp_desc  = sample_service_methods.resp_desc;
-      method.call_count = sample_service_methods.call_count;
-      ServerInfo.methods.push_back(method);
-    }
+    // update service info, a pure heart beat is no change
+    UpdateEntry((*m_server_map.map)[service_name_id], [&](Monitoring::SServerMon& ServerInfo)
+    {
+      // set static content
+      ServerInfo.hname       = host_name;
+      ServerInfo.sname       = service_name;
+      ServerInfo.sid         = service_id;
+      ServerInfo.pname       = process_name;
+      ServerInfo.uname       = unit_name;
+      ServerInfo.pid         = process_id;
+      ServerInfo.tcp_port_v0 = tcp_port_v0;
+      ServerInfo.tcp_port_v1 = tcp_port_v1;
+
+      // update flexible content
+      ServerInfo.rclock++;
+      ServerInfo.methods.clear();
+      for (int i = 0; i < sample_.service.methods.size(); ++i)
+      {
+        struct Monitoring::SMethodMon method;
+        auto sample_service_methods = sample_.service.methods[i];
+        method.mname      = sample_service_methods.mname;
+        method.req_type   = sample_service_methods.req_type;
+        method.req_desc   = sample_service_methods.req_desc;
+        method.resp_type  = sample_service_methods.resp_type;
+        method.resp_desc  = sample_service_methods.resp_desc;
+        method.call_count = sample_service_methods.call_count;
+        ServerInfo.methods.push_back(method);
+      }
+    });
 
     return(true);
   }
@@ -488,7 +590,7 @@ namespace eCAL
     const std::lock_guard<std::mutex> lock(m_server_map.sync);
 
     // remove service info
-    m_server_map.map->erase(service_name_id);
+    RemoveEntry(m_server_map, service_name_id);
 
     return(true);
   }
@@ -509,19 +611,20 @@ namespace eCAL
     // acquire access
     const std::lock_guard<std::mutex> lock(m_clients_map.sync);
 
-    // try to get service info
-    Monitoring::SClientMon& ClientInfo = (*m_clients_map.map)[service_name_id];
-
-    // set static content
-    ClientInfo.hname = host_name;
-    ClientInfo.sname = service_name;
-    ClientInfo.sid   = service_id;
-    ClientInfo.pname = process_name;
-    ClientInfo.uname = unit_name;
-    ClientInfo.pid   = process_id;
+    // update service info, a pure heart beat is no change
+    UpdateEntry((*m_clients_map.map)[service_name_id], [&](Monitoring::SClientMon& ClientInfo)
+    {
+      // set static content
+      ClientInfo.hname = host_name;
+      ClientInfo.sname = service_name;
+      ClientInfo.sid   = service_id;
+      ClientInfo.pname = process_name;
+      ClientInfo.uname = unit_name;
+      ClientInfo.pid   = process_id;
 
-    // update flexible content
-    ClientInfo.rclock++;
+      // update flexible content
+      ClientInfo.rclock++;
+    });
 
     return(true);
   }
@@ -540,7 +643,7 @@ namespace eCAL
     const std::lock_guard<std::mutex> lock(m_clients_map.sync);
 
     // remove service info
-    m_clients_map.map->erase(service_name_id);
+    RemoveEntry(m_clients_map, service_name_id);
 
     return(true);
   }
@@ -562,195 +665,264 @@ namespace eCAL
 
   void CMonitoringImpl::GetMonitoring(std::string& monitoring_, unsigned int entities_)
   {
-    // create monitoring struct
-    Monitoring::SMonitoring monitoring;
-
-    if ((entities_ & Monitoring::Entity::Process) != 0u)
-    {
-      MonitorProcs(monitoring);
-    }
-
-    if ((entities_ & Monitoring::Entity::Publisher) != 0u)
-    {
-      MonitorTopics(m_publisher_map, monitoring, "publisher");
-    }
-
-    if ((entities_ & Monitoring::Entity::Subscriber) != 0u)
-    {
-      MonitorTopics(m_subscriber_map, monitoring, "subscriber");
-    }
+    const auto snapshot = GetMonitoringSnapshot();
 
-    if ((entities_ & Monitoring::Entity::Server) != 0u)
+    // reuse the last serialization if nothing changed in between
     {
-      MonitorServer(monitoring);
+      const std::lock_guard<std::mutex> lock(m_serialized_mtx);
+      if ((m_serialized_snapshot == snapshot) && (m_serialized_entities == entities_))
+      {
+        monitoring_ = m_serialized;
+        return;
+      }
     }
 
-    if ((entities_ & Monitoring::Entity::Client) != 0u)
-    {
-      MonitorClients(monitoring);
-    }
+    // create monitoring struct
+    Monitoring::SMonitoring monitoring;
+    GetMonitoring(monitoring, entities_);
 
     // serialize struct to target string
     SerializeToBuffer(monitoring, monitoring_);
+
+    const std::lock_guard<std::mutex> lock(m_serialized_mtx);
+    m_serialized_snapshot = snapshot;
+    m_serialized_entities = entities_;
+    m_serialized          = monitoring_;
   }
 
   void CMonitoringImpl::GetMonitoring(Monitoring::SMonitoring& monitoring_, unsigned int entities_)
   {
+    // copy the entities out of the snapshot, the registry is not locked here
+    const auto snapshot = GetMonitoringSnapshot();
+    const auto& entities = snapshot->entities;
+
     if ((entities_ & Monitoring::Entity::Process) != 0u)
     {
-      // clear target
       monitoring_.processes.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_process_map.sync);
-
-      // reserve target
-      monitoring_.processes.reserve(m_process_map.map->size());
-
-      // iterate map
-      m_process_map.map->remove_deprecated();
-      for (const auto& process : (*m_process_map.map))
+      monitoring_.processes.reserve(entities.processes.size());
+      for (const auto& process : entities.processes)
       {
-        monitoring_.processes.emplace_back(process.second);
+        monitoring_.processes.emplace_back(*process);
       }
     }
 
     if ((entities_ & Monitoring::Entity::Publisher) != 0u)
     {
-      // clear target
       monitoring_.publisher.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_publisher_map.sync);
-
-      // reserve target
-      monitoring_.publisher.reserve(m_publisher_map.map->size());
-
-      // iterate map
-      m_publisher_map.map->remove_deprecated();
-      for (const auto& publisher : (*m_publisher_map.map))
+      monitoring_.publisher.reserve(entities.publisher.size());
+      for (const auto& publisher : entities.publisher)
       {
-        monitoring_.publisher.emplace_back(publisher.second);
+        monitoring_.publisher.emplace_back(*publisher);
       }
     }
 
     if ((entities_ & Monitoring::Entity::Subscriber) != 0u)
     {
-      // clear target
       monitoring_.subscriber.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_subscriber_map.sync);
-
-      // reserve target
-      monitoring_.subscriber.reserve(m_subscriber_map.map->size());
-
-      // iterate map
-      m_subscriber_map.map->remove_deprecated();
-      for (const auto& subscriber : (*m_subscriber_map.map))
+      monitoring_.subscriber.reserve(entities.subscriber.size());
+      for (const auto& subscriber : entities.subscriber)
       {
-        monitoring_.subscriber.emplace_back(subscriber.second);
+        monitoring_.subscriber.emplace_back(*subscriber);
       }
     }
 
     if ((entities_ & Monitoring::Entity::Server) != 0u)
     {
-      // clear target
       monitoring_.server.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_server_map.sync);
-
-      // reserve target
-      monitoring_.server.reserve(m_server_map.map->size());
-
-      // iterate map
-      m_server_map.map->remove_deprecated();
-      for (const auto& server : (*m_server_map.map))
+      monitoring_.server.reserve(entities.server.size());
+      for (const auto& server : entities.server)
       {
-        monitoring_.server.emplace_back(server.second);
+        monitoring_.server.emplace_back(*server);
       }
     }
 
     if ((entities_ & Monitoring::Entity::Client) != 0u)
     {
-      // clear target
       monitoring_.clients.clear();
-
-      // lock map
-      const std::lock_guard<std::mutex> lock(m_clients_map.sync);
-
-      // reserve target
-      monitoring_.clients.reserve(m_clients_map.map->size());
-
-      // iterate map
-      m_clients_map.map->remove_deprecated();
-      for (const auto& client : (*m_clients_map.map))
+      monitoring_.clients.reserve(entities.clients.size());
+      for (const auto& client : entities.clients)
       {
-        monitoring_.clients.emplace_back(client.second);
+        monitoring_.clients.emplace_back(*client);
       }
     }
   }
 
-  void CMonitoringImpl::MonitorProcs(Monitoring::SMonitoring& monitoring_)
+  std::shared_ptr<const Monitoring::SMonitoringSnapshot> CMonitoringImpl::GetMonitoringSnapshot()
   {
-    // acquire access
-    const std::lock_guard<std::mutex> lock(m_process_map.sync);
+    // purge timed out entities, this increases the registry version if something expired
+    RemoveDeprecated(m_process_map);
+    RemoveDeprecated(m_publisher_map);
+    RemoveDeprecated(m_subscriber_map);
+    RemoveDeprecated(m_server_map);
+    RemoveDeprecated(m_clients_map);
+
+    const std::lock_guard<std::mutex> lock(m_snapshot_mtx);
+
+    // the registry did not change (not even a registration clock), share the last snapshot
+    const uint64_t version       = m_registry_version;
+    const uint64_t refresh_count = m_refresh_count;
+    if (m_snapshot && (m_snapshot->version == version) && (m_snapshot_refresh_count == refresh_count)) return(m_snapshot);
+
+    // rebuild the snapshot, this only copies the entity references
+    auto snapshot = std::make_shared<Monitoring::SMonitoringSnapshot>();
+    snapshot->version = version;
+    CollectEntities(m_process_map,    snapshot->entities.processes);
+    CollectEntities(m_publisher_map,  snapshot->entities.publisher);
+    CollectEntities(m_subscriber_map, snapshot->entities.subscriber);
+    CollectEntities(m_server_map,     snapshot->entities.server);
+    CollectEntities(m_clients_map,    snapshot->entities.clients);
+
+    m_snapshot               = std::move(snapshot);
+    m_snapshot_refresh_count = refresh_count;
+    return(m_snapshot);
+  }
+
+  void CMonitoringImpl::GetMonitoringDelta(uint64_t since_version_, Monitoring::SMonitoringDelta& delta_, unsigned int entities_)
+  {
+    // purge timed out entities, this increases the registry version if something expired
+    RemoveDeprecated(m_process_map);
+    RemoveDeprecated(m_publisher_map);
+    RemoveDeprecated(m_subscriber_map);
+    RemoveDeprecated(m_server_map);
+    RemoveDeprecated(m_clients_map);
+
+    // entities updated while collecting may be reported again by the next delta, that is harmless
+    delta_.version = m_registry_version;
+
+    // a version from the future (e.g. from a former eCAL instance) can only be answered completely
+    if (since_version_ > delta_.version) since_version_ = 0;
 
-    // iterate map
-    m_process_map.map->remove_deprecated();
-    for (const auto& process : (*m_process_map.map))
+    auto& changed = delta_.changed;
+    auto& removed = delta_.removed;
+    bool complete(since_version_ != 0);
+    if (complete && ((entities_ & Monitoring::Entity::Process) != 0u))
+    {
+      complete = CollectDelta(m_process_map, since_version_, changed.processes, removed.processes);
+    }
+    if (complete && ((entities_ & Monitoring::Entity::Publisher) != 0u))
+    {
+      complete = CollectDelta(m_publisher_map, since_version_, changed.publisher, removed.publisher);
+    }
+    if (complete && ((entities_ & Monitoring::Entity::Subscriber) != 0u))
     {
-      // add process
-      monitoring_.processes.push_back(process.second);
+      complete = CollectDelta(m_subscriber_map, since_version_, changed.subscriber, removed.subscriber);
     }
+    if (complete && ((entities_ & Monitoring::Entity::Server) != 0u))
+    {
+      complete = CollectDelta(m_server_map, since_version_, changed.server, removed.server);
+    }
+    if (complete && ((entities_ & Monitoring::Entity::Client) != 0u))
+    {
+      complete = CollectDelta(m_clients_map, since_version_, changed.clients, removed.clients);
+    }
+    if (complete) return;
+
+    // removal history does not reach back far enough, hand out the complete registry
+    const auto snapshot = GetMonitoringSnapshot();
+    delta_ = Monitoring::SMonitoringDelta();
+    delta_.version = snapshot->version;
+    delta_.full    = true;
+    if ((entities_ & Monitoring::Entity::Process)    != 0u) delta_.changed.processes  = snapshot->entities.processes;
+    if ((entities_ & Monitoring::Entity::Publisher)  != 0u) delta_.changed.publisher  = snapshot->entities.publisher;
+    if ((entities_ & Monitoring::Entity::Subscriber) != 0u) delta_.changed.subscriber = snapshot->entities.subscriber;
+    if ((entities_ & Monitoring::Entity::Server)     != 0u) delta_.changed.server     = snapshot->entities.server;
+    if ((entities_ & Monitoring::Entity::Client)     != 0u) delta_.changed.clients    = snapshot->entities.clients;
   }
 
-  void CMonitoringImpl::MonitorServer(Monitoring::SMonitoring& monitoring_)
+  template <typename MonT, typename UpdateT>
+  void CMonitoringImpl::UpdateEntry(SMonEntry<MonT>& entry_, UpdateT update_)
   {
-    // acquire access
-    const std::lock_guard<std::mutex> lock(m_server_map.sync);
+    // update a copy, the published entity may be referenced by snapshots
+    MonT mon = entry_.mon ? *entry_.mon : MonT();
+    update_(mon);
+
+    // a registration refresh without any content change (only the registration clock
+    // increased) keeps the registry version, so deltas stay small
+    const bool changed = !entry_.mon || !EqualContent(*entry_.mon, mon);
+
+    // the stored entity still gets the new registration clock
+    entry_.mon = std::make_shared<MonT>(std::move(mon));
+    if (changed) entry_.version = ++m_registry_version;
+    else         ++m_refresh_count;
+  }
+
+  template <typename MonT>
+  void CMonitoringImpl::RemoveEntry(SMonMap<MonT>& map_, const std::string& key_)
+  {
+    auto iter = map_.map->find(key_);
+    if (iter == map_.map->end()) return;
 
-    // iterate map
-    m_server_map.map->remove_deprecated();
-    for (const auto& server : (*m_server_map.map))
+    AddRemoved(map_, std::shared_ptr<const MonT>((*iter).second.mon));
+    map_.map->erase(key_);
+  }
+
+  template <typename MonT>
+  void CMonitoringImpl::RemoveDeprecated(SMonMap<MonT>& map_)
+  {
+    const std::lock_guard<std::mutex> lock(map_.sync);
+
+    std::list<std::pair<std::string, SMonEntry<MonT>>> erased;
+    map_.map->remove_deprecated(erased);
+    for (auto& entry : erased)
     {
-      // add service
-      monitoring_.server.push_back(server.second);
+      AddRemoved(map_, std::shared_ptr<const MonT>(std::move(entry.second.mon)));
     }
   }
 
-  void CMonitoringImpl::MonitorClients(Monitoring::SMonitoring& monitoring_)
+  template <typename MonT>
+  void CMonitoringImpl::AddRemoved(SMonMap<MonT>& map_, std::shared_ptr<const MonT> mon_)
   {
-    // acquire access
-    const std::lock_guard<std::mutex> lock(m_clients_map.sync);
-
-    // iterate map
-    m_clients_map.map->remove_deprecated();
-    for (const auto& client : (*m_clients_map.map))
+    map_.removed.emplace_back(++m_registry_version, std::move(mon_));
+    while (map_.removed.size() > MON_DELTA_HISTORY)
     {
-      // add client
-      monitoring_.clients.push_back(client.second);
+      map_.removed_horizon = map_.removed.front().first;
+      map_.removed.pop_front();
     }
   }
 
-  void CMonitoringImpl::MonitorTopics(STopicMonMap& map_, Monitoring::SMonitoring& monitoring_, const std::string& direction_)
+  template <typename MonT>
+  void CMonitoringImpl::CollectEntities(SMonMap<MonT>& map_, std::vector<std::shared_ptr<const MonT>>& entities_)
   {
-    // acquire access
     const std::lock_guard<std::mutex> lock(map_.sync);
 
-    // iterate map
-    map_.map->remove_deprecated();
-    for (const auto& topic : (*map_.map))
+    // every entity has a version > 0
+    CollectSorted(map_, 0, entities_);
+  }
+
+  template <typename MonT>
+  bool CMonitoringImpl::CollectDelta(SMonMap<MonT>& map_, uint64_t since_version_, std::vector<std::shared_ptr<const MonT>>& changed_, std::vector<std::shared_ptr<const MonT>>& removed_)
+  {
+    const std::lock_guard<std::mutex> lock(map_.sync);
+
+    // removals older than the history can not be reported anymore
+    if (since_version_ < map_.removed_horizon) return(false);
+
+    CollectSorted(map_, since_version_, changed_);
+
+    // history is ordered by version, walk back until the requested version
+    for (auto iter = map_.removed.rbegin(); (iter != map_.removed.rend()) && (iter->first > since_version_); ++iter)
     {
-      if (direction_ == "publisher")
-      {
-        monitoring_.publisher.push_back(topic.second);
-      }
-      if (direction_ == "subscriber")
-      {
-        monitoring_.subscriber.push_back(topic.second);
-      }
+      removed_.emplace_back(iter->second);
+    }
+    return(true);
+  }
+
+  template <typename MonT>
+  void CMonitoringImpl::CollectSorted(SMonMap<MonT>& map_, uint64_t since_version_, std::vector<std::shared_ptr<const MonT>>& entities_)
+  {
+    // the hash map is unordered, keep the entities ordered by their key like the former ordered map
+    std::vector<std::pair<const std::string*, const SMonEntry<MonT>*>> entries;
+    entries.reserve(map_.map->size());
+    for (auto&& entry : (*map_.map))
+    {
+      if (entry.second.version > since_version_) entries.emplace_back(&entry.first, &entry.second);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& lhs_, const auto& rhs_) { return *lhs_.first < *rhs_.first; });
+
+    entities_.reserve(entities_.size() + entries.size());
+    for (const auto& entry : entries)
+    {
+      entities_.emplace_back(entry.second->mon);
     }
   }
 
@@ -26,14 +26,19 @@
 #include <ecal/types/monitoring.h>
 
 #include "ecal_def.h"
-#include "util/ecal_expmap.h"
+#include "util/ecal_exphashmap.h"
 
 #include "serialization/ecal_serialize_sample_registration.h"
 
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #ifdef ECAL_OS_LINUX
 #include <strings.h>  // strcasecmp
@@ -60,6 +65,9 @@ namespace eCAL
     void GetMonitoring(std::string& monitoring_, unsigned int entities_);
     void GetMonitoring(Monitoring::SMonitoring& monitoring_, unsigned int entities_);
 
+    std::shared_ptr<const Monitoring::SMonitoringSnapshot> GetMonitoringSnapshot();
+    void GetMonitoringDelta(uint64_t since_version_, Monitoring::SMonitoringDelta& delta_, unsigned int entities_);
+
   protected:
     bool ApplySample(const Registration::Sample& ecal_sample_, eTLayerType /*layer_*/);
 
@@ -81,49 +89,31 @@ namespace eCAL
     bool RegisterTopic(const Registration::Sample& sample_, enum ePubSub pubsub_type_);
     bool UnregisterTopic(const Registration::Sample& sample_, enum ePubSub pubsub_type_);
 
-    using TopicMonMapT = Util::CExpMap<std::string, Monitoring::STopicMon>;
-    struct STopicMonMap
+    template <typename MonT>
+    struct SMonEntry
     {
-      explicit STopicMonMap(const std::chrono::milliseconds& timeout_) :
-        map(std::make_unique<TopicMonMapT>(timeout_))
-      {
-      };
-      std::mutex                     sync;
-      std::unique_ptr<TopicMonMapT>  map;
+      std::shared_ptr<MonT>  mon;                  // copy on write, may be shared with snapshots
+      uint64_t               version = 0;          // registry version of the last update
     };
 
-    using ProcessMonMapT = Util::CExpMap<std::string, Monitoring::SProcessMon>;
-    struct SProcessMonMap
+    template <typename MonT>
+    struct SMonMap
     {
-      explicit SProcessMonMap(const std::chrono::milliseconds& timeout_) :
-        map(std::make_unique<ProcessMonMapT>(timeout_))
+      using MapT = Util::CExpHashMap<std::string, SMonEntry<MonT>>;
+      explicit SMonMap(const std::chrono::milliseconds& timeout_) :
+        map(std::make_unique<MapT>(timeout_))
       {
       };
-      std::mutex                       sync;
-      std::unique_ptr<ProcessMonMapT>  map;
+      std::mutex                                                    sync;
+      std::unique_ptr<MapT>                                         map;
+      std::deque<std::pair<uint64_t, std::shared_ptr<const MonT>>>  removed;              // removal history for delta queries
+      uint64_t                                                      removed_horizon = 0;  // latest removal version dropped from the history
     };
 
-    using ServerMonMapT = Util::CExpMap<std::string, Monitoring::SServerMon>;
-    struct SServerMonMap
-    {
-      explicit SServerMonMap(const std::chrono::milliseconds& timeout_) :
-        map(std::make_unique<ServerMonMapT>(timeout_))
-      {
-      };
-      std::mutex                      sync;
-      std::unique_ptr<ServerMonMapT>  map;
-    };
-
-    using ClientMonMapT = Util::CExpMap<std::string, Monitoring::SClientMon>;
-    struct SClientMonMap
-    {
-      explicit SClientMonMap(const std::chrono::milliseconds& timeout_) :
-        map(std::make_unique<ClientMonMapT>(timeout_))
-      {
-      };
-      std::mutex                      sync;
-      std::unique_ptr<ClientMonMapT>  map;
-    };
+    using STopicMonMap   = SMonMap<Monitoring::STopicMon>;
+    using SProcessMonMap = SMonMap<Monitoring::SProcessMon>;
+    using SServerMonMap  = SMonMap<Monitoring::SServerMon>;
+    using SClientMonMap  = SMonMap<Monitoring::SClientMon>;
 
     struct InsensitiveCompare
     {
@@ -141,10 +131,21 @@ namespace eCAL
 
     STopicMonMap* GetMap(enum ePubSub pubsub_type_);
 
-    void MonitorProcs(Monitoring::SMonitoring& monitoring_);
-    void MonitorServer(Monitoring::SMonitoring& monitoring_);
-    void MonitorClients(Monitoring::SMonitoring& monitoring_);
-    void MonitorTopics(STopicMonMap& map_, Monitoring::SMonitoring& monitoring_, const std::string& direction_);
+    template <typename MonT, typename UpdateT>
+    void  UpdateEntry(SMonEntry<MonT>& entry_, UpdateT update_);
+    template <typename MonT>
+    void  RemoveEntry(SMonMap<MonT>& map_, const std::string& key_);
+    template <typename MonT>
+    void  RemoveDeprecated(SMonMap<MonT>& map_);
+    template <typename MonT>
+    void  AddRemoved(SMonMap<MonT>& map_, std::shared_ptr<const MonT> mon_);
+
+    template <typename MonT>
+    void  CollectEntities(SMonMap<MonT>& map_, std::vector<std::shared_ptr<const MonT>>& entities_);
+    template <typename MonT>
+    bool  CollectDelta(SMonMap<MonT>& map_, uint64_t since_version_, std::vector<std::shared_ptr<const MonT>>& changed_, std::vector<std::shared_ptr<const MonT>>& removed_);
+    template <typename MonT>
+    void  CollectSorted(SMonMap<MonT>& map_, uint64_t since_version_, std::vector<std::shared_ptr<const MonT>>& entities_);
 
     void Tokenize(const std::string& str, StrICaseSetT& tokens, const std::string& delimiters, bool trimEmpty);
 
@@ -165,5 +166,20 @@ namespace eCAL
     STopicMonMap                                 m_subscriber_map;
     SServerMonMap                                m_server_map;
     SClientMonMap                                m_clients_map;
+
+    // registry version, increased on every change of the database
+    std::atomic<uint64_t>                        m_registry_version;
+    // increased on registration refreshes without content change (registration clock only)
+    std::atomic<uint64_t>                        m_refresh_count;
+
+    // latest snapshot and its serialized representation
+    std::mutex                                   m_snapshot_mtx;
+    std::shared_ptr<const Monitoring::SMonitoringSnapshot> m_snapshot;
+    uint64_t                                     m_snapshot_refresh_count;
+
+    std::mutex                                   m_serialized_mtx;
+    std::shared_ptr<const Monitoring::SMonitoringSnapshot> m_serialized_snapshot;
+    unsigned int                                 m_serialized_entities;
+    std::string                                  m_serialized;
   };
 }
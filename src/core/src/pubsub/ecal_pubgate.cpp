@@ -25,6 +25,7 @@
 #include "ecal_sample_to_topicinfo.h"
 #include "ecal_globals.h"
 
+#include <algorithm>
 #include <iterator>
 #include <atomic>
 
@@ -46,6 +47,27 @@ namespace
     }
     return false;
   }
+
+  // highest payload compression a subscriber announces to decode on the network layers
+  int GetSubscriberCompression(const eCAL::Registration::Topic& ecal_topic_)
+  {
+    int compression(0);
+    for (const auto& layer : ecal_topic_.tlayer)
+    {
+      if (layer.type == eCAL::tl_ecal_udp_mc) compression = std::max(compression, layer.par_layer.layer_par_udpmc.compression);
+      if (layer.type == eCAL::tl_ecal_tcp)    compression = std::max(compression, layer.par_layer.layer_par_tcp.compression);
+    }
+    return compression;
+  }
+
+  bool HasSubscriberLayer(const eCAL::Registration::Topic& ecal_topic_, eCAL::eTLayerType type_)
+  {
+    for (const auto& layer : ecal_topic_.tlayer)
+    {
+      if (layer.type == type_) return true;
+    }
+    return false;
+  }
 }
 
 namespace eCAL
@@ -148,6 +170,12 @@ namespace eCAL
     }
 #endif
 
+    // sample filter and payload compression supported by the subscriber
+    const SSampleFilter filter = SSampleFilter::FromRegistration(ecal_sample.filter);
+    const int compression = GetSubscriberCompression(ecal_sample);
+    // local subscribers without the shm layer receive on the network layers
+    const bool shm_layer = HasSubscriberLayer(ecal_sample, tl_ecal_shm);
+
     // store description
     ApplyTopicToDescGate(topic_name, topic_information);
 
@@ -156,7 +184,7 @@ namespace eCAL
     auto res = m_topic_name_datawriter_map.equal_range(topic_name);
     for(TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
     {
-      iter->second->ApplyLocSubscription(subscription_info, topic_information, reader_par);
+      iter->second->ApplyLocSubscription(subscription_info, topic_information, reader_par, filter, compression, shm_layer);
     }
   }
 
@@ -202,6 +230,10 @@ namespace eCAL
     }
 #endif
 
+    // sample filter and payload compression supported by the subscriber
+    const SSampleFilter filter = SSampleFilter::FromRegistration(ecal_sample.filter);
+    const int compression = GetSubscriberCompression(ecal_sample);
+
     // store description
     ApplyTopicToDescGate(topic_name, topic_information);
 
@@ -210,7 +242,7 @@ namespace eCAL
     auto res = m_topic_name_datawriter_map.equal_range(topic_name);
     for(TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
     {
-      iter->second->ApplyExtSubscription(subscription_info, topic_information, reader_par);
+      iter->second->ApplyExtSubscription(subscription_info, topic_information, reader_par, filter, compression);
     }
   }
 
@@ -27,6 +27,7 @@
 #include "readwrite/ecal_writer.h"
 #include "readwrite/ecal_writer_buffer_payload.h"
 
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 
@@ -224,6 +225,13 @@ namespace eCAL
     return(true);
   }
 
+  bool CPublisher::SetCompression(TLayer::eCompression compression_)
+  {
+    if (m_datawriter == nullptr) return false;
+    m_datawriter->SetCompression(compression_);
+    return true;
+  }
+
   size_t CPublisher::Send(const void* const buf_, const size_t len_, const long long time_ /* = DEFAULT_TIME_ARGUMENT */) const
   {
     CBufferPayloadWriter payload{ buf_, len_ };
@@ -258,6 +266,72 @@ namespace eCAL
     return(Send(s_.data(), s_.size(), time_));
   }
 
+  CPublisherLoan CPublisher::Loan(size_t len_) const
+  {
+    CPublisherLoan loan;
+    if (!m_created) return(loan);
+
+    std::unique_ptr<SWriterLoan> writer_loan(new SWriterLoan);
+    if (!m_datawriter->Loan(len_, *writer_loan)) return(loan);
+
+    loan.m_datawriter = m_datawriter;
+    loan.m_loan       = std::move(writer_loan);
+    loan.m_id         = m_id;
+    return(loan);
+  }
+
+  size_t CPublisher::SendBatch(const std::vector<SPublisherPayload>& batch_, long long time_)
+  {
+    // one send time for the whole frame
+    const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
+
+    // write all payloads, but hold back the subscriber signaling
+    size_t written_bytes(0);
+    std::vector<CDataWriter*> written_writers;
+    written_writers.reserve(batch_.size());
+    for (const auto& entry : batch_)
+    {
+      if ((entry.publisher == nullptr) || (entry.payload == nullptr)) continue;
+      const CPublisher& pub = *entry.publisher;
+      if (!pub.m_created) continue;
+
+      if (!pub.IsSubscribed())
+      {
+        pub.m_datawriter->RefreshSendCounter();
+        written_bytes += entry.payload->GetSize();
+        continue;
+      }
+
+      // a publisher occurring again sends its messages one after another, the former message
+      // is signaled (and acknowledged) before the next one may overwrite its memory file
+      auto* writer = pub.m_datawriter.get();
+      const auto written_iter = std::find(written_writers.begin(), written_writers.end(), writer);
+      if (written_iter != written_writers.end())
+      {
+        written_writers.erase(written_iter);
+        writer->SignalContent();
+        writer->WaitForAcknowledges();
+      }
+
+      const size_t written = writer->Write(*entry.payload, write_time, pub.m_id, true);
+      if (written > 0) written_writers.push_back(writer);
+      written_bytes += written;
+    }
+
+    // the frame is complete, signal it to all subscribers first
+    // and wait for their acknowledges afterwards, so the acknowledge waits of all topics overlap
+    for (auto* writer : written_writers)
+    {
+      writer->SignalContent();
+    }
+    for (auto* writer : written_writers)
+    {
+      writer->WaitForAcknowledges();
+    }
+
+    return written_bytes;
+  }
+
   bool CPublisher::AddEventCallback(eCAL_Publisher_Event type_, PubEventCallbackT callback_)
   {
     if (m_datawriter == nullptr) return(false);
@@ -299,6 +373,12 @@ namespace eCAL
     return(m_datawriter->GetDataTypeInformation());
   }
 
+  Monitoring::STopicLatencyMon CPublisher::GetLatency() const
+  {
+    if (m_datawriter == nullptr) return(Monitoring::STopicLatencyMon{});
+    return(m_datawriter->GetLatency());
+  }
+
   std::string CPublisher::Dump(const std::string& indent_ /* = "" */) const
   {
     std::stringstream out;
@@ -312,4 +392,85 @@ namespace eCAL
 
     return(out.str());
   }
+
+  CPublisherLoan::CPublisherLoan() :
+    m_id(0)
+  {
+  }
+
+  CPublisherLoan::~CPublisherLoan()
+  {
+    Discard();
+  }
+
+  CPublisherLoan::CPublisherLoan(CPublisherLoan&& rhs) noexcept :
+    m_datawriter(std::move(rhs.m_datawriter)),
+    m_loan(std::move(rhs.m_loan)),
+    m_id(rhs.m_id)
+  {
+  }
+
+  CPublisherLoan& CPublisherLoan::operator=(CPublisherLoan&& rhs) noexcept
+  {
+    // release the current loan, then take over the other one
+    Discard();
+
+    m_datawriter = std::move(rhs.m_datawriter);
+    m_loan       = std::move(rhs.m_loan);
+    m_id         = rhs.m_id;
+
+    return *this;
+  }
+
+  bool CPublisherLoan::IsValid() const
+  {
+    return((m_datawriter != nullptr) && (m_loan != nullptr));
+  }
+
+  void* CPublisherLoan::Data() const
+  {
+    if (!IsValid()) return(nullptr);
+    return(m_loan->data);
+  }
+
+  size_t CPublisherLoan::Size() const
+  {
+    if (!IsValid()) return(0);
+    return(m_loan->len);
+  }
+
+  size_t CPublisherLoan::Commit(long long time_)
+  {
+    if (!IsValid()) return(0);
+
+    size_t written_bytes(0);
+    if (!m_datawriter->IsSubscribed())
+    {
+      // nobody is listening, just release the loan and do the statistics
+      written_bytes = m_loan->len;
+      m_datawriter->Discard(*m_loan);
+      m_datawriter->RefreshSendCounter();
+    }
+    else
+    {
+      // publish the loaned payload via data writer layer
+      const long long write_time = (time_ == CPublisher::DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
+      written_bytes = m_datawriter->Commit(*m_loan, write_time, m_id);
+    }
+
+    m_loan.reset();
+    m_datawriter.reset();
+
+    return(written_bytes);
+  }
+
+  void CPublisherLoan::Discard()
+  {
+    if (!IsValid()) return;
+
+    m_datawriter->Discard(*m_loan);
+
+    m_loan.reset();
+    m_datawriter.reset();
+  }
 }
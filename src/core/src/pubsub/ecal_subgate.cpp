@@ -24,6 +24,7 @@
 #include "pubsub/ecal_subgate.h"
 #include "ecal_sample_to_topicinfo.h"
 #include "ecal_globals.h"
+#include "util/ecal_lz_codec.h"
 
 #include <algorithm>
 #include <iterator>
@@ -162,6 +163,20 @@ namespace eCAL
         break;
       }
 
+      // decode compressed network payloads
+      std::vector<char> decompressed_payload;
+      if (ecal_sample.content.compression != TLayer::compression_none)
+      {
+        if ((ecal_sample.content.compression != TLayer::compression_lz)
+          || !Util::LzCodec::Decompress(payload_addr, payload_size, decompressed_payload))
+        {
+          Logging::Log(log_level_warning, ecal_sample.topic.tname + " : failed to decompress payload !");
+          return false;
+        }
+        payload_addr = decompressed_payload.data();
+        payload_size = decompressed_payload.size();
+      }
+
       // update globals
       g_process_rclock++;
       g_process_rbytes_sum += payload_size;
@@ -202,7 +217,7 @@ namespace eCAL
     return (applied_size > 0);
   }
 
-  bool CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_)
+  bool CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, const std::shared_ptr<const void>& hold_)
   {
     if (!m_created) return false;
 
@@ -227,7 +242,7 @@ namespace eCAL
 
     for (const auto& reader : readers_to_apply)
     {
-      applied_size = reader->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_);
+      applied_size = reader->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_, hold_);
     }
 
     return (applied_size > 0);
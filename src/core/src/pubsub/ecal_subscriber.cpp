@@ -150,6 +150,7 @@ namespace eCAL
 
     // remove receive callback
     RemReceiveCallback();
+    RemReceiveSampleCallback();
 
     // first unregister data reader
     if(g_subgate() != nullptr) g_subgate()->Unregister(m_datareader->GetTopicName(), m_datareader);
@@ -185,6 +186,32 @@ namespace eCAL
     return(true);
   }
 
+  bool CSubscriber::SetMaxFrequency(double frequency_)
+  {
+    if (m_datareader == nullptr) return(false);
+    m_datareader->SetMaxFrequency(frequency_);
+    return(true);
+  }
+
+  bool CSubscriber::ShmSetSpinBudget(std::chrono::microseconds spin_budget_)
+  {
+    if (m_datareader == nullptr) return(false);
+    m_datareader->ShmSetSpinBudget(spin_budget_);
+    return(true);
+  }
+
+  bool CSubscriber::SetLatestValueMode(bool state_, size_t reserve_size_)
+  {
+    if (m_datareader == nullptr) return(false);
+    return(m_datareader->SetLatestValueMode(state_, reserve_size_));
+  }
+
+  bool CSubscriber::ReadLatest(SLatestSample& sample_) const
+  {
+    if (!m_created) return(false);
+    return(m_datareader->ReadLatest(sample_));
+  }
+
   bool CSubscriber::SetAttribute(const std::string& attr_name_, const std::string& attr_value_)
   {
     if(m_datareader == nullptr) return false;
@@ -216,6 +243,19 @@ namespace eCAL
     return(m_datareader->RemReceiveCallback());
   }
 
+  bool CSubscriber::AddReceiveSampleCallback(ReceiveSampleCallbackT callback_)
+  {
+    if(m_datareader == nullptr) return(false);
+    RemReceiveSampleCallback();
+    return(m_datareader->AddReceiveSampleCallback(std::move(callback_)));
+  }
+
+  bool CSubscriber::RemReceiveSampleCallback()
+  {
+    if(m_datareader == nullptr) return(false);
+    return(m_datareader->RemReceiveSampleCallback());
+  }
+
   bool CSubscriber::AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_)
   {
     if (m_datareader == nullptr) return(false);
@@ -247,6 +287,12 @@ namespace eCAL
     return(m_datareader->GetDataTypeInformation());
   }
 
+  Monitoring::STopicLatencyMon CSubscriber::GetLatency() const
+  {
+    if (m_datareader == nullptr) return(Monitoring::STopicLatencyMon{});
+    return(m_datareader->GetLatency());
+  }
+
   std::string CSubscriber::Dump(const std::string& indent_ /* = "" */) const
   {
     std::stringstream out;
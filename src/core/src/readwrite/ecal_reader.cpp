@@ -44,10 +44,38 @@
 #endif
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <sstream>
 #include <iostream>
+#include <memory>
 #include <utility>
+#include <vector>
+
+namespace
+{
+  eCAL::Registration::LatencyHistogram RegistrationLatencyHistogram(const eCAL::Monitoring::SLatencyMon& latency_)
+  {
+    eCAL::Registration::LatencyHistogram histogram;
+    histogram.count = latency_.count;
+    histogram.min   = latency_.min;
+    histogram.max   = latency_.max;
+    histogram.mean  = latency_.mean;
+    histogram.p50   = latency_.p50;
+    histogram.p90   = latency_.p90;
+    histogram.p99   = latency_.p99;
+    histogram.p999  = latency_.p999;
+    return histogram;
+  }
+
+  // sample passed to the sample callback, holding the shm content or a copy of the payload
+  struct SHeldSample
+  {
+    eCAL::SReceiveCallbackData  data;
+    std::shared_ptr<const void> hold;
+    std::vector<char>           copy;
+  };
+}
 
 namespace eCAL
 {
@@ -64,9 +92,13 @@ namespace eCAL
                  m_read_buf_received(false),
                  m_read_time(0),
                  m_receive_time(0),
+                 m_latest_mode(false),
+                 m_latest_received(false),
+                 m_latest_read_sequence(0),
                  m_clock(0),
                  m_clock_old(0),
                  m_freq(0),
+                 m_filter_active(false),
                  m_message_drops(0),
                  m_loc_published(false),
                  m_ext_published(false),
@@ -75,6 +107,8 @@ namespace eCAL
                  m_use_udp_mc_confirmed(false),
                  m_use_shm_confirmed(false),
                  m_use_tcp_confirmed(false),
+                 m_shm_spin_budget_us(0),
+                 m_shm_hold_samples(false),
                  m_created(false)
   {
   }
@@ -211,6 +245,11 @@ namespace eCAL
   
   void CDataReader::UnsubscribeFromLayers()
   {
+    // drop the shm receive requests (spin budget) of this reader
+#if ECAL_CORE_TRANSPORT_SHM
+    CSHMReaderLayer::Get()->RemSubscription(m_host_name, m_topic_name, m_topic_id);
+#endif
+
     // unsubscribe topic from udp multicast layer
 #if ECAL_CORE_TRANSPORT_UDP
     if (Config::IsUdpMulticastRecEnabled())
@@ -267,6 +306,7 @@ namespace eCAL
       udp_tlayer.type      = tl_ecal_udp_mc;
       udp_tlayer.version   = 1;
       udp_tlayer.confirmed = m_use_udp_mc_confirmed;
+      udp_tlayer.par_layer.layer_par_udpmc.compression = TLayer::compression_lz;
       ecal_reg_sample_topic.tlayer.push_back(udp_tlayer);
     }
 #endif
@@ -289,6 +329,7 @@ namespace eCAL
       tcp_tlayer.type      = tl_ecal_tcp;
       tcp_tlayer.version   = 1;
       tcp_tlayer.confirmed = m_use_tcp_confirmed;
+      tcp_tlayer.par_layer.layer_par_tcp.compression = TLayer::compression_lz;
       ecal_reg_sample_topic.tlayer.push_back(tcp_tlayer);
     }
 #endif
@@ -300,6 +341,16 @@ namespace eCAL
     ecal_reg_sample_topic.dfreq         = m_freq;
     ecal_reg_sample_topic.message_drops = static_cast<int32_t>(m_message_drops);
 
+    // latencies
+    ecal_reg_sample_topic.latency.delivery = RegistrationLatencyHistogram(m_delivery_latency.GetSummary());
+    ecal_reg_sample_topic.latency.callback = RegistrationLatencyHistogram(m_callback_latency.GetSummary());
+
+    // sample filter
+    {
+      const std::lock_guard<std::mutex> lock(m_filter_sync);
+      ecal_reg_sample_topic.filter = m_filter.ToRegistration();
+    }
+
     // we do not know the number of connections ..
     ecal_reg_sample_topic.connections_loc = 0;
     ecal_reg_sample_topic.connections_ext = 0;
@@ -419,7 +470,7 @@ namespace eCAL
     return(false);
   }
 
-  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_)
+  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, const std::shared_ptr<const void>& hold_)
   {
     // ensure thread safety
     const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
@@ -450,10 +501,13 @@ namespace eCAL
     // limit size of hash queue to the last 64 messages
     while (m_sample_hash_queue.size() > hash_queue_size) m_sample_hash_queue.pop_front();
 
-    // check id
-    if (!m_id_set.empty())
+    // check the sample filter ids first (the publisher skips samples no subscriber accepts,
+    // so clock gaps are expected while a filter is set)
+    const bool filter_active = m_filter_active;
+    if (filter_active)
     {
-      if (m_id_set.find(id_) == m_id_set.end()) return(0);
+      const std::lock_guard<std::mutex> lock(m_filter_sync);
+      if (!m_filter.ids.empty() && (m_filter.ids.find(id_) == m_filter.ids.end())) return(0);
     }
 
     // check the current message clock
@@ -461,12 +515,19 @@ namespace eCAL
     //  - a dropped message
     //  - an out-of-order message
     //  - a multiple sent message
-    if (!CheckMessageClock(tid_, clock_))
+    if (!CheckMessageClock(tid_, clock_, filter_active))
     {
       // we will not process that message
       return(0);
     }
 
+    // check the sample filter frequency (per publisher, like the publisher does)
+    if (filter_active)
+    {
+      const std::lock_guard<std::mutex> lock(m_filter_sync);
+      if (!m_filter.Accept(id_, time_, m_filter_last_time[tid_])) return(0);
+    }
+
 #ifndef NDEBUG
     // log it
     Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample");
@@ -475,6 +536,9 @@ namespace eCAL
     // increase read clock
     m_clock++;
 
+    // send time stamp to receive time (clocks of different hosts are not synchronized by eCAL)
+    if (time_ > 0) m_delivery_latency.Record((eCAL::Time::GetMicroSeconds() - time_) * 1000);
+
     // reset timeout
     m_receive_time = 0;
 
@@ -483,6 +547,24 @@ namespace eCAL
 
     // execute callback
     bool processed = false;
+
+    // store the latest sample into the triple buffer (instead of the read buffer)
+    if (m_latest_mode)
+    {
+      SLatestSlot& slot = m_latest_buffer->Back();
+      slot.payload.resize(std::max(slot.payload.size(), size_));
+      if (size_ > 0) std::memcpy(slot.payload.data(), payload_, size_);
+      slot.size         = size_;
+      slot.id           = id_;
+      slot.time         = time_;
+      slot.clock        = clock_;
+      slot.sequence     = m_clock;
+      slot.receive_time = std::chrono::steady_clock::now();
+      m_latest_buffer->Publish();
+      m_latest_received = true;
+      processed = true;
+    }
+
     {
       // call user receive callback function
       if(m_receive_callback)
@@ -499,7 +581,40 @@ namespace eCAL
         cb_data.time  = time_;
         cb_data.clock = clock_;
         // execute it
+        const auto callback_start = std::chrono::steady_clock::now();
         (m_receive_callback)(m_topic_name.c_str(), &cb_data);
+        m_callback_latency.Record(std::chrono::steady_clock::now() - callback_start);
+        processed = true;
+      }
+
+      // call user sample callback function
+      if(m_receive_sample_callback)
+      {
+#ifndef NDEBUG
+        // log it
+        Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::ReceiveSampleCallback");
+#endif
+        // the handle keeps the held memory file content alive or owns a copy of the payload
+        auto held_sample = std::make_shared<SHeldSample>();
+        if (hold_ != nullptr)
+        {
+          held_sample->hold = hold_;
+          held_sample->data.buf = const_cast<char*>(payload_);
+        }
+        else
+        {
+          held_sample->copy.assign(payload_, payload_ + size_);
+          held_sample->data.buf = held_sample->copy.data();
+        }
+        held_sample->data.size  = long(size_);
+        held_sample->data.id    = id_;
+        held_sample->data.time  = time_;
+        held_sample->data.clock = clock_;
+        const std::shared_ptr<const SReceiveCallbackData> sample(held_sample, &held_sample->data);
+        // execute it
+        const auto callback_start = std::chrono::steady_clock::now();
+        (m_receive_sample_callback)(m_topic_name.c_str(), sample);
+        m_callback_latency.Record(std::chrono::steady_clock::now() - callback_start);
         processed = true;
       }
     }
@@ -525,6 +640,51 @@ namespace eCAL
     return(size_);
   }
 
+  bool CDataReader::SetLatestValueMode(bool state_, size_t reserve_size_)
+  {
+    if (!m_created) return(false);
+
+    const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+
+    // the triple buffer is kept once created, the polling thread may read it at any time
+    if (state_ && !m_latest_buffer)
+    {
+      SLatestSlot initial_slot;
+      initial_slot.payload.resize(reserve_size_);
+      m_latest_buffer = std::make_unique<Util::CTripleBuffer<SLatestSlot>>(initial_slot);
+    }
+    m_latest_mode = state_;
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::SetLatestValueMode");
+#endif
+
+    return(true);
+  }
+
+  bool CDataReader::ReadLatest(SLatestSample& sample_)
+  {
+    if (!m_created)         return(false);
+    if (!m_latest_received) return(false);
+
+    // take the latest published slot (if any), the front slot is owned by this thread
+    m_latest_buffer->Update();
+    const SLatestSlot& slot = m_latest_buffer->Front();
+
+    sample_.buf      = slot.payload.data();
+    sample_.size     = slot.size;
+    sample_.id       = slot.id;
+    sample_.time     = slot.time;
+    sample_.clock    = slot.clock;
+    sample_.sequence = slot.sequence;
+    sample_.age      = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - slot.receive_time).count();
+    sample_.is_new   = slot.sequence != m_latest_read_sequence;
+    m_latest_read_sequence = slot.sequence;
+
+    return(true);
+  }
+
   bool CDataReader::AddReceiveCallback(ReceiveCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -559,6 +719,45 @@ namespace eCAL
     return(true);
   }
 
+  bool CDataReader::AddReceiveSampleCallback(ReceiveSampleCallbackT callback_)
+  {
+    if (!m_created) return(false);
+
+    // store sample callback
+    {
+      const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+#ifndef NDEBUG
+      // log it
+      Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::AddReceiveSampleCallback");
+#endif
+      m_receive_sample_callback = std::move(callback_);
+    }
+
+    // shm samples are held instead of copied from now on
+    m_shm_hold_samples = true;
+
+    return(true);
+  }
+
+  bool CDataReader::RemReceiveSampleCallback()
+  {
+    if (!m_created) return(false);
+
+    // reset sample callback
+    {
+      const std::lock_guard<std::mutex> lock(m_receive_callback_sync);
+#ifndef NDEBUG
+      // log it
+      Logging::Log(log_level_debug2, m_topic_name + "::CDataReader::RemReceiveSampleCallback");
+#endif
+      m_receive_sample_callback = nullptr;
+    }
+
+    m_shm_hold_samples = false;
+
+    return(true);
+  }
+
   bool CDataReader::AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -595,7 +794,35 @@ namespace eCAL
 
   void CDataReader::SetID(const std::set<long long>& id_set_)
   {
-    m_id_set = id_set_;
+    {
+      const std::lock_guard<std::mutex> lock(m_filter_sync);
+      m_filter.ids    = id_set_;
+      m_filter_active = m_filter.IsActive();
+    }
+
+    // register new to advertise the filter to the publishers
+    if (m_created) Register(true);
+  }
+
+  void CDataReader::SetMaxFrequency(double frequency_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_filter_sync);
+      m_filter.max_freq = (frequency_ > 0.0) ? std::max(1, static_cast<int32_t>(frequency_ * 1000.0)) : 0;
+      m_filter_last_time.clear();
+      m_filter_active = m_filter.IsActive();
+    }
+
+    // register new to advertise the filter to the publishers
+    if (m_created) Register(true);
+  }
+
+  Monitoring::STopicLatencyMon CDataReader::GetLatency() const
+  {
+    Monitoring::STopicLatencyMon latency;
+    latency.delivery = m_delivery_latency.GetSummary();
+    latency.callback = m_callback_latency.GetSummary();
+    return(latency);
   }
 
   void CDataReader::ApplyLocPublication(const std::string& process_id_, const std::string& tid_, const SDataTypeInformation& tinfo_)
@@ -663,7 +890,10 @@ namespace eCAL
     par.process_id = process_id_;
     par.topic_name = m_topic_name;
     par.topic_id   = topic_id_;
+    par.reader_id  = m_topic_id;
     par.parameter  = parameter_;
+    par.shm_spin_budget = std::chrono::microseconds(m_shm_spin_budget_us);
+    par.shm_hold_samples = m_shm_hold_samples;
 
     switch (type_)
     {
@@ -769,7 +999,7 @@ namespace eCAL
     }
   }
 
-  bool CDataReader::CheckMessageClock(const std::string& tid_, long long current_clock_)
+  bool CDataReader::CheckMessageClock(const std::string& tid_, long long current_clock_, bool gaps_expected_)
   {
     auto iter = m_writer_counter_map.find(tid_);
     
@@ -811,6 +1041,13 @@ namespace eCAL
       // -> we have a "message drop"
       if (clock_difference > 1)
       {
+        // samples skipped by a publisher side filter are no drops
+        if (gaps_expected_)
+        {
+          iter->second = current_clock_;
+          return true;
+        }
+
 #if 0
         // we log this
         std::string msg = std::to_string(counter_ - counter_last) + " Messages lost ! ";
@@ -26,19 +26,26 @@
 #include <ecal/ecal.h>
 #include <ecal/ecal_callback.h>
 #include <ecal/ecal_types.h>
+#include <ecal/types/monitoring.h>
 
+#include "ecal_sample_filter.h"
 #include "serialization/ecal_serialize_sample_payload.h"
 #include "serialization/ecal_serialize_sample_registration.h"
-#include "util/ecal_expmap.h"
+#include "util/ecal_exphashmap.h"
+#include "util/ecal_latency_histogram.h"
+#include "util/ecal_triple_buffer.h"
 
 #include <condition_variable>
 #include <mutex>
 #include <atomic>
+#include <chrono>
 #include <set>
 #include <queue>
 
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
@@ -58,6 +65,9 @@ namespace eCAL
     bool AddReceiveCallback(ReceiveCallbackT callback_);
     bool RemReceiveCallback();
 
+    bool AddReceiveSampleCallback(ReceiveSampleCallbackT callback_);
+    bool RemReceiveSampleCallback();
+
     bool AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_);
     bool RemEventCallback(eCAL_Subscriber_Event type_);
 
@@ -65,6 +75,11 @@ namespace eCAL
     bool ClearAttribute(const std::string& attr_name_);
 
     void SetID(const std::set<long long>& id_set_);
+    void SetMaxFrequency(double frequency_);
+    void ShmSetSpinBudget(std::chrono::microseconds spin_budget_) { m_shm_spin_budget_us = spin_budget_.count(); }
+
+    bool SetLatestValueMode(bool state_, size_t reserve_size_);
+    bool ReadLatest(SLatestSample& sample_);
 
     void ApplyLocPublication(const std::string& process_id_, const std::string& tid_, const SDataTypeInformation& tinfo_);
     void RemoveLocPublication(const std::string& process_id_, const std::string& tid_);
@@ -89,9 +104,11 @@ namespace eCAL
     std::string          GetTopicID()          const { return(m_topic_id); }
     SDataTypeInformation GetDataTypeInformation() const { return(m_topic_info); }
 
+    Monitoring::STopicLatencyMon GetLatency() const;
+
     void RefreshRegistration();
 
-    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_);
+    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, const std::shared_ptr<const void>& hold_ = nullptr);
 
   protected:
     void SubscribeToLayers();
@@ -102,7 +119,7 @@ namespace eCAL
 
     void Connect(const std::string& tid_, const SDataTypeInformation& tinfo_);
     void Disconnect();
-    bool CheckMessageClock(const std::string& tid_, long long current_clock_);
+    bool CheckMessageClock(const std::string& tid_, long long current_clock_, bool gaps_expected_);
 
     std::string                               m_host_name;
     std::string                               m_host_group_name;
@@ -115,7 +132,7 @@ namespace eCAL
     std::atomic<size_t>                       m_topic_size;
 
     std::atomic<bool>                         m_connected;
-    using ConnectedMapT = Util::CExpMap<std::string, bool>;
+    using ConnectedMapT = Util::CExpHashMap<std::string, bool>;
     mutable std::mutex                        m_pub_map_sync;
     ConnectedMapT                             m_loc_pub_map;
     ConnectedMapT                             m_ext_pub_map;
@@ -128,10 +145,26 @@ namespace eCAL
 
     std::mutex                                m_receive_callback_sync;
     ReceiveCallbackT                          m_receive_callback;
+    ReceiveSampleCallbackT                    m_receive_sample_callback;
     std::atomic<int>                          m_receive_time;
 
     std::deque<size_t>                        m_sample_hash_queue;
 
+    struct SLatestSlot
+    {
+      std::vector<char>                     payload;
+      size_t                                size     = 0;
+      long long                             id       = 0;
+      long long                             time     = 0;
+      long long                             clock    = 0;
+      long long                             sequence = 0;
+      std::chrono::steady_clock::time_point receive_time;
+    };
+    std::unique_ptr<Util::CTripleBuffer<SLatestSlot>> m_latest_buffer;
+    std::atomic<bool>                         m_latest_mode;
+    std::atomic<bool>                         m_latest_received;
+    long long                                 m_latest_read_sequence;
+
     using EventCallbackMapT = std::map<eCAL_Subscriber_Event, SubEventCallbackT>;
     std::mutex                                m_event_callback_map_sync;
     EventCallbackMapT                         m_event_callback_map;
@@ -141,12 +174,19 @@ namespace eCAL
     std::chrono::steady_clock::time_point     m_rec_time;
     long                                      m_freq;
 
-    std::set<long long>                       m_id_set;
+    // sample filter, advertised to the publishers and applied to the received samples
+    mutable std::mutex                        m_filter_sync;
+    SSampleFilter                             m_filter;
+    std::atomic<bool>                         m_filter_active;
+    std::unordered_map<std::string, long long> m_filter_last_time;
 
     using WriterCounterMapT = std::unordered_map<std::string, long long>;
     WriterCounterMapT                         m_writer_counter_map;
     long long                                 m_message_drops;
 
+    Util::CLatencyHistogram                   m_delivery_latency;
+    Util::CLatencyHistogram                   m_callback_latency;
+
     std::atomic<bool>                         m_loc_published;
     std::atomic<bool>                         m_ext_published;
 
@@ -157,6 +197,9 @@ namespace eCAL
     bool                                      m_use_shm_confirmed;
     bool                                      m_use_tcp_confirmed;
 
+    std::atomic<std::chrono::microseconds::rep> m_shm_spin_budget_us;
+    std::atomic<bool>                         m_shm_hold_samples;
+
     std::atomic<bool>                         m_created;
   };
 }
@@ -25,6 +25,7 @@
 
 #include "serialization/ecal_struct_sample_registration.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -38,7 +39,10 @@ namespace eCAL
     std::string                 process_id;
     std::string                 topic_name;
     std::string                 topic_id;
+    std::string                 reader_id;              // reader side, topic id of the subscribing data reader
     Registration::ConnectionPar parameter;
+    std::chrono::microseconds   shm_spin_budget{ 0 };   // reader side option, shm receive busy poll budget
+    bool                        shm_hold_samples = false; // reader side option, hold shm samples instead of copying them
   };
 
   // ecal data layer base class
@@ -0,0 +1,70 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  sample filter requested by a subscriber (sample ids, maximum frequency)
+**/
+
+#pragma once
+
+#include "serialization/ecal_struct_sample_registration.h"
+
+#include <set>
+
+namespace eCAL
+{
+  struct SSampleFilter
+  {
+    std::set<long long> ids;            //!< accepted sample ids (empty = all ids)
+    int32_t             max_freq = 0;   //!< maximum sample frequency [mHz] (0 = unlimited)
+
+    bool IsActive() const { return !ids.empty() || (max_freq > 0); }
+
+    // checks a sample against the filter, last_time_ is the time stamp of the last accepted sample of the connection [us]
+    bool Accept(long long id_, long long time_, long long& last_time_) const
+    {
+      if (!ids.empty() && (ids.find(id_) == ids.end())) return false;
+
+      if (max_freq > 0)
+      {
+        const long long period = 1000LL * 1000LL * 1000LL / max_freq;
+        // a time stamp running backwards restarts the rate limitation
+        if ((last_time_ != 0) && (time_ >= last_time_) && (time_ - last_time_ < period)) return false;
+        last_time_ = time_;
+      }
+      return true;
+    }
+
+    static SSampleFilter FromRegistration(const Registration::TopicFilter& filter_)
+    {
+      SSampleFilter filter;
+      filter.ids.insert(filter_.ids.begin(), filter_.ids.end());
+      filter.max_freq = filter_.max_freq;
+      return filter;
+    }
+
+    Registration::TopicFilter ToRegistration() const
+    {
+      Registration::TopicFilter filter;
+      filter.ids.assign(ids.begin(), ids.end());
+      filter.max_freq = max_freq;
+      return filter;
+    }
+  };
+}
@@ -37,9 +37,38 @@
 #include "ecal_writer_buffer_payload.h"
 
 #include "pubsub/ecal_pubgate.h"
+#include "util/ecal_lz_codec.h"
 
 #include <sstream>
 #include <chrono>
+#include <functional>
+#include <future>
+#include <list>
+#include <vector>
+
+namespace
+{
+  eCAL::Registration::LatencyHistogram RegistrationLatencyHistogram(const eCAL::Monitoring::SLatencyMon& latency_)
+  {
+    eCAL::Registration::LatencyHistogram histogram;
+    histogram.count = latency_.count;
+    histogram.min   = latency_.min;
+    histogram.max   = latency_.max;
+    histogram.mean  = latency_.mean;
+    histogram.p50   = latency_.p50;
+    histogram.p90   = latency_.p90;
+    histogram.p99   = latency_.p99;
+    histogram.p999  = latency_.p999;
+    return histogram;
+  }
+
+  void ApplyQueueStatistics(const eCAL::Util::SBoundedQueueStatistics& statistics_, eCAL::Registration::TLayer& tlayer_)
+  {
+    tlayer_.queue_depth     = static_cast<int32_t>(statistics_.depth);
+    tlayer_.queue_max_depth = static_cast<int32_t>(statistics_.max_depth);
+    tlayer_.queue_drops     = statistics_.drops;
+  }
+}
 
 struct SSndHash
 {
@@ -74,6 +103,8 @@ namespace eCAL
     m_zero_copy(PUB_MEMFILE_ZERO_COPY),
     m_acknowledge_timeout_ms(PUB_MEMFILE_ACK_TO),
     m_connected(false),
+    m_sub_filter_active(false),
+    m_sub_compression(true),
     m_id(0),
     m_clock(0),
     m_clock_old(0),
@@ -84,6 +115,11 @@ namespace eCAL
     m_use_tdesc(true),
     m_share_ttype(-1),
     m_share_tdesc(-1),
+    m_lazy_layer_creation(PUB_LAZY_LAYER_CREATION != 0),
+    m_parallel_layer_creation(PUB_PARALLEL_LAYER_CREATION != 0),
+    m_async_net_send(PUB_ASYNC_NET_SEND != 0),
+    m_filter_shm(PUB_MEMFILE_SUBSCRIBER_FILTER != 0),
+    m_compression(TLayer::compression_none),
     m_created(false)
   {
     // initialize layer modes with configuration settings
@@ -139,29 +175,33 @@ namespace eCAL
     // allow to share topic description
     m_use_tdesc = Config::IsTopicDescriptionSharingEnabled();
 
+    // transport layer creation strategy
+    m_lazy_layer_creation     = Config::IsLazyLayerCreationEnabled();
+    m_parallel_layer_creation = Config::IsParallelLayerCreationEnabled();
+
+    // send the network layers from background threads
+    m_async_net_send = Config::IsAsyncNetSendEnabled();
+
+    // skip shm writes no local subscriber filter accepts
+    m_filter_shm = Config::IsMemfileSubscriberFilterEnabled();
+
     // register
     Register(false);
 
     // mark as created
     m_created = true;
 
-    // create udp multicast layer
-    SetUseUdpMC(m_writer.udp_mc_mode.requested);
-
-    // create shm layer
-    SetUseShm(m_writer.shm_mode.requested);
-
-    // create tcp layer
-    SetUseTcp(m_writer.tcp_mode.requested);
+    // create transport layers now or on the first matching subscription
+    if (!m_lazy_layer_creation)
+    {
+      CreateLayers(true, true, true);
+    }
 
 #ifndef NDEBUG
     // log it
     Logging::Log(log_level_debug1, m_topic_name + "::CDataWriter::Created");
 #endif
 
-    // adapt number of used memory file
-    ShmSetBufferCount(m_buffering_shm);
-
     return(true);
   }
 
@@ -174,6 +214,14 @@ namespace eCAL
     Logging::Log(log_level_debug1, m_topic_name + "::CDataWriter::Destroy");
 #endif
 
+    // send the queued network layer samples and stop the background senders
+#if ECAL_CORE_TRANSPORT_UDP
+    m_writer.udp_mc_async.Stop();
+#endif
+#if ECAL_CORE_TRANSPORT_TCP
+    m_writer.tcp_async.Stop();
+#endif
+
     // destroy udp multicast writer
 #if ECAL_CORE_TRANSPORT_UDP
     m_writer.udp_mc.Destroy();
@@ -189,6 +237,13 @@ namespace eCAL
     m_writer.tcp.Destroy();
 #endif
 
+    {
+      const std::lock_guard<std::mutex> lock(m_layer_sync);
+      m_writer.udp_mc_mode.created = false;
+      m_writer.shm_mode.created    = false;
+      m_writer.tcp_mode.created    = false;
+    }
+
     // reset defaults
     m_id                     = 0;
     m_clock                  = 0;
@@ -205,6 +260,7 @@ namespace eCAL
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
       m_loc_sub_map.clear();
       m_ext_sub_map.clear();
+      m_sub_filter_active = false;
     }
 
     // reset event callback map
@@ -297,6 +353,15 @@ namespace eCAL
     }
   }
 
+  void CDataWriter::SetCompression(TLayer::eCompression compression_)
+  {
+    m_compression = compression_;
+
+    // check if the connected subscribers can decode the new codec
+    const std::lock_guard<std::mutex> lock(m_sub_map_sync);
+    UpdateSubscriberStates();
+  }
+
   bool CDataWriter::SetLayerMode(TLayer::eTransportLayer layer_, TLayer::eSendMode mode_)
   {
     switch (layer_)
@@ -321,6 +386,21 @@ namespace eCAL
     return true;
   }
 
+  bool CDataWriter::IsLayerCreated(TLayer::eTransportLayer layer_) const
+  {
+    switch (layer_)
+    {
+    case TLayer::tlayer_udp_mc:
+      return m_writer.udp_mc_mode.created;
+    case TLayer::tlayer_shm:
+      return m_writer.shm_mode.created;
+    case TLayer::tlayer_tcp:
+      return m_writer.tcp_mode.created;
+    default:
+      return false;
+    }
+  }
+
   bool CDataWriter::ShmSetBufferCount(size_t buffering_)
   {
 #if ECAL_CORE_TRANSPORT_SHM
@@ -332,7 +412,7 @@ namespace eCAL
     m_buffering_shm = static_cast<size_t>(buffering_);
 
     // adapt number of used memory files
-    if (m_created)
+    if (m_writer.shm_mode.created)
     {
       m_writer.shm.SetBufferCount(buffering_);
     }
@@ -402,7 +482,65 @@ namespace eCAL
     return(true);
   }
 
-  size_t CDataWriter::Write(CPayloadWriter& payload_, long long time_, long long id_)
+  size_t CDataWriter::Write(CPayloadWriter& payload_, long long time_, long long id_, bool defer_sync_ /* = false */)
+  {
+    return WriteLayers(payload_, time_, id_, defer_sync_, nullptr);
+  }
+
+  bool CDataWriter::Loan(size_t len_, SWriterLoan& loan_)
+  {
+    loan_ = SWriterLoan();
+    if (!m_created) return false;
+
+#if ECAL_CORE_TRANSPORT_SHM
+    // loan the next free memory file, the payload is produced in place
+    if (m_writer.shm_mode.activated)
+    {
+      struct SWriterAttr wattr;
+      wattr.len       = len_;
+      wattr.buffering = m_buffering_shm;
+
+      // prepare send
+      if (m_writer.shm.PrepareWrite(wattr))
+      {
+        // register new to update listening subscribers and rematch
+        Register(true);
+        Process::SleepMS(5);
+      }
+
+      loan_.data = m_writer.shm.Loan(wattr, loan_.shm_idx);
+      loan_.shm  = (loan_.data != nullptr);
+    }
+#endif // ECAL_CORE_TRANSPORT_SHM
+
+    // no memory file available (shm layer off, all memory files loaned) -> heap buffer
+    if (!loan_.shm)
+    {
+      loan_.buffer.resize(len_);
+      loan_.data = loan_.buffer.data();
+    }
+    loan_.len = len_;
+
+    return true;
+  }
+
+  size_t CDataWriter::Commit(SWriterLoan& loan_, long long time_, long long id_)
+  {
+    CBufferPayloadWriter payload{ loan_.data, loan_.len };
+    const size_t written_bytes = WriteLayers(payload, time_, id_, false, &loan_);
+    Discard(loan_);
+    return written_bytes;
+  }
+
+  void CDataWriter::Discard(SWriterLoan& loan_)
+  {
+#if ECAL_CORE_TRANSPORT_SHM
+    if (loan_.shm) m_writer.shm.Discard(loan_.shm_idx);
+#endif // ECAL_CORE_TRANSPORT_SHM
+    loan_ = SWriterLoan();
+  }
+
+  size_t CDataWriter::WriteLayers(CPayloadWriter& payload_, long long time_, long long id_, bool defer_sync_, const SWriterLoan* loan_)
   {
     // check writer modes
     if (!CheckWriterModes())
@@ -411,34 +549,43 @@ namespace eCAL
       return 0;
     }
 
-    // get payload buffer size (one time, to avoid multiple computations)
-    const size_t payload_buf_size(payload_.GetSize());
-
-    // can we do a zero copy write ?
-    const bool allow_zero_copy =
-      m_zero_copy                       // zero copy mode activated by user
-   && m_writer.shm_mode.activated       // shm layer active
-   && !m_writer.udp_mc_mode.activated
-   && !m_writer.tcp_mode.activated;
-
-    // create a payload copy for all layer
-    if (!allow_zero_copy)
+    // lazy mode, layers switched on without any subscription are created on the first write
+    // and registered new to publish their connection parameters
+    if (CreateLayers(m_writer.udp_mc_mode.requested == TLayer::smode_on
+                   , m_writer.shm_mode.requested    == TLayer::smode_on
+                   , m_writer.tcp_mode.requested    == TLayer::smode_on))
     {
-      m_payload_buffer.resize(payload_buf_size);
-      payload_.WriteFull(m_payload_buffer.data(), m_payload_buffer.size());
+      Register(true);
     }
 
+    // get payload buffer size (one time, to avoid multiple computations)
+    const size_t payload_buf_size(payload_.GetSize());
+
     // prepare counter and internal states
     const size_t snd_hash = PrepareWrite(id_, payload_buf_size);
 
-    // did we write anything
-    bool written(false);
+    // subscriber sample filters (ids, maximum frequency), the layers are skipped if no subscriber
+    // receiving on them accepts the sample
+    bool shm_accepted(true);
+    bool net_accepted(true);
+    if (m_sub_filter_active) ApplySubscriberFilters(id_, time_, shm_accepted, net_accepted);
+    const bool shm_filtered = !shm_accepted && m_filter_shm;
+    const bool net_filtered = !net_accepted;
+
+    // the payload is serialized only once, straight into the memory file if the shm layer is active,
+    // the network layers send it from there (or from the payload buffer if there is no shm write)
+    const bool net_layer_active = (m_writer.udp_mc_mode.activated || m_writer.tcp_mode.activated) && !net_filtered;
+    const char* net_payload(nullptr);
+
+    // did we write anything (a sample no subscriber accepts counts as delivered)
+    bool written(net_filtered && (shm_filtered || !m_writer.shm_mode.activated));
 
     ////////////////////////////////////////////////////////////////////////////
     // SHM
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_SHM
-    if (m_writer.shm_mode.activated)
+    const bool shm_loan = (loan_ != nullptr) && loan_->shm;
+    if ((m_writer.shm_mode.activated || shm_loan) && !shm_filtered)
     {
 #ifndef NDEBUG
       // log it
@@ -458,30 +605,30 @@ namespace eCAL
         wattr.buffering              = m_buffering_shm;
         wattr.zero_copy              = m_zero_copy;
         wattr.acknowledge_timeout_ms = m_acknowledge_timeout_ms;
+        wattr.defer_sync             = defer_sync_;
 
-        // prepare send
-        if (m_writer.shm.PrepareWrite(wattr))
-        {
-          // register new to update listening subscribers and rematch
-          Register(true);
-          Process::SleepMS(5);
-        }
-
-        // we are the only active layer, and we support zero copy -> we do a zero copy write via payload
-        if (allow_zero_copy)
+        // a loaned payload is in its memory file already
+        if (shm_loan)
         {
-          // write to shm layer (write content into the opened memory file without additional copy)
-          shm_sent = m_writer.shm.Write(payload_, wattr);
+          shm_sent = m_writer.shm.Commit(loan_->shm_idx, wattr);
         }
-        // multiple layer are active -> we make a copy and use that one
         else
         {
-          // wrap the buffer into a payload object
-          CBufferPayloadWriter payload_buf(m_payload_buffer.data(), m_payload_buffer.size());
+          // prepare send
+          if (m_writer.shm.PrepareWrite(wattr))
+          {
+            // register new to update listening subscribers and rematch
+            Register(true);
+            Process::SleepMS(5);
+          }
+
           // write to shm layer (write content into the opened memory file without additional copy)
-          shm_sent = m_writer.shm.Write(payload_buf, wattr);
+          shm_sent = m_writer.shm.Write(payload_, wattr);
         }
 
+        // the network layers read the written content from the memory file
+        if (shm_sent && net_layer_active) net_payload = m_writer.shm.GetWrittenPayload(payload_buf_size);
+
         m_writer.shm_mode.confirmed = true;
       }
       written |= shm_sent;
@@ -500,11 +647,35 @@ namespace eCAL
     }
 #endif // ECAL_CORE_TRANSPORT_SHM
 
+    // no shm write -> serialize the payload for the network layers into the payload buffer
+    if (net_layer_active && (net_payload == nullptr))
+    {
+      m_payload_buffer.resize(payload_buf_size);
+      if (!payload_.WriteFull(m_payload_buffer.data(), m_payload_buffer.size()))
+      {
+        Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Send - payload serialization FAILED");
+        return written ? payload_buf_size : 0;
+      }
+      net_payload = m_payload_buffer.data();
+    }
+
+    // compress the payload once for both network layers if all subscribers can decode it
+    // (payloads not getting smaller are sent uncompressed)
+    size_t net_payload_size(payload_buf_size);
+    int    net_compression(TLayer::compression_none);
+    if (net_layer_active && (m_compression != TLayer::compression_none) && m_sub_compression
+      && Util::LzCodec::Compress(net_payload, payload_buf_size, m_compression_buffer))
+    {
+      net_payload      = m_compression_buffer.data();
+      net_payload_size = m_compression_buffer.size();
+      net_compression  = m_compression;
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     // UDP (MC)
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_UDP
-    if (m_writer.udp_mc_mode.activated)
+    if (m_writer.udp_mc_mode.activated && !net_filtered)
     {
 #ifndef NDEBUG
       // log it
@@ -524,12 +695,13 @@ namespace eCAL
 
         // fill writer data
         struct SWriterAttr wattr;
-        wattr.len       = payload_buf_size;
-        wattr.id        = m_id;
-        wattr.clock     = m_clock;
-        wattr.hash      = snd_hash;
-        wattr.time      = time_;
-        wattr.loopback  = loopback;
+        wattr.len         = net_payload_size;
+        wattr.id          = m_id;
+        wattr.clock       = m_clock;
+        wattr.hash        = snd_hash;
+        wattr.time        = time_;
+        wattr.loopback    = loopback;
+        wattr.compression = net_compression;
 
         // prepare send
         if (m_writer.udp_mc.PrepareWrite(wattr))
@@ -539,8 +711,9 @@ namespace eCAL
           Process::SleepMS(5);
         }
 
-        // write to udp multicast layer
-        udp_mc_sent = m_writer.udp_mc.Write(m_payload_buffer.data(), wattr);
+        // write to udp multicast layer (or queue it for the background sender)
+        if (m_async_net_send) udp_mc_sent = m_writer.udp_mc_async.Write(net_payload, wattr);
+        else                  udp_mc_sent = m_writer.udp_mc.Write(net_payload, wattr);
         m_writer.udp_mc_mode.confirmed = true;
       }
       written |= udp_mc_sent;
@@ -563,7 +736,7 @@ namespace eCAL
     // TCP
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_TCP
-    if (m_writer.tcp_mode.activated)
+    if (m_writer.tcp_mode.activated && !net_filtered)
     {
 #ifndef NDEBUG
       // log it
@@ -575,14 +748,16 @@ namespace eCAL
       {
         // fill writer data
         struct SWriterAttr wattr;
-        wattr.len   = payload_buf_size;
-        wattr.id    = m_id;
-        wattr.clock = m_clock;
-        wattr.hash  = snd_hash;
-        wattr.time  = time_;
-
-        // write to tcp layer
-        tcp_sent = m_writer.tcp.Write(m_payload_buffer.data(), wattr);
+        wattr.len         = net_payload_size;
+        wattr.id          = m_id;
+        wattr.clock       = m_clock;
+        wattr.hash        = snd_hash;
+        wattr.time        = time_;
+        wattr.compression = net_compression;
+
+        // write to tcp layer (or queue it for the background sender)
+        if (m_async_net_send) tcp_sent = m_writer.tcp_async.Write(net_payload, wattr);
+        else                  tcp_sent = m_writer.tcp.Write(net_payload, wattr);
         m_writer.tcp_mode.confirmed = true;
       }
       written |= tcp_sent;
@@ -606,14 +781,46 @@ namespace eCAL
     else         return 0;
   }
 
-  void CDataWriter::ApplyLocSubscription(const SLocalSubscriptionInfo& local_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_)
+  void CDataWriter::SignalContent()
+  {
+    // signal the shm writes done with defer_sync_ to the local subscribers
+#if ECAL_CORE_TRANSPORT_SHM
+    if (m_writer.shm_mode.activated)
+    {
+      m_writer.shm.SignalContent();
+    }
+#endif
+  }
+
+  void CDataWriter::WaitForAcknowledges()
+  {
+    // wait for the local subscribers acknowledging the signaled shm writes
+#if ECAL_CORE_TRANSPORT_SHM
+    if (m_writer.shm_mode.activated)
+    {
+      m_writer.shm.WaitForAcknowledges();
+    }
+#endif
+  }
+
+  void CDataWriter::ApplyLocSubscription(const SLocalSubscriptionInfo& local_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_, const SSampleFilter& filter_, int compression_, bool shm_layer_)
   {
     Connect(local_info_.topic_id, tinfo_);
 
+    // lazy mode, a local subscriber reads the memory file if it announces the shm layer,
+    // otherwise it receives on the network layers (loopback), only these are created
+    // and registered new to publish their connection parameters
+    const bool shm_layer = shm_layer_ && (m_writer.shm_mode.requested != TLayer::smode_off);
+    if (CreateLayers(!shm_layer, shm_layer, !shm_layer)) Register(true);
+
     // add key to local subscriber map
     {
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
-      m_loc_sub_map[local_info_] = true;
+      auto& sub_state       = m_loc_sub_map[local_info_];
+      sub_state.filter      = filter_;
+      sub_state.compression = compression_;
+      sub_state.shm_layer   = shm_layer_;
+      UpdateSubscriberStates();
     }
 
     m_loc_subscribed = true;
@@ -641,6 +848,7 @@ namespace eCAL
     {
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
       m_loc_sub_map.erase(local_info_);
+      UpdateSubscriberStates();
     }
 
     // remove a local subscription
@@ -660,14 +868,21 @@ namespace eCAL
 #endif
   }
 
-  void CDataWriter::ApplyExtSubscription(const SExternalSubscriptionInfo& external_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_)
+  void CDataWriter::ApplyExtSubscription(const SExternalSubscriptionInfo& external_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_, const SSampleFilter& filter_, int compression_)
   {
     Connect(external_info_.topic_id, tinfo_);
 
+    // lazy mode, an external subscriber receives on the network layers, only these are created
+    // and registered new to publish their connection parameters
+    if (CreateLayers(true, false, true)) Register(true);
+
     // add key to external subscriber map
     {
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
-      m_ext_sub_map[external_info_] = true;
+      auto& sub_state       = m_ext_sub_map[external_info_];
+      sub_state.filter      = filter_;
+      sub_state.compression = compression_;
+      UpdateSubscriberStates();
     }
 
     m_ext_subscribed = true;
@@ -695,6 +910,7 @@ namespace eCAL
     {
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
       m_ext_sub_map.erase(external_info_);
+      UpdateSubscriberStates();
     }
 
     // remove external subscription
@@ -743,15 +959,25 @@ namespace eCAL
     Register(false);
 
     // check connection timeouts
+    std::list<SLocalSubscriptionInfo> loc_expired;
     {
       const std::lock_guard<std::mutex> lock(m_sub_map_sync);
-      m_loc_sub_map.remove_deprecated();
+      m_loc_sub_map.remove_deprecated(&loc_expired);
       m_ext_sub_map.remove_deprecated();
 
       m_loc_subscribed = !m_loc_sub_map.empty();
       m_ext_subscribed = !m_ext_sub_map.empty();
+      UpdateSubscriberStates();
     }
 
+#if ECAL_CORE_TRANSPORT_SHM
+    // expired subscribers may have crashed with samples held
+    for (const auto& loc_info : loc_expired)
+    {
+      m_writer.shm.RemLocConnection(loc_info.process_id, loc_info.topic_id);
+    }
+#endif
+
     if (!m_loc_subscribed && !m_ext_subscribed)
     {
       Disconnect();
@@ -767,6 +993,15 @@ namespace eCAL
     g_process_wclock++;
   }
 
+  Monitoring::STopicLatencyMon CDataWriter::GetLatency() const
+  {
+    Monitoring::STopicLatencyMon latency;
+#if ECAL_CORE_TRANSPORT_SHM
+    latency.shm_lock = m_writer.shm.GetLockLatency();
+#endif
+    return(latency);
+  }
+
   std::string CDataWriter::Dump(const std::string& indent_ /* = "" */)
   {
     std::stringstream out;
@@ -784,7 +1019,11 @@ namespace eCAL
     out << indent_ << "m_topic_info.desc:        " << m_topic_info.descriptor << std::endl;
     out << indent_ << "m_id:                     " << m_id << std::endl;
     out << indent_ << "m_clock:                  " << m_clock << std::endl;
+    out << indent_ << "m_compression:            " << m_compression << std::endl;
     out << indent_ << "m_created:                " << m_created << std::endl;
+    out << indent_ << "udp_mc_mode.created:      " << m_writer.udp_mc_mode.created << std::endl;
+    out << indent_ << "shm_mode.created:         " << m_writer.shm_mode.created << std::endl;
+    out << indent_ << "tcp_mode.created:         " << m_writer.tcp_mode.created << std::endl;
     out << indent_ << "m_loc_subscribed:         " << m_loc_subscribed << std::endl;
     out << indent_ << "m_ext_subscribed:         " << m_ext_subscribed << std::endl;
     out << std::endl;
@@ -845,6 +1084,8 @@ namespace eCAL
       udp_tlayer.version                   = 1;
       udp_tlayer.confirmed                 = m_writer.udp_mc_mode.confirmed;
       udp_tlayer.par_layer.layer_par_udpmc = m_writer.udp_mc.GetConnectionParameter().layer_par_udpmc;
+      udp_tlayer.par_layer.layer_par_udpmc.compression = m_compression;
+      ApplyQueueStatistics(m_writer.udp_mc_async.GetStatistics(), udp_tlayer);
       ecal_reg_sample_topic.tlayer.push_back(udp_tlayer);
     }
 #endif
@@ -869,6 +1110,8 @@ namespace eCAL
       tcp_tlayer.version                 = 1;
       tcp_tlayer.confirmed               = m_writer.tcp_mode.confirmed;
       tcp_tlayer.par_layer.layer_par_tcp = m_writer.tcp.GetConnectionParameter().layer_par_tcp;
+      tcp_tlayer.par_layer.layer_par_tcp.compression = m_compression;
+      ApplyQueueStatistics(m_writer.tcp_async.GetStatistics(), tcp_tlayer);
       ecal_reg_sample_topic.tlayer.push_back(tcp_tlayer);
     }
 #endif
@@ -880,6 +1123,9 @@ namespace eCAL
     ecal_reg_sample_topic.dclock = m_clock;
     ecal_reg_sample_topic.dfreq  = m_freq;
 
+    // latencies
+    ecal_reg_sample_topic.latency.shm_lock = RegistrationLatencyHistogram(GetLatency().shm_lock);
+
     size_t loc_connections(0);
     size_t ext_connections(0);
     {
@@ -992,12 +1238,75 @@ namespace eCAL
     }
   }
 
+  bool CDataWriter::CreateLayers(bool udp_mc_, bool shm_, bool tcp_)
+  {
+    // only the requested layers not created yet
+    auto missing = [](const SWriter::SWriterMode& mode_) { return (mode_.requested != TLayer::smode_off) && !mode_.created; };
+    if (!(udp_mc_ && missing(m_writer.udp_mc_mode)) && !(shm_ && missing(m_writer.shm_mode)) && !(tcp_ && missing(m_writer.tcp_mode))) return false;
+
+    const std::lock_guard<std::mutex> lock(m_layer_sync);
+    if (!m_created) return false;
+
+    udp_mc_ = udp_mc_ && missing(m_writer.udp_mc_mode);
+    shm_    = shm_    && missing(m_writer.shm_mode);
+    tcp_    = tcp_    && missing(m_writer.tcp_mode);
+    if (!udp_mc_ && !shm_ && !tcp_) return false;
+
+    if (m_parallel_layer_creation)
+    {
+      // every layer allocates its own resources (memory files, sockets, tcp publisher),
+      // so they can be set up concurrently, the first one is created on this thread
+      // (a thread start costs more than a cheap layer, so this only pays off for slow layers)
+      std::vector<std::function<void()>> layer_creators;
+      if (udp_mc_) layer_creators.emplace_back([this] { ApplyUdpMCMode(m_writer.udp_mc_mode.requested); });
+      if (shm_)    layer_creators.emplace_back([this] { ApplyShmMode(m_writer.shm_mode.requested); });
+      if (tcp_)    layer_creators.emplace_back([this] { ApplyTcpMode(m_writer.tcp_mode.requested); });
+
+      std::vector<std::future<void>> layer_futures;
+      for (size_t idx = 1; idx < layer_creators.size(); ++idx)
+      {
+        layer_futures.emplace_back(std::async(std::launch::async, layer_creators[idx]));
+      }
+      layer_creators.front()();
+      for (auto& layer_future : layer_futures) layer_future.wait();
+    }
+    else
+    {
+      if (udp_mc_) ApplyUdpMCMode(m_writer.udp_mc_mode.requested);
+      if (shm_)    ApplyShmMode(m_writer.shm_mode.requested);
+      if (tcp_)    ApplyTcpMode(m_writer.tcp_mode.requested);
+    }
+
+#if ECAL_CORE_TRANSPORT_SHM
+    // adapt number of used memory file
+    if (shm_) m_writer.shm.SetBufferCount(m_buffering_shm);
+#endif
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug2, m_topic_name + "::CDataWriter::CreateLayers");
+#endif
+
+    return true;
+  }
+
   void CDataWriter::SetUseUdpMC(TLayer::eSendMode mode_)
   {
 #if ECAL_CORE_TRANSPORT_UDP
     m_writer.udp_mc_mode.requested = mode_;
     if (!m_created) return;
 
+    // lazy mode, a layer not created yet is created on its first matching subscription or write
+    const std::lock_guard<std::mutex> lock(m_layer_sync);
+    if (m_lazy_layer_creation && !m_writer.udp_mc_mode.created) return;
+
+    ApplyUdpMCMode(mode_);
+#endif // ECAL_CORE_TRANSPORT_UDP
+  }
+
+  void CDataWriter::ApplyUdpMCMode(TLayer::eSendMode mode_)
+  {
+#if ECAL_CORE_TRANSPORT_UDP
     // log send mode
     LogSendMode(mode_, m_topic_name + "::CDataWriter::Create::UDP_MC_SENDMODE::");
 
@@ -1005,8 +1314,11 @@ namespace eCAL
     {
     case TLayer::eSendMode::smode_auto:
     case TLayer::eSendMode::smode_on:
+      m_writer.udp_mc_mode.created = true;
       if (m_writer.udp_mc.Create(m_host_name, m_topic_name, m_topic_id))
       {
+        // (re)start the background sender of the created writer
+        if (m_async_net_send) m_writer.udp_mc_async.Start();
 #ifndef NDEBUG
         Logging::Log(log_level_debug4, m_topic_name + "::CDataWriter::Create::UDP_MC_WRITER - SUCCESS");
 #endif
@@ -1018,7 +1330,10 @@ namespace eCAL
       break;
     case TLayer::eSendMode::smode_none:
     case TLayer::eSendMode::smode_off:
+      // the background sender must not use the writer anymore
+      m_writer.udp_mc_async.Stop();
       m_writer.udp_mc.Destroy();
+      m_writer.udp_mc_mode.created = false;
       break;
     }
 #endif // ECAL_CORE_TRANSPORT_UDP
@@ -1030,6 +1345,17 @@ namespace eCAL
     m_writer.shm_mode.requested = mode_;
     if (!m_created) return;
 
+    // lazy mode, a layer not created yet is created on its first matching subscription or write
+    const std::lock_guard<std::mutex> lock(m_layer_sync);
+    if (m_lazy_layer_creation && !m_writer.shm_mode.created) return;
+
+    ApplyShmMode(mode_);
+#endif // ECAL_CORE_TRANSPORT_SHM
+  }
+
+  void CDataWriter::ApplyShmMode(TLayer::eSendMode mode_)
+  {
+#if ECAL_CORE_TRANSPORT_SHM
     // log send mode
     LogSendMode(mode_, m_topic_name + "::CDataWriter::Create::SHM_SENDMODE::");
 
@@ -1037,6 +1363,7 @@ namespace eCAL
     {
     case TLayer::eSendMode::smode_auto:
     case TLayer::eSendMode::smode_on:
+      m_writer.shm_mode.created = true;
       if (m_writer.shm.Create(m_host_name, m_topic_name, m_topic_id))
       {
 #ifndef NDEBUG
@@ -1051,6 +1378,7 @@ namespace eCAL
     case TLayer::eSendMode::smode_none:
     case TLayer::eSendMode::smode_off:
       m_writer.shm.Destroy();
+      m_writer.shm_mode.created = false;
       break;
     }
 #endif // ECAL_CORE_TRANSPORT_SHM
@@ -1062,6 +1390,19 @@ namespace eCAL
     m_writer.tcp_mode.requested = mode_;
     if (!m_created) return;
 
+    // lazy mode, a layer not created yet is created on its first matching subscription or write
+    const std::lock_guard<std::mutex> lock(m_layer_sync);
+    if (m_lazy_layer_creation && !m_writer.tcp_mode.created) return;
+
+    ApplyTcpMode(mode_);
+#else // ECAL_CORE_TRANSPORT_TCP
+    (void)mode_;
+#endif // ECAL_CORE_TRANSPORT_TCP
+  }
+
+  void CDataWriter::ApplyTcpMode(TLayer::eSendMode mode_)
+  {
+#if ECAL_CORE_TRANSPORT_TCP
     // log send mode
     LogSendMode(mode_, m_topic_name + "::CDataWriter::Create::TCP_SENDMODE::");
 
@@ -1069,8 +1410,11 @@ namespace eCAL
     {
     case TLayer::eSendMode::smode_auto:
     case TLayer::eSendMode::smode_on:
+      m_writer.tcp_mode.created = true;
       if (m_writer.tcp.Create(m_host_name, m_topic_name, m_topic_id))
       {
+        // (re)start the background sender of the created writer
+        if (m_async_net_send) m_writer.tcp_async.Start();
 #ifndef NDEBUG
         Logging::Log(log_level_debug4, m_topic_name + "::CDataWriter::Create::TCP_WRITER - SUCCESS");
 #endif
@@ -1082,7 +1426,10 @@ namespace eCAL
       break;
     case TLayer::eSendMode::smode_none:
     case TLayer::eSendMode::smode_off:
+      // the background sender must not use the writer anymore
+      m_writer.tcp_async.Stop();
       m_writer.tcp.Destroy();
+      m_writer.tcp_mode.created = false;
       break;
     }
 #else // ECAL_CORE_TRANSPORT_TCP
@@ -1219,7 +1566,7 @@ namespace eCAL
     const std::string process_id = Process::GetProcessIDAsString();
     bool is_internal_only(true);
     const std::lock_guard<std::mutex> lock(m_sub_map_sync);
-    for (auto sub : m_loc_sub_map)
+    for (auto&& sub : m_loc_sub_map)
     {
       if (sub.first.process_id != process_id)
       {
@@ -1230,6 +1577,48 @@ namespace eCAL
     return is_internal_only;
   }
 
+  void CDataWriter::UpdateSubscriberStates()
+  {
+    // called with m_sub_map_sync locked
+    bool filter_active(false);
+    bool compression(true);
+    for (auto&& sub : m_loc_sub_map)
+    {
+      filter_active |= sub.second.filter.IsActive();
+      compression   &= sub.second.compression >= m_compression;
+    }
+    for (auto&& sub : m_ext_sub_map)
+    {
+      filter_active |= sub.second.filter.IsActive();
+      compression   &= sub.second.compression >= m_compression;
+    }
+    m_sub_filter_active = filter_active;
+    m_sub_compression   = compression;
+  }
+
+  void CDataWriter::ApplySubscriberFilters(long long id_, long long time_, bool& shm_accepted_, bool& net_accepted_)
+  {
+    // every filter has to see the sample to keep its rate limitation in step with the subscriber
+    shm_accepted_ = false;
+    net_accepted_ = false;
+
+    // local subscribers read the memory file if they announce the shm layer and it is written,
+    // otherwise they receive on the network layers
+    const bool shm_active = m_writer.shm_mode.activated;
+
+    const std::lock_guard<std::mutex> lock(m_sub_map_sync);
+    for (auto&& sub : m_loc_sub_map)
+    {
+      if (!sub.second.filter.Accept(id_, time_, sub.second.last_time)) continue;
+      if (sub.second.shm_layer && shm_active) shm_accepted_ = true;
+      else                                    net_accepted_ = true;
+    }
+    for (auto&& sub : m_ext_sub_map)
+    {
+      if (sub.second.filter.Accept(id_, time_, sub.second.last_time)) net_accepted_ = true;
+    }
+  }
+
   void CDataWriter::LogSendMode(TLayer::eSendMode smode_, const std::string& base_msg_)
   {
 #ifndef NDEBUG
@@ -24,12 +24,16 @@
 #pragma once
 
 #include <ecal/ecal_callback.h>
+#include <ecal/ecal_config.h>
 #include <ecal/ecal_payload_writer.h>
 #include <ecal/ecal_tlayer.h>
 #include <ecal/ecal_types.h>
+#include <ecal/types/monitoring.h>
 
 #include "ecal_def.h"
-#include "util/ecal_expmap.h"
+#include "ecal_sample_filter.h"
+#include "ecal_writer_async.h"
+#include "util/ecal_exphashmap.h"
 
 #if ECAL_CORE_TRANSPORT_UDP
 #include "udp/ecal_writer_udp_mc.h"
@@ -51,6 +55,15 @@
 
 namespace eCAL
 {
+  struct SWriterLoan
+  {
+    char*             data    = nullptr;
+    size_t            len     = 0;
+    bool              shm     = false;  //!< loaned from a memory file (otherwise from the heap buffer)
+    size_t            shm_idx = 0;      //!< index of the loaned memory file
+    std::vector<char> buffer;           //!< heap buffer, used if no memory file could be loaned
+  };
+
   class CDataWriter
   {
   public:
@@ -65,6 +78,21 @@ namespace eCAL
         return std::tie(l.host_name, l.process_id, l.topic_id)
           < std::tie(r.host_name, r.process_id, r.topic_id);
       }
+
+      friend bool operator==(const SExternalSubscriptionInfo& l, const SExternalSubscriptionInfo& r)
+      {
+        return std::tie(l.host_name, l.process_id, l.topic_id)
+          == std::tie(r.host_name, r.process_id, r.topic_id);
+      }
+
+      struct Hash
+      {
+        size_t operator()(const SExternalSubscriptionInfo& info_) const
+        {
+          const std::hash<std::string> hash;
+          return Util::HashCombine(Util::HashCombine(hash(info_.host_name), hash(info_.process_id)), hash(info_.topic_id));
+        }
+      };
     };
 
     struct SLocalSubscriptionInfo
@@ -77,6 +105,21 @@ namespace eCAL
         return std::tie(l.process_id, l.topic_id)
           < std::tie(r.process_id, r.topic_id);
       }
+
+      friend bool operator==(const SLocalSubscriptionInfo& l, const SLocalSubscriptionInfo& r)
+      {
+        return std::tie(l.process_id, l.topic_id)
+          == std::tie(r.process_id, r.topic_id);
+      }
+
+      struct Hash
+      {
+        size_t operator()(const SLocalSubscriptionInfo& info_) const
+        {
+          const std::hash<std::string> hash;
+          return Util::HashCombine(hash(info_.process_id), hash(info_.topic_id));
+        }
+      };
     };
 
     CDataWriter();
@@ -93,6 +136,8 @@ namespace eCAL
     void ShareType(bool state_);
     void ShareDescription(bool state_);
 
+    void SetCompression(TLayer::eCompression compression_);
+
     bool SetLayerMode(TLayer::eTransportLayer layer_, TLayer::eSendMode mode_);
 
     bool ShmSetBufferCount(size_t buffering_);
@@ -104,12 +149,18 @@ namespace eCAL
     bool AddEventCallback(eCAL_Publisher_Event type_, PubEventCallbackT callback_);
     bool RemEventCallback(eCAL_Publisher_Event type_);
 
-    size_t Write(CPayloadWriter& payload_, long long time_, long long id_);
+    size_t Write(CPayloadWriter& payload_, long long time_, long long id_, bool defer_sync_ = false);
+    void SignalContent();
+    void WaitForAcknowledges();
+
+    bool Loan(size_t len_, SWriterLoan& loan_);
+    size_t Commit(SWriterLoan& loan_, long long time_, long long id_);
+    void Discard(SWriterLoan& loan_);
 
-    void ApplyLocSubscription(const SLocalSubscriptionInfo& local_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_);
+    void ApplyLocSubscription(const SLocalSubscriptionInfo& local_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_, const SSampleFilter& filter_, int compression_, bool shm_layer_);
     void RemoveLocSubscription(const SLocalSubscriptionInfo& local_info_);
 
-    void ApplyExtSubscription(const SExternalSubscriptionInfo& external_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_);
+    void ApplyExtSubscription(const SExternalSubscriptionInfo& external_info_, const SDataTypeInformation& tinfo_, const std::string& reader_par_, const SSampleFilter& filter_, int compression_);
     void RemoveExtSubscription(const SExternalSubscriptionInfo& external_info_);
 
     void RefreshRegistration();
@@ -120,6 +171,7 @@ namespace eCAL
     bool IsCreated() const { return(m_created); }
     bool IsSubscribed() const { return(m_loc_subscribed || m_ext_subscribed); }
     bool IsExtSubscribed() const { return(m_ext_subscribed); }
+    bool IsLayerCreated(TLayer::eTransportLayer layer_) const;
     size_t GetSubscriberCount() const
     {
       std::lock_guard<std::mutex> const lock(m_sub_map_sync);
@@ -129,6 +181,8 @@ namespace eCAL
     const std::string& GetTopicName() const { return(m_topic_name); }
     const SDataTypeInformation& GetDataTypeInformation() const { return m_topic_info; }
 
+    Monitoring::STopicLatencyMon GetLatency() const;
+
   protected:
     bool Register(bool force_);
     bool Unregister();
@@ -140,9 +194,17 @@ namespace eCAL
     void SetUseShm(TLayer::eSendMode mode_);
     void SetUseTcp(TLayer::eSendMode mode_);
 
+    bool CreateLayers(bool udp_mc_, bool shm_, bool tcp_);
+    void ApplyUdpMCMode(TLayer::eSendMode mode_);
+    void ApplyShmMode(TLayer::eSendMode mode_);
+    void ApplyTcpMode(TLayer::eSendMode mode_);
+
     bool CheckWriterModes();
+    size_t WriteLayers(CPayloadWriter& payload_, long long time_, long long id_, bool defer_sync_, const SWriterLoan* loan_);
     size_t PrepareWrite(long long id_, size_t len_);
     bool IsInternalSubscribedOnly();
+    void UpdateSubscriberStates();
+    void ApplySubscriberFilters(long long id_, long long time_, bool& shm_accepted_, bool& net_accepted_);
     void LogSendMode(TLayer::eSendMode smode_, const std::string& base_msg_);
 
     std::string                            m_host_name;
@@ -160,14 +222,25 @@ namespace eCAL
     long long                              m_acknowledge_timeout_ms;
 
     std::vector<char>                      m_payload_buffer;
+    std::vector<char>                      m_compression_buffer;
 
     std::atomic<bool>                      m_connected;
 
-    using LocalConnectedMapT    = Util::CExpMap<SLocalSubscriptionInfo, bool>;
-    using ExternalConnectedMapT = Util::CExpMap<SExternalSubscriptionInfo, bool>;
+    struct SSubscriberState
+    {
+      SSampleFilter filter;               //!< sample filter requested by the subscriber
+      long long     last_time   = 0;      //!< time stamp of the last sample accepted by the filter
+      int           compression = 0;      //!< highest payload compression the subscriber decodes
+      bool          shm_layer   = false;  //!< local subscriber announces the shm layer
+    };
+
+    using LocalConnectedMapT    = Util::CExpHashMap<SLocalSubscriptionInfo, SSubscriberState, SLocalSubscriptionInfo::Hash>;
+    using ExternalConnectedMapT = Util::CExpHashMap<SExternalSubscriptionInfo, SSubscriberState, SExternalSubscriptionInfo::Hash>;
     mutable std::mutex                     m_sub_map_sync;
     LocalConnectedMapT                     m_loc_sub_map;
     ExternalConnectedMapT                  m_ext_sub_map;
+    std::atomic<bool>                      m_sub_filter_active;
+    std::atomic<bool>                      m_sub_compression;
 
     using EventCallbackMapT = std::map<eCAL_Publisher_Event, PubEventCallbackT>;
     std::mutex                             m_event_callback_map_sync;
@@ -189,6 +262,7 @@ namespace eCAL
         TLayer::eSendMode requested = TLayer::smode_off;
         bool              activated = false;
         bool              confirmed = false;
+        std::atomic<bool> created{ false };   //!< layer writer created (guarded by m_layer_sync)
       };
 
       SWriterMode                          udp_mc_mode;
@@ -204,6 +278,14 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_TCP
       CDataWriterTCP                       tcp;
 #endif
+
+      // send queues of the network layers, served by one background thread per layer (async_net_send)
+#if ECAL_CORE_TRANSPORT_UDP
+      CDataWriterAsync                     udp_mc_async{ udp_mc, TLayer::tlayer_udp_mc, Config::GetAsyncNetQueueSize(), Config::IsAsyncNetBlockOnOverflowEnabled() };
+#endif
+#if ECAL_CORE_TRANSPORT_TCP
+      CDataWriterAsync                     tcp_async{ tcp, TLayer::tlayer_tcp, Config::GetAsyncNetQueueSize(), Config::IsAsyncNetBlockOnOverflowEnabled() };
+#endif
     };
     SWriter                                m_writer;
 
@@ -211,6 +293,12 @@ namespace eCAL
     bool                                   m_use_tdesc;
     int                                    m_share_ttype;
     int                                    m_share_tdesc;
+    bool                                   m_lazy_layer_creation;
+    bool                                   m_parallel_layer_creation;
+    bool                                   m_async_net_send;
+    bool                                   m_filter_shm;
+    TLayer::eCompression                   m_compression;
+    std::mutex                             m_layer_sync;
     bool                                   m_created;
   };
 }
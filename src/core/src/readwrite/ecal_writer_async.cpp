@@ -0,0 +1,176 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  asynchronous data writer (sends from a background thread)
+**/
+
+#include "ecal_writer_async.h"
+
+#include <algorithm>
+#include <map>
+
+namespace eCAL
+{
+  ////////////////////////////////////////
+  // CDataWriterAsync
+  ////////////////////////////////////////
+  CDataWriterAsync::CDataWriterAsync(CDataWriterBase& writer_, TLayer::eTransportLayer layer_, size_t queue_size_, bool block_on_overflow_) :
+    m_writer(writer_),
+    m_layer(layer_),
+    m_queue(queue_size_, block_on_overflow_ ? Util::CBoundedQueue<SSample>::eOverflowPolicy::block : Util::CBoundedQueue<SSample>::eOverflowPolicy::drop_oldest)
+  {
+  }
+
+  CDataWriterAsync::~CDataWriterAsync()
+  {
+    Stop();
+  }
+
+  void CDataWriterAsync::Start()
+  {
+    const std::lock_guard<std::mutex> lock(m_sender_sync);
+    if (m_sender) return;
+
+    m_queue.Reopen();
+    m_sender = CDataWriterAsyncSender::Acquire(m_layer);
+    m_sender->Add(this);
+  }
+
+  bool CDataWriterAsync::Write(const void* buf_, const SWriterAttr& attr_)
+  {
+    const std::lock_guard<std::mutex> lock(m_sender_sync);
+    if (!m_sender) return false;
+
+    // the sample storage is recycled by the queue, so the payload is copied without allocation in the steady state
+    const char* payload = static_cast<const char*>(buf_);
+    m_write_sample.payload.assign(payload, payload + attr_.len);
+    m_write_sample.attr = attr_;
+    if (!m_queue.Push(m_write_sample)) return false;
+
+    m_sender->Notify();
+    return true;
+  }
+
+  void CDataWriterAsync::Stop()
+  {
+    // wake up a write blocked on the full queue first, it holds the sender lock
+    m_queue.Close();
+
+    std::shared_ptr<CDataWriterAsyncSender> sender;
+    {
+      const std::lock_guard<std::mutex> lock(m_sender_sync);
+      sender = std::move(m_sender);
+    }
+    if (!sender) return;
+
+    // send the samples left behind in order, the send thread is done with this queue
+    sender->Remove(this);
+    while (SendQueued()) {}
+  }
+
+  bool CDataWriterAsync::SendQueued()
+  {
+    if (!m_queue.TryPop(m_send_sample)) return false;
+    m_writer.Write(m_send_sample.payload.data(), m_send_sample.attr);
+    return true;
+  }
+
+  ////////////////////////////////////////
+  // CDataWriterAsyncSender
+  ////////////////////////////////////////
+  std::shared_ptr<CDataWriterAsyncSender> CDataWriterAsyncSender::Acquire(TLayer::eTransportLayer layer_)
+  {
+    static std::mutex                                                           senders_sync;
+    static std::map<TLayer::eTransportLayer, std::weak_ptr<CDataWriterAsyncSender>> senders;
+
+    const std::lock_guard<std::mutex> lock(senders_sync);
+    std::shared_ptr<CDataWriterAsyncSender> sender = senders[layer_].lock();
+    if (!sender)
+    {
+      sender = std::make_shared<CDataWriterAsyncSender>();
+      senders[layer_] = sender;
+    }
+    return sender;
+  }
+
+  CDataWriterAsyncSender::CDataWriterAsyncSender() :
+    m_pending(false),
+    m_stop(false)
+  {
+    m_thread = std::thread(&CDataWriterAsyncSender::SendThread, this);
+  }
+
+  CDataWriterAsyncSender::~CDataWriterAsyncSender()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_notify_sync);
+      m_stop = true;
+    }
+    m_notify_cv.notify_one();
+    m_thread.join();
+  }
+
+  void CDataWriterAsyncSender::Add(CDataWriterAsync* writer_)
+  {
+    const std::lock_guard<std::mutex> lock(m_writers_sync);
+    m_writers.push_back(writer_);
+  }
+
+  void CDataWriterAsyncSender::Remove(CDataWriterAsync* writer_)
+  {
+    const std::lock_guard<std::mutex> lock(m_writers_sync);
+    m_writers.erase(std::remove(m_writers.begin(), m_writers.end(), writer_), m_writers.end());
+  }
+
+  void CDataWriterAsyncSender::Notify()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_notify_sync);
+      m_pending = true;
+    }
+    m_notify_cv.notify_one();
+  }
+
+  void CDataWriterAsyncSender::SendThread()
+  {
+    for (;;)
+    {
+      {
+        std::unique_lock<std::mutex> lock(m_notify_sync);
+        m_notify_cv.wait(lock, [this]() { return m_pending || m_stop; });
+        if (m_stop) return;
+        m_pending = false;
+      }
+
+      // one sample per publisher and round, so a busy publisher does not hold back the others,
+      // publishers can be added or removed between the rounds
+      bool sent(true);
+      while (sent)
+      {
+        const std::lock_guard<std::mutex> lock(m_writers_sync);
+        sent = false;
+        for (auto* writer : m_writers)
+        {
+          sent |= writer->SendQueued();
+        }
+      }
+    }
+  }
+}
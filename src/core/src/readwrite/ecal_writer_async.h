@@ -0,0 +1,115 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  asynchronous data writer (sends from a background thread)
+**/
+
+#pragma once
+
+#include <ecal/ecal_tlayer.h>
+
+#include "ecal_writer_base.h"
+#include "ecal_writer_data.h"
+#include "util/ecal_bounded_queue.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  class CDataWriterAsyncSender;
+
+  class CDataWriterAsync
+  {
+  public:
+    CDataWriterAsync(CDataWriterBase& writer_, TLayer::eTransportLayer layer_, size_t queue_size_, bool block_on_overflow_);
+    ~CDataWriterAsync();
+
+    CDataWriterAsync(const CDataWriterAsync&) = delete;
+    CDataWriterAsync& operator=(const CDataWriterAsync&) = delete;
+
+    // attaches to the send thread of the layer, the layer writer has to be created
+    void Start();
+
+    // copies the payload into the send queue, fails if the sender is not started
+    bool Write(const void* buf_, const SWriterAttr& attr_);
+
+    // sends the queued samples and detaches from the send thread, the layer writer can be destroyed afterwards
+    void Stop();
+
+    Util::SBoundedQueueStatistics GetStatistics() const { return m_queue.GetStatistics(); }
+
+  protected:
+    friend class CDataWriterAsyncSender;
+
+    // sends the oldest queued sample, returns false if there is none
+    bool SendQueued();
+
+    struct SSample
+    {
+      std::vector<char> payload;
+      SWriterAttr       attr;
+    };
+
+    CDataWriterBase&                         m_writer;
+    const TLayer::eTransportLayer            m_layer;
+    Util::CBoundedQueue<SSample>             m_queue;
+    SSample                                  m_write_sample;
+    SSample                                  m_send_sample;
+
+    std::mutex                               m_sender_sync;
+    std::shared_ptr<CDataWriterAsyncSender>  m_sender;
+  };
+
+  // one send thread per network layer serves the queues of all publishers of the process,
+  // it runs as long as one of them is started
+  class CDataWriterAsyncSender
+  {
+  public:
+    static std::shared_ptr<CDataWriterAsyncSender> Acquire(TLayer::eTransportLayer layer_);
+
+    CDataWriterAsyncSender();
+    ~CDataWriterAsyncSender();
+
+    CDataWriterAsyncSender(const CDataWriterAsyncSender&) = delete;
+    CDataWriterAsyncSender& operator=(const CDataWriterAsyncSender&) = delete;
+
+    void Add(CDataWriterAsync* writer_);
+    // the writer is not served anymore when this returns
+    void Remove(CDataWriterAsync* writer_);
+    void Notify();
+
+  protected:
+    void SendThread();
+
+    std::mutex                       m_writers_sync;
+    std::vector<CDataWriterAsync*>   m_writers;
+
+    std::mutex                       m_notify_sync;
+    std::condition_variable          m_notify_cv;
+    bool                             m_pending;
+    bool                             m_stop;
+
+    std::thread                      m_thread;
+  };
+}
@@ -38,5 +38,7 @@ namespace eCAL
     bool         loopback               = false;
     bool         zero_copy              = false;
     long long    acknowledge_timeout_ms = 0;
+    bool         defer_sync             = false;
+    int          compression            = 0;
   };
 }
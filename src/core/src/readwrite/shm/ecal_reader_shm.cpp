@@ -50,17 +50,26 @@ namespace eCAL
           std::placeholders::_5,
           std::placeholders::_6,
           std::placeholders::_7,
-          std::placeholders::_8);
-        g_memfile_pool()->ObserveFile(memfile_name, memfile_event, par_.topic_name, par_.topic_id, Config::GetRegistrationTimeoutMs(), memfile_data_callback);
+          std::placeholders::_8,
+          std::placeholders::_9);
+        g_memfile_pool()->ObserveFile(memfile_name, memfile_event, par_.topic_name, par_.topic_id, par_.reader_id, Config::GetRegistrationTimeoutMs(), par_.shm_spin_budget, par_.shm_hold_samples, memfile_data_callback);
       }
     }
   }
 
-  size_t CSHMReaderLayer::OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_)
+  void CSHMReaderLayer::RemSubscription(const std::string& /*host_name_*/, const std::string& /*topic_name_*/, const std::string& topic_id_)
+  {
+    if (g_memfile_pool() != nullptr)
+    {
+      g_memfile_pool()->RemoveReader(topic_id_);
+    }
+  }
+
+  size_t CSHMReaderLayer::OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, const std::shared_ptr<const void>& hold_)
   {
     if (g_subgate() != nullptr)
     {
-      if (g_subgate()->ApplySample(topic_name_, topic_id_, buf_, len_, id_, clock_, time_, hash_, tl_ecal_shm))
+      if (g_subgate()->ApplySample(topic_name_, topic_id_, buf_, len_, id_, clock_, time_, hash_, tl_ecal_shm, hold_))
       {
         return len_;
       }
@@ -41,11 +41,11 @@ namespace eCAL
 
     void Initialize() override {}
     void AddSubscription(const std::string& /*host_name_*/, const std::string& /*topic_name_*/, const std::string& /*topic_id_*/) override {}
-    void RemSubscription(const std::string& /*host_name_*/, const std::string& /*topic_name_*/, const std::string& /*topic_id_*/) override {}
+    void RemSubscription(const std::string& host_name_, const std::string& topic_name_, const std::string& topic_id_) override;
 
     void SetConnectionParameter(SReaderLayerPar& par_) override;
 
   private:
-    size_t OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_);
+    size_t OnNewShmFileContent(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, const std::shared_ptr<const void>& hold_);
   };
 }
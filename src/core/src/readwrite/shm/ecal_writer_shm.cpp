@@ -28,6 +28,9 @@
 #include "ecal_def.h"
 #include "ecal_writer_shm.h"
 
+#include <cstdint>
+#include <cstdlib>
+
 namespace eCAL
 {
   const std::string CDataWriterSHM::m_memfile_base_name = "ecal_";
@@ -57,6 +60,8 @@ namespace eCAL
     if (m_created) return true;
     m_topic_name = topic_name_;
 
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+
     // init write index and create memory files
     m_write_idx = 0;
 
@@ -65,9 +70,18 @@ namespace eCAL
     m_memory_file_attr.reserve         = Config::GetMemfileOverprovisioningPercentage();
     m_memory_file_attr.timeout_open_ms = PUB_MEMFILE_OPEN_TO;
     m_memory_file_attr.timeout_ack_ms  = Config::GetMemfileAckTimeoutMs();
+    m_memory_file_attr.broadcast_notify = Config::IsMemfileBroadcastNotifyEnabled();
+
+    m_memory_file_attr.map_options.populate       = Config::IsMemfilePopulateEnabled();
+    m_memory_file_attr.map_options.lock           = Config::IsMemfileLockEnabled();
+    m_memory_file_attr.map_options.huge_pages     = Config::GetMemfileHugePagesMode();
+    m_memory_file_attr.map_options.hugetlbfs_path = Config::GetMemfileHugetlbfsPath();
+    m_memory_file_attr.map_options.numa_node      = Config::GetMemfileNumaNode();
+
+    m_memory_file_attr.lock_latency = &m_lock_latency;
 
     // initialize memory file buffer
-    m_created = SetBufferCount(m_buffer_count);
+    m_created = CreateMemoryFiles(m_buffer_count);
 
     return m_created;
   }
@@ -77,12 +91,21 @@ namespace eCAL
     if (!m_created) return true;
     m_created = false;
 
+    const std::lock_guard<std::mutex> lock(m_write_sync);
     m_memory_file_vec.clear();
+    m_loaned.clear();
+    m_loan_count = 0;
 
     return true;
   }
 
   bool CDataWriterSHM::SetBufferCount(size_t buffer_count_)
+  {
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    return CreateMemoryFiles(buffer_count_);
+  }
+
+  bool CDataWriterSHM::CreateMemoryFiles(size_t buffer_count_)
   {
     // no need to adapt anything
     if (m_memory_file_vec.size() == buffer_count_) return true;
@@ -105,8 +128,16 @@ namespace eCAL
       memory_file_size = m_memory_file_attr.min_size;
     }
 
+    // loaned memory files have to stay alive
+    if (m_loan_count != 0)
+    {
+      Logging::Log(log_level_error, m_topic_name + "::CDataWriterSHM::SetBufferCount not possible while memory files are loaned !");
+      return false;
+    }
+
     // create memory file vector
     m_memory_file_vec.clear();
+    m_loaned.assign(buffer_count_, false);
     while (m_memory_file_vec.size() < buffer_count_)
     {
       auto sync_memfile = std::make_shared<CSyncMemoryFile>(m_memfile_base_name, memory_file_size, m_memory_file_attr);
@@ -133,10 +164,12 @@ namespace eCAL
     // connection parameters needed
     bool ret_state(false);
 
-    // adapt number of used memory files if needed
-    if (attr_.buffering != m_buffer_count)
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+
+    // adapt number of used memory files if needed (not while memory files are loaned)
+    if ((attr_.buffering != m_buffer_count) && (m_loan_count == 0))
     {
-      SetBufferCount(attr_.buffering);
+      CreateMemoryFiles(attr_.buffering);
 
       // store new buffer count and flag change
       m_buffer_count = attr_.buffering;
@@ -145,7 +178,20 @@ namespace eCAL
 
     // adapt write index if needed
     m_write_idx %= m_memory_file_vec.size();
-      
+
+    // memory files renewed after a subscriber left need a new registration
+    ret_state |= m_renewed;
+    m_renewed = false;
+
+    // skip loaned memory files and memory files with content held by subscribers
+    for (size_t skipped = 0; (skipped < m_memory_file_vec.size()) && IsBusy(m_write_idx); ++skipped)
+    {
+      m_write_idx = (m_write_idx + 1) % m_memory_file_vec.size();
+    }
+
+    // all memory files are busy, the write fails and the sample is dropped
+    if (IsBusy(m_write_idx)) return ret_state;
+
     // check size and reserve new if needed
     ret_state |= m_memory_file_vec[m_write_idx]->CheckSize(attr_.len);
 
@@ -156,9 +202,13 @@ namespace eCAL
   {
     if (!m_created) return false;
 
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    if (IsBusy(m_write_idx)) return false;
+
     // write content
     const bool force_full_write(m_memory_file_vec.size() > 1);
     const bool sent = m_memory_file_vec[m_write_idx]->Write(payload_, attr_, force_full_write);
+    m_written_idx = m_write_idx;
 
     // and increment file index
     m_write_idx++;
@@ -167,11 +217,92 @@ namespace eCAL
     return sent;
   }
 
+  char* CDataWriterSHM::Loan(const SWriterAttr& attr_, size_t& buffer_idx_)
+  {
+    if (!m_created) return nullptr;
+
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    if (IsBusy(m_write_idx)) return nullptr;
+
+    char* buf = m_memory_file_vec[m_write_idx]->Loan(attr_.len);
+    if (buf == nullptr) return nullptr;
+
+    // the memory file is reserved until the loan is committed or discarded
+    buffer_idx_ = m_write_idx;
+    m_loaned[m_write_idx] = true;
+    m_loan_count++;
+
+    // and increment file index
+    m_write_idx++;
+    m_write_idx %= m_memory_file_vec.size();
+
+    return buf;
+  }
+
+  bool CDataWriterSHM::Commit(size_t buffer_idx_, const SWriterAttr& attr_)
+  {
+    if (!m_created) return false;
+
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    if ((buffer_idx_ >= m_loaned.size()) || !m_loaned[buffer_idx_]) return false;
+
+    m_loaned[buffer_idx_] = false;
+    m_loan_count--;
+
+    const bool sent = m_memory_file_vec[buffer_idx_]->Commit(attr_);
+    m_written_idx = buffer_idx_;
+
+    return sent;
+  }
+
+  void CDataWriterSHM::Discard(size_t buffer_idx_)
+  {
+    if (!m_created) return;
+
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    if ((buffer_idx_ >= m_loaned.size()) || !m_loaned[buffer_idx_]) return;
+
+    // the memory file keeps its empty header, subscribers skip it
+    m_loaned[buffer_idx_] = false;
+    m_loan_count--;
+  }
+
+  const char* CDataWriterSHM::GetWrittenPayload(size_t len_) const
+  {
+    if (!m_created) return nullptr;
+
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    if (m_written_idx >= m_memory_file_vec.size()) return nullptr;
+    return m_memory_file_vec[m_written_idx]->GetWrittenPayload(len_);
+  }
+
+  void CDataWriterSHM::SignalContent()
+  {
+    if (!m_created) return;
+
+    // signal all memory files written with a deferred sync
+    for (auto& memory_file : GetMemoryFiles())
+    {
+      memory_file->SignalPendingContent();
+    }
+  }
+
+  void CDataWriterSHM::WaitForAcknowledges()
+  {
+    if (!m_created) return;
+
+    // without holding the lock, loans can be discarded meanwhile
+    for (auto& memory_file : GetMemoryFiles())
+    {
+      memory_file->WaitForAcknowledges();
+    }
+  }
+
   void CDataWriterSHM::AddLocConnection(const std::string& process_id_, const std::string& /*topic_id_*/, const std::string& /*conn_par_*/)
   {
     if (!m_created) return;
 
-    for (auto& memory_file : m_memory_file_vec)
+    for (auto& memory_file : GetMemoryFiles())
     {
       memory_file->Connect(process_id_);
 #ifndef NDEBUG
@@ -180,13 +311,40 @@ namespace eCAL
     }
   }
 
+  void CDataWriterSHM::RemLocConnection(const std::string& process_id_, const std::string& /*topic_id_*/)
+  {
+    if (!m_created) return;
+
+    // a subscriber that crashed or left with samples held would block these memory files forever,
+    // so replace the ones its process still holds (remaining holders keep reading the old ones)
+    const auto process_id = static_cast<std::uint32_t>(std::strtoul(process_id_.c_str(), nullptr, 10));
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    for (size_t idx = 0; idx < m_memory_file_vec.size(); ++idx)
+    {
+      if (m_loaned[idx] || !m_memory_file_vec[idx]->IsHeldBy(process_id)) continue;
+      if (m_memory_file_vec[idx]->Renew()) m_renewed = true;
+    }
+  }
+
   Registration::ConnectionPar CDataWriterSHM::GetConnectionParameter()
   {
     Registration::ConnectionPar connection_par;
-    for (auto& memory_file : m_memory_file_vec)
+    for (auto& memory_file : GetMemoryFiles())
     {
       connection_par.layer_par_shm.memory_file_list.push_back(memory_file->GetName());
     }
     return connection_par;
   }
+
+  bool CDataWriterSHM::IsBusy(size_t idx_) const
+  {
+    // called with m_write_sync locked
+    return m_loaned[idx_] || m_memory_file_vec[idx_]->IsHeld();
+  }
+
+  std::vector<std::shared_ptr<CSyncMemoryFile>> CDataWriterSHM::GetMemoryFiles() const
+  {
+    const std::lock_guard<std::mutex> lock(m_write_sync);
+    return m_memory_file_vec;
+  }
 }
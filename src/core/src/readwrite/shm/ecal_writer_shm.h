@@ -27,7 +27,9 @@
 #include "io/shm/ecal_memfile_sync.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -50,14 +52,42 @@ namespace eCAL
 
     bool Write(CPayloadWriter& payload_, const SWriterAttr& attr_) override;
 
+    // signal writes done with a deferred sync, then wait for their acknowledges
+    void SignalContent();
+    void WaitForAcknowledges();
+
+    // loaned write into the memory file prepared by PrepareWrite (one loan per memory file),
+    // the payload is filled by the caller between Loan and Commit / Discard without holding a lock,
+    // a loan may be committed or discarded by another thread than the one writing
+    char* Loan(const SWriterAttr& attr_, size_t& buffer_idx_);
+    bool Commit(size_t buffer_idx_, const SWriterAttr& attr_);
+    void Discard(size_t buffer_idx_);
+
+    // payload of the last write, read from the memory file (valid until the next write)
+    const char* GetWrittenPayload(size_t len_) const;
+
     void AddLocConnection(const std::string& process_id_, const std::string& topic_id_, const std::string& conn_par_) override;
+    void RemLocConnection(const std::string& process_id_, const std::string& topic_id_) override;
 
     Registration::ConnectionPar GetConnectionParameter() override;
 
-  protected:      
+    Monitoring::SLatencyMon GetLockLatency() const { return m_lock_latency.GetSummary(); }
+
+  protected:
+    bool CreateMemoryFiles(size_t buffer_count_);
+    bool IsBusy(size_t idx_) const;
+    std::vector<std::shared_ptr<CSyncMemoryFile>> GetMemoryFiles() const;
+
+    // guards the write / loan state and the memory file vector
+    mutable std::mutex                            m_write_sync;
     size_t                                        m_write_idx    = 0;
+    size_t                                        m_written_idx  = 0;
     size_t                                        m_buffer_count = 1;
+    size_t                                        m_loan_count   = 0;
+    bool                                          m_renewed      = false;
+    std::vector<bool>                             m_loaned;
     SSyncMemoryFileAttr                           m_memory_file_attr = {};
+    Util::CLatencyHistogram                       m_lock_latency;
     std::vector<std::shared_ptr<CSyncMemoryFile>> m_memory_file_vec;
     static const std::string                      m_memfile_base_name;
   };
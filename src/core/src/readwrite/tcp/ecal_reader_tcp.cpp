@@ -24,6 +24,8 @@
 #include "ecal_global_accessors.h"
 
 #include <ecal/ecal_config.h>
+#include <ecal/ecal_log.h>
+#include <ecal/ecal_tlayer.h>
 
 #include "pubsub/ecal_subgate.h"
 
@@ -31,6 +33,8 @@
 #include "ecal_reader_tcp.h"
 #include "ecal_tcp_pubsub_logger.h"
 
+#include "util/ecal_lz_codec.h"
+
 #include "ecal_utils/portable_endian.h"
 
 namespace eCAL
@@ -109,12 +113,27 @@ namespace eCAL
         // use this intermediate variables as optimization
         const auto& ecal_header_topic   = m_ecal_header.topic;
         const auto& ecal_header_content = m_ecal_header.content;
+
+        // decode compressed payloads
+        size_t data_size = static_cast<size_t>(ecal_header_content.size);
+        if (ecal_header_content.compression != TLayer::compression_none)
+        {
+          if ((ecal_header_content.compression != TLayer::compression_lz)
+            || !Util::LzCodec::Decompress(data_payload, data_size, m_decompressed_payload))
+          {
+            Logging::Log(log_level_warning, ecal_header_topic.tname + " : failed to decompress tcp payload !");
+            return;
+          }
+          data_payload = m_decompressed_payload.data();
+          data_size    = m_decompressed_payload.size();
+        }
+
         // apply sample
         g_subgate()->ApplySample(
           ecal_header_topic.tname,
           ecal_header_topic.tid,
           data_payload,
-          static_cast<size_t>(ecal_header_content.size),
+          data_size,
           ecal_header_content.id,
           ecal_header_content.clock,
           ecal_header_content.time,
@@ -30,6 +30,8 @@
 
 #include "serialization/ecal_struct_sample_payload.h"
 
+#include <vector>
+
 namespace eCAL
 {
   ////////////////
@@ -49,6 +51,7 @@ namespace eCAL
     void OnTcpMessage(const tcp_pubsub::CallbackData& callback_data);
 
     Payload::Sample                         m_ecal_header;
+    std::vector<char>                       m_decompressed_payload;
 
     std::shared_ptr<tcp_pubsub::Subscriber> m_subscriber;
     bool                                    m_callback_active;
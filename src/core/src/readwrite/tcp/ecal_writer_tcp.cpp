@@ -112,6 +112,7 @@ namespace eCAL
     proto_header_content.time  = attr_.time;
     proto_header_content.hash  = attr_.hash;
     proto_header_content.size  = static_cast<int32_t>(attr_.len); // we use this size attribute for "header only"
+    proto_header_content.compression = attr_.compression;
 
     // Compute size of "ECAL" pre-header
     constexpr size_t ecal_magic_size(4 * sizeof(char));
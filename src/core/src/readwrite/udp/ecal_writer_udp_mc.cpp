@@ -108,6 +108,7 @@ namespace eCAL
     ecal_sample_content.clock            = attr_.clock;
     ecal_sample_content.time             = attr_.time;
     ecal_sample_content.hash             = attr_.hash;
+    ecal_sample_content.compression      = attr_.compression;
     ecal_sample_content.payload.type     = Payload::pl_raw;
     ecal_sample_content.payload.raw_addr = static_cast<const char*>(buf_);
     ecal_sample_content.payload.raw_size = attr_.len;
@@ -34,11 +34,45 @@
 
 #include "io/udp/ecal_udp_configurations.h"
 #include "io/udp/ecal_udp_sample_sender.h"
+#include "io/udp/fragmentation/msg_type.h"
 
+#include <algorithm>
 #include <chrono>
+#include <thread>
 
 namespace
 {
+  // number of threads serializing a registration snapshot, additional threads only pay off
+  // for large snapshots on machines with more than one hardware thread
+  size_t GetSerializationWorkers(size_t sample_count_)
+  {
+    if (CMN_REGISTRATION_SERIALIZE_SAMPLES_PER_WORKER == 0) return 1;
+    const size_t hw_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min<size_t>(hw_threads, sample_count_ / CMN_REGISTRATION_SERIALIZE_SAMPLES_PER_WORKER));
+  }
+
+  // maximum size of a packed sample list, so that it fits into a single udp fragment
+  // (fragment payload minus the sample name size and the zero terminated sample name)
+  constexpr size_t g_max_sample_list_size = MSG_BUFFER_SIZE - sizeof(IO::UDP::SUDPMessageHead) - sizeof(unsigned short) - sizeof(CMN_REGISTRATION_UDP_SAMPLE_LIST_NAME);
+
+  const std::string& GetSampleName(const eCAL::Registration::Sample& sample_)
+  {
+    switch (sample_.cmd_type)
+    {
+    case eCAL::bct_reg_service:
+    case eCAL::bct_unreg_service:
+      return sample_.service.sname;
+    case eCAL::bct_reg_client:
+    case eCAL::bct_unreg_client:
+      return sample_.client.sname;
+    case eCAL::bct_reg_process:
+    case eCAL::bct_unreg_process:
+      return sample_.process.hname;
+    default:
+      return sample_.topic.tname;
+    }
+  }
+
   bool ApplyTopicToDescGate(const std::string& topic_name_, const eCAL::SDataTypeInformation& topic_info_, bool topic_is_a_publisher_)
   {
     if (eCAL::g_descgate() != nullptr)
@@ -87,6 +121,7 @@ namespace eCAL
                     m_reg_services(false),
                     m_reg_process(false),
                     m_use_registration_udp(false),
+                    m_use_registration_udp_sample_list(false),
                     m_use_registration_shm(false)
   {
   }
@@ -109,6 +144,7 @@ namespace eCAL
     // send registration to shared memory and to udp
     m_use_registration_udp = !Config::Experimental::IsNetworkMonitoringDisabled();
     m_use_registration_shm     = Config::Experimental::IsShmMonitoringEnabled();
+    m_use_registration_udp_sample_list = Config::IsRegistrationUdpSampleListEnabled();
 
     if (m_use_registration_udp)
     {
@@ -171,8 +207,12 @@ namespace eCAL
     if (!m_created)    return(false);
     if (!m_reg_topics) return(false);
 
-    const std::lock_guard<std::mutex> lock(m_topics_map_sync);
-    m_topics_map[topic_name_ + topic_id_] = ecal_sample_;
+    {
+      const std::lock_guard<std::mutex> lock(m_topics_map_sync);
+      m_topics_map[topic_name_ + topic_id_] = std::make_shared<const Registration::Sample>(ecal_sample_);
+    }
+
+    // send it without holding the map lock
     if(force_)
     {
       RegisterProcess();
@@ -214,8 +254,12 @@ namespace eCAL
     if (!m_created)      return(false);
     if (!m_reg_services) return(false);
 
-    const std::lock_guard<std::mutex> lock(m_server_map_sync);
-    m_server_map[service_name_ + service_id_] = ecal_sample_;
+    {
+      const std::lock_guard<std::mutex> lock(m_server_map_sync);
+      m_server_map[service_name_ + service_id_] = std::make_shared<const Registration::Sample>(ecal_sample_);
+    }
+
+    // send it without holding the map lock
     if (force_)
     {
       RegisterProcess();
@@ -257,8 +301,12 @@ namespace eCAL
     if (!m_created)      return(false);
     if (!m_reg_services) return(false);
 
-    const std::lock_guard<std::mutex> lock(m_client_map_sync);
-    m_client_map[client_name_ + client_id_] = ecal_sample_;
+    {
+      const std::lock_guard<std::mutex> lock(m_client_map_sync);
+      m_client_map[client_name_ + client_id_] = std::make_shared<const Registration::Sample>(ecal_sample_);
+    }
+
+    // send it without holding the map lock
     if (force_)
     {
       RegisterProcess();
@@ -387,32 +435,35 @@ namespace eCAL
     if (!m_created)    return(false);
     if (!m_reg_topics) return(false);
 
-    bool return_value {true};
-    const std::lock_guard<std::mutex> lock(m_topics_map_sync);
-    for(SampleMapT::const_iterator iter = m_topics_map.begin(); iter != m_topics_map.end(); ++iter)
+    // snapshot the samples, the map is locked while copying the pointers only
+    m_sample_snapshot.clear();
+    {
+      const std::lock_guard<std::mutex> lock(m_topics_map_sync);
+      m_sample_snapshot.reserve(m_topics_map.size());
+      for (const auto& topic : m_topics_map) m_sample_snapshot.push_back(topic.second);
+    }
+
+    for (const auto& sample : m_sample_snapshot)
     {
       //////////////////////////////////////////////
       // update description
       //////////////////////////////////////////////
       // read attributes
-      const std::string topic_name(iter->second.topic.tname);
-      const bool topic_is_a_publisher(iter->second.cmd_type == eCAL::bct_reg_publisher);
+      const bool topic_is_a_publisher(sample->cmd_type == eCAL::bct_reg_publisher);
 
       SDataTypeInformation topic_info;
-      const auto& topic_datatype = iter->second.topic.tdatatype;
+      const auto& topic_datatype = sample->topic.tdatatype;
       topic_info.encoding   = topic_datatype.encoding;
       topic_info.name       = topic_datatype.name;
       topic_info.descriptor = topic_datatype.desc;
 
-      ApplyTopicToDescGate(topic_name, topic_info, topic_is_a_publisher);
-
-      //////////////////////////////////////////////
-      // send sample to registration layer
-      //////////////////////////////////////////////
-      return_value &= ApplySample(iter->second.topic.tname, iter->second);
+      ApplyTopicToDescGate(sample->topic.tname, topic_info, topic_is_a_publisher);
     }
 
-    return return_value;
+    //////////////////////////////////////////////
+    // send samples to registration layer
+    //////////////////////////////////////////////
+    return ApplySamples(m_sample_snapshot);
   }
 
   bool CRegistrationProvider::RegisterServer()
@@ -420,14 +471,20 @@ namespace eCAL
     if (!m_created)      return(false);
     if (!m_reg_services) return(false);
 
-    bool return_value {true};
-    const std::lock_guard<std::mutex> lock(m_server_map_sync);
-    for (SampleMapT::const_iterator iter = m_server_map.begin(); iter != m_server_map.end(); ++iter)
+    // snapshot the samples, the map is locked while copying the pointers only
+    m_sample_snapshot.clear();
+    {
+      const std::lock_guard<std::mutex> lock(m_server_map_sync);
+      m_sample_snapshot.reserve(m_server_map.size());
+      for (const auto& server : m_server_map) m_sample_snapshot.push_back(server.second);
+    }
+
+    for (const auto& sample : m_sample_snapshot)
     {
       //////////////////////////////////////////////
       // update description
       //////////////////////////////////////////////
-      const auto& ecal_sample_service = iter->second.service;
+      const auto& ecal_sample_service = sample->service;
       for (const auto& method : ecal_sample_service.methods)
       {
         SDataTypeInformation request_type;
@@ -440,14 +497,12 @@ namespace eCAL
 
         ApplyServiceToDescGate(ecal_sample_service.sname, method.mname, request_type, response_type);
       }
-
-      //////////////////////////////////////////////
-      // send sample to registration layer
-      //////////////////////////////////////////////
-      return_value &= ApplySample(iter->second.service.sname, iter->second);
     }
 
-    return return_value;
+    //////////////////////////////////////////////
+    // send samples to registration layer
+    //////////////////////////////////////////////
+    return ApplySamples(m_sample_snapshot);
   }
 
   bool CRegistrationProvider::RegisterClient()
@@ -455,15 +510,16 @@ namespace eCAL
     if (!m_created)      return(false);
     if (!m_reg_services) return(false);
 
-    bool return_value {true};
-    const std::lock_guard<std::mutex> lock(m_client_map_sync);
-    for (SampleMapT::const_iterator iter = m_client_map.begin(); iter != m_client_map.end(); ++iter)
+    // snapshot the samples, the map is locked while copying the pointers only
+    m_sample_snapshot.clear();
     {
-      // apply registration sample
-      return_value &= ApplySample(iter->second.client.sname, iter->second);
+      const std::lock_guard<std::mutex> lock(m_client_map_sync);
+      m_sample_snapshot.reserve(m_client_map.size());
+      for (const auto& client : m_client_map) m_sample_snapshot.push_back(client.second);
     }
 
-    return return_value;
+    // apply registration samples
+    return ApplySamples(m_sample_snapshot);
   }
 
   bool CRegistrationProvider::ApplySample(const std::string& sample_name_, const Registration::Sample& sample_)
@@ -492,6 +548,68 @@ namespace eCAL
     return return_value;
   }
 
+  bool CRegistrationProvider::ApplySamples(const SampleSnapshotT& samples_)
+  {
+    if (!m_created) return(false);
+    if (samples_.empty()) return(true);
+
+    bool return_value {true};
+
+    if (m_use_registration_udp && m_reg_sample_snd)
+    {
+      // serialize all samples first (the buffers are reused from cycle to cycle)
+      return_value &= SerializeToBuffers(samples_, m_sample_snapshot_buffers, GetSerializationWorkers(samples_.size()));
+
+      // and send them in one go
+      if (m_use_registration_udp_sample_list)
+      {
+        return_value &= SendSampleListBuffers(samples_.size());
+      }
+      else
+      {
+        for (size_t idx = 0; idx < samples_.size(); ++idx)
+        {
+          return_value &= (m_reg_sample_snd->Send(GetSampleName(*samples_[idx]), m_sample_snapshot_buffers[idx]) != 0);
+        }
+      }
+    }
+
+#if ECAL_CORE_REGISTRATION_SHM
+    if (m_use_registration_shm)
+    {
+      const std::lock_guard<std::mutex> lock(m_sample_list_sync);
+      for (const auto& sample : samples_) m_sample_list.samples.push_back(*sample);
+    }
+#endif
+
+    return return_value;
+  }
+
+  bool CRegistrationProvider::SendSampleListBuffers(size_t sample_count_)
+  {
+    bool return_value {true};
+
+    // pack the serialized samples into sample lists, every list is sent as one udp fragment
+    // (a single sample exceeding the fragment size is sent as a fragmented list of its own)
+    m_sample_list_udp_buffer.clear();
+    for (size_t idx = 0; idx < sample_count_; ++idx)
+    {
+      const std::vector<char>& sample_buffer = m_sample_snapshot_buffers[idx];
+      if (!m_sample_list_udp_buffer.empty() && (m_sample_list_udp_buffer.size() + GetSampleListEntrySize(sample_buffer.size()) > g_max_sample_list_size))
+      {
+        return_value &= (m_reg_sample_snd->Send(CMN_REGISTRATION_UDP_SAMPLE_LIST_NAME, m_sample_list_udp_buffer) != 0);
+        m_sample_list_udp_buffer.clear();
+      }
+      AppendToSampleListBuffer(sample_buffer, m_sample_list_udp_buffer);
+    }
+    if (!m_sample_list_udp_buffer.empty())
+    {
+      return_value &= (m_reg_sample_snd->Send(CMN_REGISTRATION_UDP_SAMPLE_LIST_NAME, m_sample_list_udp_buffer) != 0);
+    }
+
+    return return_value;
+  }
+
   bool CRegistrationProvider::SendSampleList(bool reset_sample_list_)
   {
     if (!m_created) return(false);
@@ -75,7 +75,12 @@ namespace eCAL
     bool RegisterServer();
     bool RegisterClient();
 
+    using SamplePtrT      = std::shared_ptr<const Registration::Sample>;
+    using SampleSnapshotT = std::vector<SamplePtrT>;
+
     bool ApplySample(const std::string& sample_name_, const eCAL::Registration::Sample& sample_);
+    bool ApplySamples(const SampleSnapshotT& samples_);
+    bool SendSampleListBuffers(size_t sample_count_);
       
     void RegisterSendThread();
 
@@ -93,7 +98,13 @@ namespace eCAL
     std::mutex                          m_sample_buffer_sync;
     std::vector<char>                   m_sample_buffer;
 
-    using SampleMapT = std::unordered_map<std::string, Registration::Sample>;
+    // registration refresh pipeline, only used by the registration thread
+    SampleSnapshotT                     m_sample_snapshot;
+    std::vector<std::vector<char>>      m_sample_snapshot_buffers;
+    std::vector<char>                   m_sample_list_udp_buffer;
+
+    // samples are immutable and shared, the refresh copies pointers only
+    using SampleMapT = std::unordered_map<std::string, SamplePtrT>;
     std::mutex                          m_topics_map_sync;
     SampleMapT                          m_topics_map;
 
@@ -113,6 +124,7 @@ namespace eCAL
 #endif
 
     bool                                m_use_registration_udp;
+    bool                                m_use_registration_udp_sample_list;
     bool                                m_use_registration_shm;
   };
 }
@@ -84,7 +84,7 @@ namespace eCAL
       attr.rcvbuf    = Config::GetUdpMulticastRcvBufSizeBytes();
 
       // start registration sample receiver
-      m_registration_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CRegistrationReceiver::HasSample, this, std::placeholders::_1), std::bind(&CRegistrationReceiver::ApplySerializedSample, this, std::placeholders::_1, std::placeholders::_2));
+      m_registration_receiver = std::make_shared<UDP::CSampleReceiver>(attr, std::bind(&CRegistrationReceiver::HasSample, this, std::placeholders::_1), std::bind(&CRegistrationReceiver::ApplySerializedSample, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
     }
 
 #if ECAL_CORE_REGISTRATION_SHM
@@ -139,10 +139,25 @@ namespace eCAL
     m_loopback = state_;
   }
 
-  bool CRegistrationReceiver::ApplySerializedSample(const char* serialized_sample_data_, size_t serialized_sample_size_)
+  bool CRegistrationReceiver::ApplySerializedSample(const std::string& sample_name_, const char* serialized_sample_data_, size_t serialized_sample_size_)
   {
     if(!m_created) return false;
 
+    // packed sample list (registration_udp_sample_list mode of the sender)
+    if (sample_name_ == CMN_REGISTRATION_UDP_SAMPLE_LIST_NAME)
+    {
+      Registration::SampleList ecal_sample_list;
+      if (!DeserializeFromBuffer(serialized_sample_data_, serialized_sample_size_, ecal_sample_list)) return false;
+
+      bool return_value {true};
+      for (const auto& ecal_sample : ecal_sample_list.samples)
+      {
+        return_value &= ApplySample(ecal_sample);
+      }
+      return return_value;
+    }
+
+    // single sample
     Registration::Sample ecal_sample;
     if (!DeserializeFromBuffer(serialized_sample_data_, serialized_sample_size_, ecal_sample)) return false;
 
@@ -59,7 +59,7 @@ namespace eCAL
     void EnableLoopback(bool state_);
 
     bool HasSample(const std::string& /*sample_name_*/) { return(true); };
-    bool ApplySerializedSample(const char* serialized_sample_data_, size_t serialized_sample_size_);
+    bool ApplySerializedSample(const std::string& sample_name_, const char* serialized_sample_data_, size_t serialized_sample_size_);
 
     bool ApplySample(const Registration::Sample& ecal_sample_);
 
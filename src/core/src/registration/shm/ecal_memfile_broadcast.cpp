@@ -35,7 +35,7 @@ namespace eCAL
 #pragma pack(push, 1)
   struct SMemfileBroadcastHeader
   {
-    std::uint32_t version = 1;
+    std::uint32_t version = 2;
     std::uint64_t message_queue_offset = sizeof(SMemfileBroadcastHeader);
     std::int64_t timestamp = CreateTimestamp();
     std::array<uint8_t, 4> _reserved_0 = {};
@@ -57,7 +57,7 @@ namespace eCAL
     return reinterpret_cast<void *>(static_cast<char *>(address) + GetMemfileHeader(address)->message_queue_offset);
   }
 
-  CMemoryFileBroadcast::CMemoryFileBroadcast(): m_created(false), m_max_queue_size(0), m_broadcast_memfile(std::make_unique<eCAL::CMemoryFile>()), m_event_queue(), m_last_timestamp(0)
+  CMemoryFileBroadcast::CMemoryFileBroadcast(): m_created(false), m_max_queue_size(0), m_broadcast_memfile(std::make_unique<eCAL::CMemoryFile>()), m_event_queue(), m_read_index(0)
   {
   }
 
@@ -68,7 +68,7 @@ namespace eCAL
     m_max_queue_size = max_queue_size;
     m_name = name;
     const auto presumably_memfile_size =
-      RelocatableCircularQueue<SMemfileBroadcastEvent>::PresumablyOccupiedMemorySize(m_max_queue_size) +
+      RelocatableEventRing<SMemfileBroadcastEvent>::PresumablyOccupiedMemorySize(m_max_queue_size) +
       sizeof(SMemfileBroadcastHeader);
     if (!m_broadcast_memfile->Create(name.c_str(), true, presumably_memfile_size, true))
     {
@@ -86,8 +86,6 @@ namespace eCAL
       return false;
     }
 
-    m_broadcast_memfile_local_buffer.resize(presumably_memfile_size);
-
     if (m_broadcast_memfile->GetWriteAccess(EXP_MEMFILE_ACCESS_TIMEOUT))
     {
       // Check if memfile is initialized
@@ -154,38 +152,63 @@ namespace eCAL
 #endif
   }
 
-  bool CMemoryFileBroadcast::FlushLocalEventQueue()
+  bool CMemoryFileBroadcast::OpenEventQueue(bool& shared_access)
   {
-    if (!m_created) return false;
-
-    if (m_broadcast_memfile->GetReadAccess(EXP_MEMFILE_ACCESS_TIMEOUT))
+    // lock free access, the event queue slots are validated on their own. locked access is only needed
+    // if the memory file has to be remapped (or a writer is just updating the memory file header)
+    shared_access = m_broadcast_memfile->GetSharedReadAccess();
+    if (!shared_access && !m_broadcast_memfile->GetReadAccess(EXP_MEMFILE_ACCESS_TIMEOUT))
     {
-      // Check if memfile is initialized
-      if (m_broadcast_memfile->CurDataSize())
-      {
-        const void* memfile_address = nullptr;
-        m_broadcast_memfile->GetReadAddress(memfile_address, m_broadcast_memfile->MaxDataSize());
-        m_last_timestamp = GetMemfileHeader(memfile_address)->timestamp;
-        m_broadcast_memfile->ReleaseReadAccess();
-        return true;
-      }
-      else
-      {
 #ifndef NDEBUG
-        std::cerr << "Broadcast memory file is not initialized" << std::endl;
+      std::cerr << "Unable to acquire read access on broadcast memory file" << std::endl;
 #endif
-        m_broadcast_memfile->ReleaseReadAccess();
-        return false;
-      }
+      return false;
+    }
 
+    // Check if memfile is initialized
+    const void* memfile_address = nullptr;
+    if ((m_broadcast_memfile->CurDataSize() < sizeof(SMemfileBroadcastHeader))
+      || (m_broadcast_memfile->GetReadAddress(memfile_address, m_broadcast_memfile->CurDataSize()) == 0)
+      || !IsMemfileVersionCompatible(memfile_address))
+    {
+#ifndef NDEBUG
+      std::cerr << "Broadcast memory file is not initialized" << std::endl;
+#endif
+      CloseEventQueue(shared_access);
+      return false;
     }
-    else
+
+    m_event_queue.SetBaseAddress(GetEventQueueAddress(const_cast<void*>(memfile_address)));
+    if (GetMemfileHeader(memfile_address)->message_queue_offset + m_event_queue.OccupiedMemorySize() > m_broadcast_memfile->CurDataSize())
     {
 #ifndef NDEBUG
-      std::cerr << "Unable to acquire read access on broadcast memory file" << std::endl;
+      std::cerr << "Invalid broadcast memory file size." << std::endl;
 #endif
+      CloseEventQueue(shared_access);
       return false;
     }
+
+    return true;
+  }
+
+  void CMemoryFileBroadcast::CloseEventQueue(bool shared_access)
+  {
+    // the result of the shared access is not of interest, every event is validated by its slot sequence
+    if (shared_access) m_broadcast_memfile->ReleaseSharedReadAccess();
+    else               m_broadcast_memfile->ReleaseReadAccess();
+  }
+
+  bool CMemoryFileBroadcast::FlushLocalEventQueue()
+  {
+    if (!m_created) return false;
+
+    bool shared_access(false);
+    if (!OpenEventQueue(shared_access)) return false;
+
+    m_read_index = m_event_queue.WriteIndex();
+
+    CloseEventQueue(shared_access);
+    return true;
   }
 
   bool CMemoryFileBroadcast::FlushGlobalEventQueue()
@@ -194,10 +217,19 @@ namespace eCAL
 
     if (m_broadcast_memfile->GetWriteAccess(EXP_MEMFILE_ACCESS_TIMEOUT))
     {
-      // Don't need to check consistency since memfile will be resetted anyways
       void *memfile_address = nullptr;
       m_broadcast_memfile->GetWriteAddress(memfile_address, m_broadcast_memfile->MaxDataSize());
-      ResetMemfile(memfile_address);
+
+      // readers access the event queue without locking, so an initialized queue is flushed and not reset
+      if ((m_broadcast_memfile->CurDataSize() != 0) && IsMemfileVersionCompatible(memfile_address))
+      {
+        m_event_queue.SetBaseAddress(GetEventQueueAddress(memfile_address));
+        m_event_queue.Flush();
+      }
+      else
+      {
+        ResetMemfile(memfile_address);
+      }
       m_broadcast_memfile->ReleaseWriteAccess();
     }
     else
@@ -247,49 +279,37 @@ namespace eCAL
 
   bool CMemoryFileBroadcast::ReceiveEvents(MemfileBroadcastEventListT &event_list, std::int64_t timeout, bool enable_loopback)
   {
-    if (m_broadcast_memfile->GetReadAccess(EXP_MEMFILE_ACCESS_TIMEOUT))
-    {
-      // Check if memfile is initialized
-      if (m_broadcast_memfile->CurDataSize())
-      {
-        m_broadcast_memfile->Read(m_broadcast_memfile_local_buffer.data(), m_broadcast_memfile_local_buffer.size(), 0);
-        m_broadcast_memfile->ReleaseReadAccess();
-      }
-      else
-      {
-#ifndef NDEBUG
-        std::cerr << "Broadcast memory file is not initialized" << std::endl;
-#endif
-        m_broadcast_memfile->ReleaseReadAccess();
-        return false;
-      }
-      
-    }
-    else
-    {
-#ifndef NDEBUG
-      std::cerr << "Unable to acquire read access on broadcast memory file" << std::endl;
-#endif
-      return false;
-    }
-
     event_list.clear();
+    m_received_events.clear();
 
-    const auto *header = GetMemfileHeader(m_broadcast_memfile_local_buffer.data());
-    m_event_queue.SetBaseAddress(GetEventQueueAddress(m_broadcast_memfile_local_buffer.data()));
+    bool shared_access(false);
+    if (!OpenEventQueue(shared_access)) return false;
 
+    // only the events pushed since the last call are read, events overwritten in the meantime are lost
+    const auto write_index = m_event_queue.WriteIndex();
+    const auto first_index = m_event_queue.FirstReadableIndex();
+    if ((m_read_index < first_index) || (m_read_index > write_index)) m_read_index = first_index;
+
+    // newest events first
     const auto timeout_threshold = CreateTimestamp() - (timeout * 1000);
-    for (const auto &broadcast_message: m_event_queue)
+    for (auto index = write_index; index > m_read_index; --index)
     {
-      const auto timestamp = broadcast_message.timestamp;
-      if ((timeout && (timestamp <= timeout_threshold)) || (timestamp <= m_last_timestamp))
+      SMemfileBroadcastEvent broadcast_event;
+      // overwritten by the writer -> all older events are overwritten too
+      if (!m_event_queue.Read(index - 1, broadcast_event))
+        break;
+      if (timeout && (broadcast_event.timestamp <= timeout_threshold))
         break;
-      if ((broadcast_message.process_id == g_process_id) && !enable_loopback)
+      if ((broadcast_event.process_id == g_process_id) && !enable_loopback)
         continue;
-      event_list.push_back(&broadcast_message);
+      m_received_events.push_back(broadcast_event);
     }
+    m_read_index = write_index;
+
+    CloseEventQueue(shared_access);
 
-    m_last_timestamp = header->timestamp;
+    event_list.reserve(m_received_events.size());
+    for (const auto& broadcast_event : m_received_events) event_list.push_back(&broadcast_event);
 
     return true;
   }
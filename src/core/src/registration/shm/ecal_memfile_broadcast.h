@@ -29,7 +29,7 @@
 #include <cstring>
 #include <cstdint>
 
-#include "relocatable_circular_queue.h"
+#include "relocatable_event_ring.h"
 #include "io/shm/ecal_memfile.h"
 
 #include <ecal/ecal.h>
@@ -93,14 +93,18 @@ namespace eCAL
     bool IsMemfileVersionCompatible(const void * memfile_address) const;
     void ResetMemfile(void * memfile_address);
 
+    bool OpenEventQueue(bool& shared_access);
+    void CloseEventQueue(bool shared_access);
+
     bool m_created;
     std::string m_name;
     std::size_t m_max_queue_size;
     std::unique_ptr<CMemoryFile> m_broadcast_memfile;
-    std::vector<char> m_broadcast_memfile_local_buffer;
 
-    RelocatableCircularQueue<SMemfileBroadcastEvent> m_event_queue;
+    RelocatableEventRing<SMemfileBroadcastEvent> m_event_queue;
 
-    std::int64_t m_last_timestamp;
+    // read cursor of this reader (next event index) and the events received by the last ReceiveEvents call
+    std::uint64_t m_read_index;
+    std::vector<SMemfileBroadcastEvent> m_received_events;
   };
 }
\ No newline at end of file
@@ -25,6 +25,29 @@
 #include "io/shm/ecal_memfile.h"
 #include "ecal_def.h"
 
+namespace
+{
+  bool ReadPayloadMemfile(eCAL::CMemoryFile& payload_memfile, std::vector<char>& payload_memfile_buffer)
+  {
+    // try lock free first, retry a few times if the writer interferes, then fall back to locked access
+    for (int attempt = 0; attempt < 3; ++attempt)
+    {
+      if (!payload_memfile.GetSharedReadAccess()) break;
+      payload_memfile_buffer.resize(payload_memfile.CurDataSize());
+      if (!payload_memfile_buffer.empty())
+        payload_memfile.Read(payload_memfile_buffer.data(), payload_memfile_buffer.size(), 0);
+      if (payload_memfile.ReleaseSharedReadAccess()) return true;
+    }
+
+    if (!payload_memfile.GetReadAccess(EXP_MEMFILE_ACCESS_TIMEOUT)) return false;
+    payload_memfile_buffer.resize(payload_memfile.CurDataSize());
+    if (!payload_memfile_buffer.empty())
+      payload_memfile.Read(payload_memfile_buffer.data(), payload_memfile_buffer.size(), 0);
+    payload_memfile.ReleaseReadAccess();
+    return true;
+  }
+}
+
 namespace eCAL
 {
   bool CMemoryFileBroadcastReader::Bind(CMemoryFileBroadcast *memfile_broadcast)
@@ -84,13 +107,7 @@ namespace eCAL
       {
         case eMemfileBroadcastEventType::EVENT_UPDATED:
         {
-          if (memfile_broadcast_payload.payload_memfile->GetReadAccess(EXP_MEMFILE_ACCESS_TIMEOUT)) {
-            memfile_broadcast_payload.payload_memfile_buffer.resize(
-              memfile_broadcast_payload.payload_memfile->CurDataSize());
-            memfile_broadcast_payload.payload_memfile->Read(memfile_broadcast_payload.payload_memfile_buffer.data(),
-                                                            memfile_broadcast_payload.payload_memfile_buffer.size(),
-                                                            0);
-            memfile_broadcast_payload.payload_memfile->ReleaseReadAccess();
+          if (ReadPayloadMemfile(*memfile_broadcast_payload.payload_memfile, memfile_broadcast_payload.payload_memfile_buffer)) {
             memfile_broadcast_payload.timestamp = broadcast_event->timestamp;
 
             memfile_broadcast_message_list.push_back({memfile_broadcast_payload.payload_memfile_buffer.data(),
@@ -0,0 +1,169 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  relocatable single producer / multi consumer event ring for shared memory
+ *
+ * The producer (pushes have to be serialized by the caller) writes every event into the slot
+ * (event index % capacity) and tags the slot with a sequence number (odd while written).
+ * Consumers keep their own read cursor (event index) and read the slots without locking,
+ * an event that was overwritten while reading is detected by the changed slot sequence.
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+template<class T>
+class RelocatableEventRing
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Event ring values have to be trivially copyable.");
+  static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Event ring needs lock free 64 bit atomics.");
+
+public:
+  RelocatableEventRing(): m_base_address(nullptr), m_header(nullptr)
+  {}
+
+  void SetBaseAddress(void* base_address)
+  {
+    m_base_address = base_address;
+    m_header = static_cast<Header*>(m_base_address);
+  }
+
+  // producer, initializes an empty ring (no consumer may access the ring meanwhile)
+  void Reset(std::uint64_t capacity)
+  {
+    assert((m_base_address != nullptr) && (capacity != 0));
+
+    m_header->write_index.store(0, std::memory_order_relaxed);
+    m_header->flush_index.store(0, std::memory_order_relaxed);
+    m_header->capacity = capacity;
+    m_header->reserved = 0;
+    for (std::uint64_t index = 0; index < capacity; ++index)
+    {
+      GetSlot(index)->sequence.store(0, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  // producer, pushes have to be serialized by the caller
+  void Push(const T& value)
+  {
+    assert(m_base_address != nullptr);
+
+    const std::uint64_t index = m_header->write_index.load(std::memory_order_relaxed);
+    Slot* slot = GetSlot(index % m_header->capacity);
+
+    slot->sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&slot->value, &value, sizeof(T));
+    slot->sequence.store(2 * index + 2, std::memory_order_release);
+
+    m_header->write_index.store(index + 1, std::memory_order_release);
+  }
+
+  // producer, consumers skip all events pushed so far
+  void Flush()
+  {
+    assert(m_base_address != nullptr);
+    m_header->flush_index.store(m_header->write_index.load(std::memory_order_relaxed), std::memory_order_release);
+  }
+
+  // number of events pushed since the last reset
+  std::uint64_t WriteIndex() const
+  {
+    assert(m_base_address != nullptr);
+    return m_header->write_index.load(std::memory_order_acquire);
+  }
+
+  // first event index a consumer has to read
+  std::uint64_t FirstReadableIndex() const
+  {
+    assert(m_base_address != nullptr);
+    const std::uint64_t write_index = m_header->write_index.load(std::memory_order_acquire);
+    const std::uint64_t flush_index = m_header->flush_index.load(std::memory_order_acquire);
+    const std::uint64_t oldest_index = (write_index > m_header->capacity) ? write_index - m_header->capacity : 0;
+    return (flush_index > oldest_index) ? flush_index : oldest_index;
+  }
+
+  // consumer, returns false if the event was not written yet or has been overwritten
+  bool Read(std::uint64_t index, T& value) const
+  {
+    assert(m_base_address != nullptr);
+
+    const Slot* slot = GetSlot(index % m_header->capacity);
+
+    const std::uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+    if (sequence != 2 * index + 2) return false;
+
+    std::memcpy(&value, &slot->value, sizeof(T));
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return (slot->sequence.load(std::memory_order_relaxed) == sequence);
+  }
+
+  std::uint64_t Capacity() const
+  {
+    assert(m_base_address != nullptr);
+    return m_header->capacity;
+  }
+
+  std::size_t OccupiedMemorySize() const
+  {
+    assert(m_base_address != nullptr);
+    return PresumablyOccupiedMemorySize(static_cast<std::size_t>(m_header->capacity));
+  }
+
+  static std::size_t PresumablyOccupiedMemorySize(std::size_t capacity)
+  {
+    return sizeof(Header) + sizeof(Slot) * capacity;
+  }
+
+private:
+  struct Header
+  {
+    std::atomic<std::uint64_t> write_index;
+    std::atomic<std::uint64_t> flush_index;
+    std::uint64_t              capacity;
+    std::uint64_t              reserved;
+  };
+
+  struct Slot
+  {
+    std::atomic<std::uint64_t> sequence;
+    T                          value;
+  };
+
+  void*   m_base_address;
+  Header* m_header;
+
+  Slot* GetSlot(std::uint64_t index)
+  {
+    return reinterpret_cast<Slot*>(static_cast<char*>(m_base_address) + sizeof(Header) + sizeof(Slot) * index);
+  }
+
+  const Slot* GetSlot(std::uint64_t index) const
+  {
+    return reinterpret_cast<const Slot*>(static_cast<const char*>(m_base_address) + sizeof(Header) + sizeof(Slot) * index);
+  }
+};
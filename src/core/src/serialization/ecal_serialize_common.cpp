@@ -227,6 +227,60 @@ namespace eCAL
       return true;
     }
 
+    ///////////////////////////////////////////////
+    // vector<int64_t>
+    ///////////////////////////////////////////////
+    bool encode_int64_list_field(pb_ostream_t* stream, const pb_field_iter_t* field, void* const* arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      auto* int_list = (std::vector<int64_t>*)(*arg);
+
+      for (const auto value : *int_list)
+      {
+        if (!pb_encode_tag_for_field(stream, field))
+        {
+          return false;
+        }
+
+        if (!pb_encode_varint(stream, static_cast<uint64_t>(value)))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    bool decode_int64_list_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
+    {
+      if (arg == nullptr)  return false;
+      if (*arg == nullptr) return false;
+
+      // called once per value (packed and unpacked encoding)
+      uint64_t value(0);
+      if (!pb_decode_varint(stream, &value))
+        return false;
+
+      auto tgt_list = (std::vector<int64_t>*)(*arg);
+      tgt_list->push_back(static_cast<int64_t>(value));
+
+      return true;
+    }
+
+    void encode_int64_list(pb_callback_t& pb_callback, const std::vector<int64_t>& int_list)
+    {
+      pb_callback.funcs.encode = &encode_int64_list_field;
+      pb_callback.arg = (void*)(&int_list);
+    }
+
+    void decode_int64_list(pb_callback_t& pb_callback, std::vector<int64_t>& int_list)
+    {
+      pb_callback.funcs.decode = &decode_int64_list_field;
+      pb_callback.arg = &int_list;
+    }
+
     ///////////////////////////////////////////////
     // registration_layer
     ///////////////////////////////////////////////
@@ -249,15 +303,22 @@ namespace eCAL
         pb_layer.version   = layer.version;
         pb_layer.confirmed = layer.confirmed;
 
+        // send queue statistics
+        pb_layer.queue_depth     = layer.queue_depth;
+        pb_layer.queue_max_depth = layer.queue_max_depth;
+        pb_layer.queue_drops     = layer.queue_drops;
+
         // layer
         pb_layer.has_par_layer = true;
         
         // udp layer parameter
-        pb_layer.par_layer.has_layer_par_udpmc = false;
+        pb_layer.par_layer.has_layer_par_udpmc = true;
+        pb_layer.par_layer.layer_par_udpmc.compression = layer.par_layer.layer_par_udpmc.compression;
 
         // tcp layer parameter
         pb_layer.par_layer.has_layer_par_tcp = true;
-        pb_layer.par_layer.layer_par_tcp.port = layer.par_layer.layer_par_tcp.port;
+        pb_layer.par_layer.layer_par_tcp.port        = layer.par_layer.layer_par_tcp.port;
+        pb_layer.par_layer.layer_par_tcp.compression = layer.par_layer.layer_par_tcp.compression;
 
         // shm layer parameter
         pb_layer.par_layer.has_layer_par_shm = true;
@@ -301,8 +362,17 @@ namespace eCAL
       layer.version   = pb_layer.version;
       layer.confirmed = pb_layer.confirmed;
 
+      // apply send queue statistics
+      layer.queue_depth     = pb_layer.queue_depth;
+      layer.queue_max_depth = pb_layer.queue_max_depth;
+      layer.queue_drops     = pb_layer.queue_drops;
+
+      // apply udp layer parameter
+      layer.par_layer.layer_par_udpmc.compression = pb_layer.par_layer.layer_par_udpmc.compression;
+
       // apply tcp layer parameter
-      layer.par_layer.layer_par_tcp.port = pb_layer.par_layer.layer_par_tcp.port;
+      layer.par_layer.layer_par_tcp.port        = pb_layer.par_layer.layer_par_tcp.port;
+      layer.par_layer.layer_par_tcp.compression = pb_layer.par_layer.layer_par_tcp.compression;
 
       // add layer
       auto tgt_vector = (std::vector<eCAL::Registration::TLayer>*)(*arg);
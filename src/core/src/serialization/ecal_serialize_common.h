@@ -53,6 +53,9 @@ namespace eCAL
     void encode_map(pb_callback_t& pb_callback, const std::map<std::string, std::string>& str_map);
     void decode_map(pb_callback_t& pb_callback, std::map<std::string, std::string>& str_map);
 
+    void encode_int64_list(pb_callback_t& pb_callback, const std::vector<int64_t>& int_list);
+    void decode_int64_list(pb_callback_t& pb_callback, std::vector<int64_t>& int_list);
+
     void encode_registration_layer(pb_callback_t& pb_callback, const std::vector<eCAL::Registration::TLayer>& layer_vec);
     void decode_registration_layer(pb_callback_t& pb_callback, std::vector<eCAL::Registration::TLayer>& layer_vec);
 
@@ -33,6 +33,33 @@
 
 namespace
 {
+  /////////////////////////////////////////////////////////////////////////////////
+  // eCAL::Monitoring::SLatencyMon
+  /////////////////////////////////////////////////////////////////////////////////
+  void EncodeLatencyHistogram(const eCAL::Monitoring::SLatencyMon& histogram_, eCAL_pb_LatencyHistogram& pb_histogram_)
+  {
+    pb_histogram_.count = histogram_.count;
+    pb_histogram_.min   = histogram_.min;
+    pb_histogram_.max   = histogram_.max;
+    pb_histogram_.mean  = histogram_.mean;
+    pb_histogram_.p50   = histogram_.p50;
+    pb_histogram_.p90   = histogram_.p90;
+    pb_histogram_.p99   = histogram_.p99;
+    pb_histogram_.p999  = histogram_.p999;
+  }
+
+  void DecodeLatencyHistogram(const eCAL_pb_LatencyHistogram& pb_histogram_, eCAL::Monitoring::SLatencyMon& histogram_)
+  {
+    histogram_.count = pb_histogram_.count;
+    histogram_.min   = pb_histogram_.min;
+    histogram_.max   = pb_histogram_.max;
+    histogram_.mean  = pb_histogram_.mean;
+    histogram_.p50   = pb_histogram_.p50;
+    histogram_.p90   = pb_histogram_.p90;
+    histogram_.p99   = pb_histogram_.p99;
+    histogram_.p999  = pb_histogram_.p999;
+  }
+
   /////////////////////////////////////////////////////////////////////////////////
   // Encode: eCAL::Monitoring::SProcessMon
   /////////////////////////////////////////////////////////////////////////////////
@@ -129,6 +156,9 @@ namespace
       pb_layer.type = static_cast<eCAL_pb_eTLayerType>(layer.type);
       pb_layer.version = layer.version;
       pb_layer.confirmed = layer.confirmed;
+      pb_layer.queue_depth = layer.queue_depth;
+      pb_layer.queue_max_depth = layer.queue_max_depth;
+      pb_layer.queue_drops = layer.queue_drops;
 
       if (!pb_encode_submessage(stream, eCAL_pb_TLayer_fields, &pb_layer))
       {
@@ -187,6 +217,14 @@ namespace
     pb_topic_.dclock = topic_.dclock;
     // dfreq
     pb_topic_.dfreq = topic_.dfreq;
+    // latency
+    pb_topic_.has_latency = true;
+    pb_topic_.latency.has_delivery = true;
+    EncodeLatencyHistogram(topic_.latency.delivery, pb_topic_.latency.delivery);
+    pb_topic_.latency.has_callback = true;
+    EncodeLatencyHistogram(topic_.latency.callback, pb_topic_.latency.callback);
+    pb_topic_.latency.has_shm_lock = true;
+    EncodeLatencyHistogram(topic_.latency.shm_lock, pb_topic_.latency.shm_lock);
     // tlayer
     encode_mon_registration_layer(pb_topic_.tlayer, topic_.tlayer);
     // attr
@@ -577,6 +615,9 @@ namespace
     layer.type = static_cast<eCAL::Monitoring::eTLayerType>(pb_layer.type);
     layer.version = pb_layer.version;
     layer.confirmed = pb_layer.confirmed;
+    layer.queue_depth = pb_layer.queue_depth;
+    layer.queue_max_depth = pb_layer.queue_max_depth;
+    layer.queue_drops = pb_layer.queue_drops;
 
     // add layer
     auto tgt_vector = (std::vector<eCAL::Monitoring::TLayer>*)(*arg);
@@ -648,6 +689,10 @@ namespace
     topic_.dclock = pb_topic_.dclock;
     // dfreq
     topic_.dfreq = pb_topic_.dfreq;
+    // latency
+    DecodeLatencyHistogram(pb_topic_.latency.delivery, topic_.latency.delivery);
+    DecodeLatencyHistogram(pb_topic_.latency.callback, topic_.latency.callback);
+    DecodeLatencyHistogram(pb_topic_.latency.shm_lock, topic_.latency.shm_lock);
   }
 
   bool decode_topics_field(pb_istream_t* stream, const pb_field_iter_t* /*field*/, void** arg)
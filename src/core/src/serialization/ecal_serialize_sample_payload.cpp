@@ -83,6 +83,7 @@ namespace
     pb_sample_.content.time = payload_.content.time;
     pb_sample_.content.hash = payload_.content.hash;
     pb_sample_.content.size = payload_.content.size;
+    pb_sample_.content.compression = payload_.content.compression;
 
     // topic content payload
     eCAL::nanopb::encode_bytes(pb_sample_.content.payload, nano_bytes_);
@@ -173,6 +174,7 @@ namespace
     payload_.content.time  = pb_sample.content.time;
     payload_.content.hash  = pb_sample.content.hash;
     payload_.content.size  = pb_sample.content.size;
+    payload_.content.compression = pb_sample.content.compression;
 
     return true;
   }
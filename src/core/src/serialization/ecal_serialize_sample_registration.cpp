@@ -29,10 +29,39 @@
 #include "ecal_serialize_common.h"
 #include "ecal_serialize_sample_registration.h"
 
+#include <algorithm>
+#include <future>
 #include <iostream>
 
 namespace
 {
+  /////////////////////////////////////////////////////////////////////////////////
+  // eCAL::Registration::LatencyHistogram
+  /////////////////////////////////////////////////////////////////////////////////
+  void EncodeLatencyHistogram(const eCAL::Registration::LatencyHistogram& histogram_, eCAL_pb_LatencyHistogram& pb_histogram_)
+  {
+    pb_histogram_.count = histogram_.count;
+    pb_histogram_.min   = histogram_.min;
+    pb_histogram_.max   = histogram_.max;
+    pb_histogram_.mean  = histogram_.mean;
+    pb_histogram_.p50   = histogram_.p50;
+    pb_histogram_.p90   = histogram_.p90;
+    pb_histogram_.p99   = histogram_.p99;
+    pb_histogram_.p999  = histogram_.p999;
+  }
+
+  void DecodeLatencyHistogram(const eCAL_pb_LatencyHistogram& pb_histogram_, eCAL::Registration::LatencyHistogram& histogram_)
+  {
+    histogram_.count = pb_histogram_.count;
+    histogram_.min   = pb_histogram_.min;
+    histogram_.max   = pb_histogram_.max;
+    histogram_.mean  = pb_histogram_.mean;
+    histogram_.p50   = pb_histogram_.p50;
+    histogram_.p90   = pb_histogram_.p90;
+    histogram_.p99   = pb_histogram_.p99;
+    histogram_.p999  = pb_histogram_.p999;
+  }
+
   /////////////////////////////////////////////////////////////////////////////////
   // eCAL::Registration::Sample
   /////////////////////////////////////////////////////////////////////////////////
@@ -188,6 +217,18 @@ namespace
     pb_sample_.topic.dclock = registration_.topic.dclock;
     // dfreq
     pb_sample_.topic.dfreq = registration_.topic.dfreq;
+    // latency
+    pb_sample_.topic.has_latency = true;
+    pb_sample_.topic.latency.has_delivery = true;
+    EncodeLatencyHistogram(registration_.topic.latency.delivery, pb_sample_.topic.latency.delivery);
+    pb_sample_.topic.latency.has_callback = true;
+    EncodeLatencyHistogram(registration_.topic.latency.callback, pb_sample_.topic.latency.callback);
+    pb_sample_.topic.latency.has_shm_lock = true;
+    EncodeLatencyHistogram(registration_.topic.latency.shm_lock, pb_sample_.topic.latency.shm_lock);
+    // filter
+    pb_sample_.topic.has_filter = true;
+    eCAL::nanopb::encode_int64_list(pb_sample_.topic.filter.ids, registration_.topic.filter.ids);
+    pb_sample_.topic.filter.max_freq = registration_.topic.filter.max_freq;
     // tlayer
     eCAL::nanopb::encode_registration_layer(pb_sample_.topic.tlayer, registration_.topic.tlayer);
     // attr
@@ -338,6 +379,8 @@ namespace
     eCAL::nanopb::decode_registration_layer(pb_sample_.topic.tlayer, registration_.topic.tlayer);
     // attr
     eCAL::nanopb::decode_map(pb_sample_.topic.attr, registration_.topic.attr);
+    // filter.ids
+    eCAL::nanopb::decode_int64_list(pb_sample_.topic.filter.ids, registration_.topic.filter.ids);
   }
 
   void AssignValues(const eCAL_pb_Sample& pb_sample_, eCAL::Registration::Sample& registration_)
@@ -413,6 +456,12 @@ namespace
     registration_.topic.dclock = pb_sample_.topic.dclock;
     // dfreq
     registration_.topic.dfreq = pb_sample_.topic.dfreq;
+    // latency
+    DecodeLatencyHistogram(pb_sample_.topic.latency.delivery, registration_.topic.latency.delivery);
+    DecodeLatencyHistogram(pb_sample_.topic.latency.callback, registration_.topic.latency.callback);
+    DecodeLatencyHistogram(pb_sample_.topic.latency.shm_lock, registration_.topic.latency.shm_lock);
+    // filter
+    registration_.topic.filter.max_freq = pb_sample_.topic.filter.max_freq;
   }
 
   bool Buffer2RegistrationStruct(const char* data_, size_t size_, eCAL::Registration::Sample& registration_)
@@ -611,4 +660,56 @@ namespace eCAL
   {
     return Buffer2RegistrationListStruct(data_, size_, target_sample_list_);
   }
+
+  size_t GetSampleListEntrySize(size_t serialized_sample_size_)
+  {
+    // field tag + length varint + serialized sample
+    size_t varint_size(1);
+    for (size_t value = serialized_sample_size_ >> 7; value != 0; value >>= 7) ++varint_size;
+    return 1 + varint_size + serialized_sample_size_;
+  }
+
+  void AppendToSampleListBuffer(const std::vector<char>& serialized_sample_, std::vector<char>& target_buffer_)
+  {
+    // a sample list is the concatenation of its length delimited "samples" fields,
+    // so already serialized samples can be appended without encoding them again
+    target_buffer_.push_back(static_cast<char>((eCAL_pb_SampleList_samples_tag << 3) | PB_WT_STRING));
+    size_t value = serialized_sample_.size();
+    while (value >= 0x80)
+    {
+      target_buffer_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    target_buffer_.push_back(static_cast<char>(value));
+    target_buffer_.insert(target_buffer_.end(), serialized_sample_.begin(), serialized_sample_.end());
+  }
+
+  bool SerializeToBuffers(const std::vector<std::shared_ptr<const Registration::Sample>>& samples_, std::vector<std::vector<char>>& target_buffers_, size_t worker_count_)
+  {
+    // the buffers are only grown, so their capacity is reused from call to call
+    if (target_buffers_.size() < samples_.size()) target_buffers_.resize(samples_.size());
+
+    auto serialize = [&samples_, &target_buffers_](size_t begin_, size_t end_)
+    {
+      bool serialized(true);
+      for (size_t idx = begin_; idx < end_; ++idx)
+      {
+        serialized &= SerializeToBuffer(*samples_[idx], target_buffers_[idx]);
+      }
+      return serialized;
+    };
+
+    const size_t workers = std::max<size_t>(1, std::min(worker_count_, samples_.size()));
+    if (workers == 1) return serialize(0, samples_.size());
+
+    const size_t chunk_size = (samples_.size() + workers - 1) / workers;
+    std::vector<std::future<bool>> serialize_futures;
+    for (size_t begin = chunk_size; begin < samples_.size(); begin += chunk_size)
+    {
+      serialize_futures.emplace_back(std::async(std::launch::async, serialize, begin, std::min(begin + chunk_size, samples_.size())));
+    }
+    bool return_value = serialize(0, chunk_size);
+    for (auto& serialize_future : serialize_futures) return_value &= serialize_future.get();
+    return return_value;
+  }
 }
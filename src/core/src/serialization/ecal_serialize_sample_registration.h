@@ -26,6 +26,8 @@
 
 #include "ecal_struct_sample_registration.h"
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -40,4 +42,12 @@ namespace eCAL
   bool SerializeToBuffer     (const Registration::SampleList& registration_sample_, std::vector<char>& target_buffer_);
   bool SerializeToBuffer     (const Registration::SampleList& source_sample_list_, std::string& target_buffer_);
   bool DeserializeFromBuffer (const char* data_, size_t size_, Registration::SampleList& target_sample_);
+
+  // registration sample list - build from already serialized registration samples
+  size_t GetSampleListEntrySize  (size_t serialized_sample_size_);
+  void   AppendToSampleListBuffer(const std::vector<char>& serialized_sample_, std::vector<char>& target_buffer_);
+
+  // registration sample snapshot - serialize every sample into its own buffer (target_buffers_[i] for samples_[i]),
+  // split into worker_count_ chunks, all but the first chunk are serialized by additional threads
+  bool SerializeToBuffers    (const std::vector<std::shared_ptr<const Registration::Sample>>& samples_, std::vector<std::vector<char>>& target_buffers_, size_t worker_count_);
 }
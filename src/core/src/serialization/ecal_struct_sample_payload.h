@@ -66,6 +66,7 @@ namespace eCAL
       int64_t                             time  = 0;                    // time the content was updated
       int64_t                             hash  = 0;                    // unique hash for that payload
       int32_t                             size  = 0;                    // size (additional for none payload "header only samples")
+      int32_t                             compression = 0;              // payload compression (0 = none, 1 = lz)
       Payload                             payload;                      // payload represented as raw pointer or a std::vector<char>
     };
 
@@ -86,12 +86,14 @@ namespace eCAL
     // Transport layer parameters for ecal udp multicast
     struct LayerParUdpMC
     {
+      int32_t                             compression = 0;              // payload compression (writer: used codec, reader: supported codec)
     };
 
     // Transport layer parameters for ecal tcp
     struct LayerParTcp
     {
       int32_t                             port = 0;                     // tcp writers port number
+      int32_t                             compression = 0;              // payload compression (writer: used codec, reader: supported codec)
     };
 
     // Transport layer parameters for ecal shm
@@ -115,6 +117,9 @@ namespace eCAL
       int32_t                             version = 0;                  // transport layer version
       bool                                confirmed = false;            // transport layer used?
       ConnectionPar                       par_layer;                    // transport layer parameter
+      int32_t                             queue_depth = 0;              // number of samples queued by the background sender (async_net_send)
+      int32_t                             queue_max_depth = 0;          // maximum number of samples queued by the background sender
+      int64_t                             queue_drops = 0;              // number of samples dropped on send queue overflow
     };
 
     // Process information
@@ -146,6 +151,34 @@ namespace eCAL
     };
 
     // eCAL topic information
+    // Latency histogram summary (all values in nanoseconds)
+    struct LatencyHistogram
+    {
+      int64_t                             count = 0;                    // number of measured values
+      int64_t                             min   = 0;                    // minimum
+      int64_t                             max   = 0;                    // maximum
+      int64_t                             mean  = 0;                    // mean
+      int64_t                             p50   = 0;                    // median
+      int64_t                             p90   = 0;                    // 90 % percentile
+      int64_t                             p99   = 0;                    // 99 % percentile
+      int64_t                             p999  = 0;                    // 99.9 % percentile
+    };
+
+    // Topic latencies (measured since topic creation)
+    struct TopicLatency
+    {
+      LatencyHistogram                    delivery;                     // sample time stamp to receive time (subscriber)
+      LatencyHistogram                    callback;                     // receive callback duration (subscriber)
+      LatencyHistogram                    shm_lock;                     // shared memory write access wait time (publisher)
+    };
+
+    // Samples requested by a subscriber (filtered by the publisher)
+    struct TopicFilter
+    {
+      std::vector<int64_t>                ids;                          // accepted sample ids (empty = all ids)
+      int32_t                             max_freq = 0;                 // maximum sample frequency [mHz] (0 = unlimited)
+    };
+
     struct Topic
     {
       int32_t                             rclock = 0;                   // registration clock (heart beat)
@@ -173,6 +206,9 @@ namespace eCAL
       int64_t                             dclock = 0;                   // data clock (send / receive action)
       int32_t                             dfreq  = 0;                   // data frequency (send / receive registrations per second) [mHz]
 
+      TopicLatency                        latency;                      // latency statistics
+      TopicFilter                         filter;                       // subscriber sample filter
+
       std::map<std::string, std::string>  attr;                         // generic topic description
     };
 
@@ -20,7 +20,7 @@ typedef enum _eCAL_pb_eTLayerType {
 
 /* Struct definitions */
 typedef struct _eCAL_pb_LayerParUdpMC {
-    char dummy_field;
+    int32_t compression; /* payload compression (writer: used codec, reader: supported codec, 0 = none, 1 = lz) */
 } eCAL_pb_LayerParUdpMC;
 
 typedef struct _eCAL_pb_LayerParShm {
@@ -33,6 +33,7 @@ typedef struct _eCAL_pb_LayerParInproc {
 
 typedef struct _eCAL_pb_LayerParTcp {
     int32_t port; /* tcp writers port number */
+    int32_t compression; /* payload compression (writer: used codec, reader: supported codec, 0 = none, 1 = lz) */
 } eCAL_pb_LayerParTcp;
 
 typedef struct _eCAL_pb_ConnnectionPar {
@@ -50,6 +51,9 @@ typedef struct _eCAL_pb_TLayer {
     bool confirmed; /* transport layer used ? */
     bool has_par_layer;
     eCAL_pb_ConnnectionPar par_layer; /* transport layer parameter */
+    int32_t queue_depth; /* number of samples queued by the background sender (async_net_send) */
+    int32_t queue_max_depth; /* maximum number of samples queued by the background sender */
+    int64_t queue_drops; /* number of samples dropped on send queue overflow */
 } eCAL_pb_TLayer;
 
 
@@ -74,19 +78,21 @@ extern "C" {
 #define eCAL_pb_LayerParUdpMC_init_default       {0}
 #define eCAL_pb_LayerParShm_init_default         {{{NULL}, NULL}}
 #define eCAL_pb_LayerParInproc_init_default      {0}
-#define eCAL_pb_LayerParTcp_init_default         {0}
+#define eCAL_pb_LayerParTcp_init_default         {0, 0}
 #define eCAL_pb_ConnnectionPar_init_default      {false, eCAL_pb_LayerParUdpMC_init_default, false, eCAL_pb_LayerParShm_init_default, false, eCAL_pb_LayerParTcp_init_default}
-#define eCAL_pb_TLayer_init_default              {_eCAL_pb_eTLayerType_MIN, 0, 0, false, eCAL_pb_ConnnectionPar_init_default}
+#define eCAL_pb_TLayer_init_default              {_eCAL_pb_eTLayerType_MIN, 0, 0, false, eCAL_pb_ConnnectionPar_init_default, 0, 0, 0}
 #define eCAL_pb_LayerParUdpMC_init_zero          {0}
 #define eCAL_pb_LayerParShm_init_zero            {{{NULL}, NULL}}
 #define eCAL_pb_LayerParInproc_init_zero         {0}
-#define eCAL_pb_LayerParTcp_init_zero            {0}
+#define eCAL_pb_LayerParTcp_init_zero            {0, 0}
 #define eCAL_pb_ConnnectionPar_init_zero         {false, eCAL_pb_LayerParUdpMC_init_zero, false, eCAL_pb_LayerParShm_init_zero, false, eCAL_pb_LayerParTcp_init_zero}
-#define eCAL_pb_TLayer_init_zero                 {_eCAL_pb_eTLayerType_MIN, 0, 0, false, eCAL_pb_ConnnectionPar_init_zero}
+#define eCAL_pb_TLayer_init_zero                 {_eCAL_pb_eTLayerType_MIN, 0, 0, false, eCAL_pb_ConnnectionPar_init_zero, 0, 0, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
+#define eCAL_pb_LayerParUdpMC_compression_tag    1
 #define eCAL_pb_LayerParShm_memory_file_list_tag 1
 #define eCAL_pb_LayerParTcp_port_tag             1
+#define eCAL_pb_LayerParTcp_compression_tag      2
 #define eCAL_pb_ConnnectionPar_layer_par_udpmc_tag 1
 #define eCAL_pb_ConnnectionPar_layer_par_shm_tag 2
 #define eCAL_pb_ConnnectionPar_layer_par_tcp_tag 4
@@ -94,10 +100,13 @@ extern "C" {
 #define eCAL_pb_TLayer_version_tag               2
 #define eCAL_pb_TLayer_confirmed_tag             3
 #define eCAL_pb_TLayer_par_layer_tag             5
+#define eCAL_pb_TLayer_queue_depth_tag           6
+#define eCAL_pb_TLayer_queue_max_depth_tag       7
+#define eCAL_pb_TLayer_queue_drops_tag           8
 
 /* Struct field encoding specification for nanopb */
 #define eCAL_pb_LayerParUdpMC_FIELDLIST(X, a) \
-
+X(a, STATIC,   SINGULAR, INT32,    compression,       1)
 #define eCAL_pb_LayerParUdpMC_CALLBACK NULL
 #define eCAL_pb_LayerParUdpMC_DEFAULT NULL
 
@@ -112,7 +121,8 @@ X(a, CALLBACK, REPEATED, STRING,   memory_file_list,   1)
 #define eCAL_pb_LayerParInproc_DEFAULT NULL
 
 #define eCAL_pb_LayerParTcp_FIELDLIST(X, a) \
-X(a, STATIC,   SINGULAR, INT32,    port,              1)
+X(a, STATIC,   SINGULAR, INT32,    port,              1) \
+X(a, STATIC,   SINGULAR, INT32,    compression,       2)
 #define eCAL_pb_LayerParTcp_CALLBACK NULL
 #define eCAL_pb_LayerParTcp_DEFAULT NULL
 
@@ -130,7 +140,10 @@ X(a, STATIC,   OPTIONAL, MESSAGE,  layer_par_tcp,     4)
 X(a, STATIC,   SINGULAR, UENUM,    type,              1) \
 X(a, STATIC,   SINGULAR, INT32,    version,           2) \
 X(a, STATIC,   SINGULAR, BOOL,     confirmed,         3) \
-X(a, STATIC,   OPTIONAL, MESSAGE,  par_layer,         5)
+X(a, STATIC,   OPTIONAL, MESSAGE,  par_layer,         5) \
+X(a, STATIC,   SINGULAR, INT32,    queue_depth,       6) \
+X(a, STATIC,   SINGULAR, INT32,    queue_max_depth,   7) \
+X(a, STATIC,   SINGULAR, INT64,    queue_drops,       8)
 #define eCAL_pb_TLayer_CALLBACK NULL
 #define eCAL_pb_TLayer_DEFAULT NULL
 #define eCAL_pb_TLayer_par_layer_MSGTYPE eCAL_pb_ConnnectionPar
@@ -156,8 +169,8 @@ extern const pb_msgdesc_t eCAL_pb_TLayer_msg;
 /* eCAL_pb_TLayer_size depends on runtime parameters */
 #define ECAL_PB_LAYER_PB_H_MAX_SIZE              eCAL_pb_LayerParTcp_size
 #define eCAL_pb_LayerParInproc_size              0
-#define eCAL_pb_LayerParTcp_size                 11
-#define eCAL_pb_LayerParUdpMC_size               0
+#define eCAL_pb_LayerParTcp_size                 22
+#define eCAL_pb_LayerParUdpMC_size               11
 
 #ifdef __cplusplus
 } /* extern "C" */
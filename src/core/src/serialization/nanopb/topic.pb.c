@@ -9,6 +9,15 @@
 PB_BIND(eCAL_pb_DataTypeInformation, eCAL_pb_DataTypeInformation, AUTO)
 
 
+PB_BIND(eCAL_pb_LatencyHistogram, eCAL_pb_LatencyHistogram, AUTO)
+
+
+PB_BIND(eCAL_pb_TopicLatency, eCAL_pb_TopicLatency, AUTO)
+
+
+PB_BIND(eCAL_pb_TopicFilter, eCAL_pb_TopicFilter, AUTO)
+
+
 PB_BIND(eCAL_pb_Topic, eCAL_pb_Topic, 2)
 
 
@@ -17,6 +17,31 @@ typedef struct _eCAL_pb_DataTypeInformation {
     pb_callback_t desc; /* descriptor information of the datatype (necessary for reflection) */
 } eCAL_pb_DataTypeInformation;
 
+typedef struct _eCAL_pb_LatencyHistogram {
+    int64_t count; /* number of measured values */
+    int64_t min; /* minimum */
+    int64_t max; /* maximum */
+    int64_t mean; /* mean */
+    int64_t p50; /* median */
+    int64_t p90; /* 90 % percentile */
+    int64_t p99; /* 99 % percentile */
+    int64_t p999; /* 99.9 % percentile */
+} eCAL_pb_LatencyHistogram;
+
+typedef struct _eCAL_pb_TopicLatency {
+    bool has_delivery;
+    eCAL_pb_LatencyHistogram delivery; /* sample time stamp to receive time (subscriber) */
+    bool has_callback;
+    eCAL_pb_LatencyHistogram callback; /* receive callback duration (subscriber) */
+    bool has_shm_lock;
+    eCAL_pb_LatencyHistogram shm_lock; /* shared memory write access wait time (publisher) */
+} eCAL_pb_TopicLatency;
+
+typedef struct _eCAL_pb_TopicFilter {
+    pb_callback_t ids; /* accepted sample ids (empty = all ids) */
+    int32_t max_freq; /* maximum sample frequency [mHz] (0 = unlimited) */
+} eCAL_pb_TopicFilter;
+
 typedef struct _eCAL_pb_Topic {
     int32_t rclock; /* registration clock (heart beat) */
     pb_callback_t hname; /* host name */
@@ -40,6 +65,10 @@ typedef struct _eCAL_pb_Topic {
     pb_callback_t hgname; /* host group name */
     bool has_tdatatype;
     eCAL_pb_DataTypeInformation tdatatype; /* topic datatype information (encoding & type & description) */
+    bool has_latency;
+    eCAL_pb_TopicLatency latency; /* latency statistics */
+    bool has_filter;
+    eCAL_pb_TopicFilter filter; /* subscriber sample filter */
 } eCAL_pb_Topic;
 
 typedef struct _eCAL_pb_Topic_AttrEntry {
@@ -54,16 +83,35 @@ extern "C" {
 
 /* Initializer values for message structs */
 #define eCAL_pb_DataTypeInformation_init_default {{{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}}
-#define eCAL_pb_Topic_init_default               {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_default}
+#define eCAL_pb_LatencyHistogram_init_default          {0, 0, 0, 0, 0, 0, 0, 0}
+#define eCAL_pb_TopicLatency_init_default              {false, eCAL_pb_LatencyHistogram_init_default, false, eCAL_pb_LatencyHistogram_init_default, false, eCAL_pb_LatencyHistogram_init_default}
+#define eCAL_pb_TopicFilter_init_default               {{{NULL}, NULL}, 0}
+#define eCAL_pb_Topic_init_default               {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_default, false, eCAL_pb_TopicLatency_init_default, false, eCAL_pb_TopicFilter_init_default}
 #define eCAL_pb_Topic_AttrEntry_init_default     {{{NULL}, NULL}, {{NULL}, NULL}}
 #define eCAL_pb_DataTypeInformation_init_zero    {{{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}}
-#define eCAL_pb_Topic_init_zero                  {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_zero}
+#define eCAL_pb_LatencyHistogram_init_zero             {0, 0, 0, 0, 0, 0, 0, 0}
+#define eCAL_pb_TopicLatency_init_zero                 {false, eCAL_pb_LatencyHistogram_init_zero, false, eCAL_pb_LatencyHistogram_init_zero, false, eCAL_pb_LatencyHistogram_init_zero}
+#define eCAL_pb_TopicFilter_init_zero                  {{{NULL}, NULL}, 0}
+#define eCAL_pb_Topic_init_zero                  {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_zero, false, eCAL_pb_TopicLatency_init_zero, false, eCAL_pb_TopicFilter_init_zero}
 #define eCAL_pb_Topic_AttrEntry_init_zero        {{{NULL}, NULL}, {{NULL}, NULL}}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define eCAL_pb_DataTypeInformation_name_tag     1
 #define eCAL_pb_DataTypeInformation_encoding_tag 2
 #define eCAL_pb_DataTypeInformation_desc_tag     3
+#define eCAL_pb_LatencyHistogram_count_tag       1
+#define eCAL_pb_LatencyHistogram_min_tag         2
+#define eCAL_pb_LatencyHistogram_max_tag         3
+#define eCAL_pb_LatencyHistogram_mean_tag        4
+#define eCAL_pb_LatencyHistogram_p50_tag         5
+#define eCAL_pb_LatencyHistogram_p90_tag         6
+#define eCAL_pb_LatencyHistogram_p99_tag         7
+#define eCAL_pb_LatencyHistogram_p999_tag        8
+#define eCAL_pb_TopicLatency_delivery_tag        1
+#define eCAL_pb_TopicLatency_callback_tag        2
+#define eCAL_pb_TopicLatency_shm_lock_tag        3
+#define eCAL_pb_TopicFilter_ids_tag              1
+#define eCAL_pb_TopicFilter_max_freq_tag         2
 #define eCAL_pb_Topic_rclock_tag                 1
 #define eCAL_pb_Topic_hname_tag                  2
 #define eCAL_pb_Topic_pid_tag                    3
@@ -85,6 +133,8 @@ extern "C" {
 #define eCAL_pb_Topic_attr_tag                   27
 #define eCAL_pb_Topic_hgname_tag                 28
 #define eCAL_pb_Topic_tdatatype_tag              30
+#define eCAL_pb_Topic_latency_tag                31
+#define eCAL_pb_Topic_filter_tag                 32
 #define eCAL_pb_Topic_AttrEntry_key_tag          1
 #define eCAL_pb_Topic_AttrEntry_value_tag        2
 
@@ -96,6 +146,34 @@ X(a, CALLBACK, SINGULAR, BYTES,    desc,              3)
 #define eCAL_pb_DataTypeInformation_CALLBACK pb_default_field_callback
 #define eCAL_pb_DataTypeInformation_DEFAULT NULL
 
+#define eCAL_pb_LatencyHistogram_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, INT64,    count,             1) \
+X(a, STATIC,   SINGULAR, INT64,    min,               2) \
+X(a, STATIC,   SINGULAR, INT64,    max,               3) \
+X(a, STATIC,   SINGULAR, INT64,    mean,              4) \
+X(a, STATIC,   SINGULAR, INT64,    p50,               5) \
+X(a, STATIC,   SINGULAR, INT64,    p90,               6) \
+X(a, STATIC,   SINGULAR, INT64,    p99,               7) \
+X(a, STATIC,   SINGULAR, INT64,    p999,              8)
+#define eCAL_pb_LatencyHistogram_CALLBACK NULL
+#define eCAL_pb_LatencyHistogram_DEFAULT NULL
+
+#define eCAL_pb_TopicLatency_FIELDLIST(X, a) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  delivery,          1) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  callback,          2) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  shm_lock,          3)
+#define eCAL_pb_TopicLatency_CALLBACK NULL
+#define eCAL_pb_TopicLatency_DEFAULT NULL
+#define eCAL_pb_TopicLatency_delivery_MSGTYPE eCAL_pb_LatencyHistogram
+#define eCAL_pb_TopicLatency_callback_MSGTYPE eCAL_pb_LatencyHistogram
+#define eCAL_pb_TopicLatency_shm_lock_MSGTYPE eCAL_pb_LatencyHistogram
+
+#define eCAL_pb_TopicFilter_FIELDLIST(X, a) \
+X(a, CALLBACK, REPEATED, INT64,    ids,               1) \
+X(a, STATIC,   SINGULAR, INT32,    max_freq,          2)
+#define eCAL_pb_TopicFilter_CALLBACK pb_default_field_callback
+#define eCAL_pb_TopicFilter_DEFAULT NULL
+
 #define eCAL_pb_Topic_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, INT32,    rclock,            1) \
 X(a, CALLBACK, SINGULAR, STRING,   hname,             2) \
@@ -117,12 +195,16 @@ X(a, STATIC,   SINGULAR, INT64,    dclock,           20) \
 X(a, STATIC,   SINGULAR, INT32,    dfreq,            21) \
 X(a, CALLBACK, REPEATED, MESSAGE,  attr,             27) \
 X(a, CALLBACK, SINGULAR, STRING,   hgname,           28) \
-X(a, STATIC,   OPTIONAL, MESSAGE,  tdatatype,        30)
+X(a, STATIC,   OPTIONAL, MESSAGE,  tdatatype,        30) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  latency,          31) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  filter,           32)
 #define eCAL_pb_Topic_CALLBACK pb_default_field_callback
 #define eCAL_pb_Topic_DEFAULT NULL
 #define eCAL_pb_Topic_tlayer_MSGTYPE eCAL_pb_TLayer
 #define eCAL_pb_Topic_attr_MSGTYPE eCAL_pb_Topic_AttrEntry
 #define eCAL_pb_Topic_tdatatype_MSGTYPE eCAL_pb_DataTypeInformation
+#define eCAL_pb_Topic_latency_MSGTYPE eCAL_pb_TopicLatency
+#define eCAL_pb_Topic_filter_MSGTYPE eCAL_pb_TopicFilter
 
 #define eCAL_pb_Topic_AttrEntry_FIELDLIST(X, a) \
 X(a, CALLBACK, SINGULAR, STRING,   key,               1) \
@@ -131,17 +213,27 @@ X(a, CALLBACK, SINGULAR, STRING,   value,             2)
 #define eCAL_pb_Topic_AttrEntry_DEFAULT NULL
 
 extern const pb_msgdesc_t eCAL_pb_DataTypeInformation_msg;
+extern const pb_msgdesc_t eCAL_pb_LatencyHistogram_msg;
+extern const pb_msgdesc_t eCAL_pb_TopicLatency_msg;
+extern const pb_msgdesc_t eCAL_pb_TopicFilter_msg;
 extern const pb_msgdesc_t eCAL_pb_Topic_msg;
 extern const pb_msgdesc_t eCAL_pb_Topic_AttrEntry_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define eCAL_pb_DataTypeInformation_fields &eCAL_pb_DataTypeInformation_msg
+#define eCAL_pb_LatencyHistogram_fields &eCAL_pb_LatencyHistogram_msg
+#define eCAL_pb_TopicLatency_fields &eCAL_pb_TopicLatency_msg
+#define eCAL_pb_TopicFilter_fields &eCAL_pb_TopicFilter_msg
 #define eCAL_pb_Topic_fields &eCAL_pb_Topic_msg
 #define eCAL_pb_Topic_AttrEntry_fields &eCAL_pb_Topic_AttrEntry_msg
 
 /* Maximum encoded size of messages (where known) */
 /* eCAL_pb_DataTypeInformation_size depends on runtime parameters */
+/* eCAL_pb_TopicFilter_size depends on runtime parameters */
 /* eCAL_pb_Topic_size depends on runtime parameters */
+#define ECAL_PB_TOPIC_PB_H_MAX_SIZE              eCAL_pb_TopicLatency_size
+#define eCAL_pb_LatencyHistogram_size            88
+#define eCAL_pb_TopicLatency_size                270
 /* eCAL_pb_Topic_AttrEntry_size depends on runtime parameters */
 
 #ifdef __cplusplus
@@ -24,6 +24,8 @@
 #include "ecal_clientgate.h"
 #include "service/ecal_service_client_impl.h"
 
+#include <algorithm>
+
 namespace eCAL
 {
   //////////////////////////////////////////////////////////////////
@@ -140,13 +142,16 @@ namespace eCAL
     const std::shared_lock<std::shared_timed_mutex> lock(m_service_register_map_sync);
 
     // look for requested services
-    for (auto service : m_service_register_map)
+    for (auto&& service : m_service_register_map)
     {
       if (service.second.sname == service_name_)
       {
         ret_vec.push_back(service.second);
       }
     }
+
+    // the register map is unordered, keep the services ordered by their key
+    std::sort(ret_vec.begin(), ret_vec.end(), [](const SServiceAttr& lhs_, const SServiceAttr& rhs_) { return lhs_.key < rhs_.key; });
     return(ret_vec);
   }
 
@@ -25,7 +25,7 @@
 
 #include "ecal_def.h"
 #include "serialization/ecal_struct_sample_registration.h"
-#include "util/ecal_expmap.h"
+#include "util/ecal_exphashmap.h"
 
 #include <ecal/ecal_callback.h>
 
@@ -62,7 +62,7 @@ namespace eCAL
     std::shared_timed_mutex     m_client_set_sync;
     ServiceNameServiceImplSetT  m_client_set;
 
-    using ConnectedMapT = Util::CExpMap<std::string, SServiceAttr>;
+    using ConnectedMapT = Util::CExpHashMap<std::string, SServiceAttr>;
     std::shared_timed_mutex     m_service_register_map_sync;
     ConnectedMapT               m_service_register_map;
   };
@@ -0,0 +1,170 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL bounded queue with overflow policy
+**/
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    struct SBoundedQueueStatistics
+    {
+      size_t     depth     = 0;  //!< number of queued elements
+      size_t     max_depth = 0;  //!< maximum number of queued elements
+      long long  drops     = 0;  //!< number of elements dropped on overflow
+    };
+
+    /**
+    * @brief Bounded multi producer / multi consumer queue recycling the storage of its elements.
+    *
+    * If the queue is full, Push either drops the oldest element or blocks until a consumer
+    * made room. Elements are moved in and out and the storage of consumed and dropped
+    * elements is handed back to the producers, so elements owning buffers (like vectors)
+    * keep their allocations.
+    **/
+    template <typename T>
+    class CBoundedQueue
+    {
+    public:
+      enum class eOverflowPolicy
+      {
+        drop_oldest,
+        block
+      };
+
+      CBoundedQueue(size_t capacity_, eOverflowPolicy policy_) : m_capacity(std::max<size_t>(capacity_, 1)), m_policy(policy_) {}
+
+      CBoundedQueue(const CBoundedQueue&) = delete;
+      CBoundedQueue& operator=(const CBoundedQueue&) = delete;
+
+      // moves the element into the queue and replaces it by recycled storage (if available),
+      // returns false if the queue is closed
+      bool Push(T& element_)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_policy == eOverflowPolicy::block)
+        {
+          m_not_full_cv.wait(lock, [this]() { return m_closed || (m_queue.size() < m_capacity); });
+        }
+        if (m_closed) return false;
+
+        if (m_queue.size() >= m_capacity)
+        {
+          m_free.push_back(std::move(m_queue.front()));
+          m_queue.pop_front();
+          m_statistics.drops++;
+        }
+
+        m_queue.push_back(std::move(element_));
+        if (!m_free.empty())
+        {
+          element_ = std::move(m_free.back());
+          m_free.pop_back();
+        }
+        m_statistics.max_depth = std::max(m_statistics.max_depth, m_queue.size());
+
+        lock.unlock();
+        m_not_empty_cv.notify_one();
+        return true;
+      }
+
+      // moves the oldest element out of the queue (the previous content of element_ is recycled),
+      // blocks until an element is available, returns false if the queue is closed and empty
+      bool Pop(T& element_)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_empty_cv.wait(lock, [this]() { return m_closed || !m_queue.empty(); });
+        if (m_queue.empty()) return false;
+
+        m_free.push_back(std::move(element_));
+        element_ = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        lock.unlock();
+        m_not_full_cv.notify_one();
+        return true;
+      }
+
+      // moves the oldest element out of the queue without waiting (the previous content of element_ is recycled),
+      // returns false if the queue is empty
+      bool TryPop(T& element_)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_queue.empty()) return false;
+
+        m_free.push_back(std::move(element_));
+        element_ = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        lock.unlock();
+        m_not_full_cv.notify_one();
+        return true;
+      }
+
+      // wakes up all waiting producers and consumers, queued elements can still be popped
+      void Close()
+      {
+        {
+          const std::lock_guard<std::mutex> lock(m_mutex);
+          m_closed = true;
+        }
+        m_not_full_cv.notify_all();
+        m_not_empty_cv.notify_all();
+      }
+
+      void Reopen()
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = false;
+      }
+
+      SBoundedQueueStatistics GetStatistics() const
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        SBoundedQueueStatistics statistics(m_statistics);
+        statistics.depth = m_queue.size();
+        return statistics;
+      }
+
+    private:
+      const size_t             m_capacity;
+      const eOverflowPolicy    m_policy;
+
+      mutable std::mutex       m_mutex;
+      std::condition_variable  m_not_full_cv;
+      std::condition_variable  m_not_empty_cv;
+      std::deque<T>            m_queue;
+      std::vector<T>           m_free;
+      bool                     m_closed = false;
+      SBoundedQueueStatistics  m_statistics;
+    };
+  }
+}
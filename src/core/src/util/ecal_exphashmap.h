@@ -0,0 +1,454 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL hash map with time expiration (open addressing)
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief Combine two hash values (boost::hash_combine)
+    **/
+    inline size_t HashCombine(size_t seed_, size_t value_)
+    {
+      return seed_ ^ (value_ + 0x9e3779b9 + (seed_ << 6) + (seed_ >> 2));
+    }
+
+    /**
+    * @brief A time expiration map, drop-in replacement for CExpMap
+    *
+    * Elements are stored in one contiguous slot array with linear probing, a separate control
+    * byte array (state + 7 hash bits) keeps the probe sequences within a few cache lines.
+    * Every slot carries its own access timestamp, so touching an element is a single store.
+    * The oldest timestamp in the map is tracked as a lower bound, remove_deprecated returns
+    * immediately if nothing can be expired and otherwise purges with one linear scan.
+    * Iteration order is unspecified.
+    **/
+    template<class Key,
+      class T,
+      class Hash = std::hash<Key>,
+      class KeyEqual = std::equal_to<Key> >
+      class CExpHashMap
+    {
+    public:
+      using clock_type = std::chrono::steady_clock;
+
+      using value_type      = std::pair<const Key, T>;
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using key_type        = Key;
+      using mapped_type     = T;
+      using hasher          = Hash;
+      using key_equal       = KeyEqual;
+
+    private:
+      // control byte values, used slots store 0x80 | 7 hash bits
+      enum : uint8_t
+      {
+        ctrl_empty  = 0x00,
+        ctrl_erased = 0x01,
+        ctrl_used   = 0x80,
+      };
+
+      enum : size_type
+      {
+        npos         = static_cast<size_type>(-1),
+        min_capacity = 16,
+      };
+
+      struct SSlot
+      {
+        std::pair<Key, T>       value;
+        clock_type::time_point  timestamp;
+      };
+
+    public:
+      class const_iterator;
+
+      class iterator
+      {
+        friend class CExpHashMap;
+        friend class const_iterator;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<const Key&, T&>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::pair<const Key&, T&>;
+
+        iterator& operator++()
+        {
+          idx = map->next_used(idx + 1);
+          return *this;
+        } //prefix increment
+
+        reference operator*() const
+        {
+          auto& value = map->_slots[idx].value;
+          return reference(value.first, value.second);
+        }
+
+        bool operator==(const iterator& rhs) const { return idx == rhs.idx; }
+        bool operator!=(const iterator& rhs) const { return idx != rhs.idx; }
+
+      private:
+        iterator(CExpHashMap* map_, size_type idx_) : map(map_), idx(idx_) {}
+
+        CExpHashMap* map;
+        size_type    idx;
+      };
+
+      class const_iterator
+      {
+        friend class CExpHashMap;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<const Key&, const T&>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::pair<const Key&, const T&>;
+
+        const_iterator(const iterator& other) : map(other.map), idx(other.idx) {}
+
+        const_iterator& operator++()
+        {
+          idx = map->next_used(idx + 1);
+          return *this;
+        } //prefix increment
+
+        reference operator*() const
+        {
+          const auto& value = map->_slots[idx].value;
+          return reference(value.first, value.second);
+        }
+
+        bool operator==(const const_iterator& rhs) const { return idx == rhs.idx; }
+        bool operator!=(const const_iterator& rhs) const { return idx != rhs.idx; }
+
+      private:
+        const_iterator(const CExpHashMap* map_, size_type idx_) : map(map_), idx(idx_) {}
+
+        const CExpHashMap* map;
+        size_type          idx;
+      };
+
+      // Constructor specifies the timeout of the map
+      CExpHashMap() : CExpHashMap(std::chrono::milliseconds(5000)) {};
+      CExpHashMap(clock_type::duration t) : _timeout(t), _size(0), _erased(0), _oldest(clock_type::time_point::max()) {};
+
+      /**
+      * @brief  set expiration time
+      **/
+      void set_expiration(clock_type::duration t) { _timeout = t; };
+
+      // Iterators:
+      iterator begin() noexcept
+      {
+        return iterator(this, next_used(0));
+      }
+
+      iterator end() noexcept
+      {
+        return iterator(this, _slots.size());
+      }
+
+      const_iterator begin() const noexcept
+      {
+        return const_iterator(this, next_used(0));
+      }
+
+      const_iterator end() const noexcept
+      {
+        return const_iterator(this, _slots.size());
+      }
+
+      // Const begin and end functions
+      const_iterator cbegin() const noexcept {
+        return begin();
+      }
+
+      const_iterator cend() const noexcept {
+        return end();
+      }
+
+      // Capacity
+      bool empty() const noexcept
+      {
+        return _size == 0;
+      }
+
+      size_type size() const noexcept
+      {
+        return _size;
+      }
+
+      size_type max_size() const noexcept
+      {
+        return _slots.max_size();
+      }
+
+      // Element access
+      // Obtain value for k and refresh its timestamp, a default value is created if k is unknown
+      T& operator[](const Key& k)
+      {
+        const size_t    hash = Hash()(k);
+        const size_type idx  = find_index(k, hash);
+        const auto      now  = get_curr_time();
+
+        if (idx != npos)
+        {
+          _slots[idx].timestamp = now;
+          return _slots[idx].value.second;
+        }
+
+        return _slots[insert_new(k, T{}, hash, now)].value.second;
+      };
+
+      mapped_type& at(const key_type& k)
+      {
+        const size_type idx = find_index(k, Hash()(k));
+        if (idx == npos) throw std::out_of_range("CExpHashMap::at");
+        return _slots[idx].value.second;
+      }
+
+      const mapped_type& at(const key_type& k) const
+      {
+        const size_type idx = find_index(k, Hash()(k));
+        if (idx == npos) throw std::out_of_range("CExpHashMap::at");
+        return _slots[idx].value.second;
+      }
+
+      // Modifiers
+      std::pair<iterator, bool> insert(const value_type& val)
+      {
+        const size_t    hash = Hash()(val.first);
+        const size_type idx  = find_index(val.first, hash);
+        if (idx != npos) return std::make_pair(iterator(this, idx), false);
+
+        return std::make_pair(iterator(this, insert_new(val.first, val.second, hash, get_curr_time())), true);
+      }
+
+      // Operations
+      iterator find(const key_type& k)
+      {
+        const size_type idx = find_index(k, Hash()(k));
+        return (idx == npos) ? end() : iterator(this, idx);
+      }
+
+      const_iterator find(const Key& k) const
+      {
+        const size_type idx = find_index(k, Hash()(k));
+        return (idx == npos) ? end() : const_iterator(this, idx);
+      }
+
+      // Purge the timed out elements from the cache
+      void remove_deprecated(std::list<Key>* key_erased = nullptr) //-V826
+      {
+        const clock_type::time_point eviction_limit = get_curr_time() - _timeout;
+        if (_size == 0 || !(_oldest < eviction_limit)) return;
+
+        purge(eviction_limit, [key_erased](SSlot& slot_)
+          {
+            if (key_erased != nullptr) key_erased->push_back(slot_.value.first);
+          });
+      }
+
+      // Purge the timed out elements from the cache and hand out their last values
+      void remove_deprecated(std::list<std::pair<Key, T>>& erased_)
+      {
+        const clock_type::time_point eviction_limit = get_curr_time() - _timeout;
+        if (_size == 0 || !(_oldest < eviction_limit)) return;
+
+        purge(eviction_limit, [&erased_](SSlot& slot_)
+          {
+            erased_.emplace_back(slot_.value.first, std::move(slot_.value.second));
+          });
+      }
+
+      // Remove specific element from the cache
+      bool erase(const Key& k)
+      {
+        const size_type idx = find_index(k, Hash()(k));
+        if (idx == npos) return false;
+
+        erase_index(idx);
+        return true;
+      }
+
+      // Remove all elements from the cache
+      void clear()
+      {
+        _ctrl.clear();
+        _slots.clear();
+        _size   = 0;
+        _erased = 0;
+        _oldest = clock_type::time_point::max();
+      }
+
+    private:
+      static uint8_t ctrl_tag(size_t hash_)
+      {
+        // the low bits select the slot, use the high bits to filter probes
+        return static_cast<uint8_t>(ctrl_used | ((hash_ >> (sizeof(size_t) * 8 - 7)) & 0x7f));
+      }
+
+      size_type next_used(size_type idx_) const
+      {
+        while (idx_ < _ctrl.size() && (_ctrl[idx_] & ctrl_used) == 0) ++idx_;
+        return idx_;
+      }
+
+      size_type find_index(const Key& k, size_t hash_) const
+      {
+        if (_ctrl.empty()) return npos;
+
+        const size_type mask = _ctrl.size() - 1;
+        const uint8_t   tag  = ctrl_tag(hash_);
+        for (size_type idx = hash_ & mask, probes = 0; probes < _ctrl.size(); idx = (idx + 1) & mask, ++probes)
+        {
+          const uint8_t ctrl = _ctrl[idx];
+          if (ctrl == ctrl_empty) return npos;
+          if (ctrl == tag && KeyEqual()(_slots[idx].value.first, k)) return idx;
+        }
+        return npos;
+      }
+
+      // Record a fresh key-value pair, the key must not be in the map
+      size_type insert_new(const Key& k, const T& v, size_t hash_, clock_type::time_point now_)
+      {
+        // keep used + erased slots below 3/4 of the capacity
+        if ((_size + _erased + 1) * 4 > _ctrl.size() * 3) rehash();
+
+        const size_type mask = _ctrl.size() - 1;
+        size_type idx = hash_ & mask;
+        while ((_ctrl[idx] & ctrl_used) != 0) idx = (idx + 1) & mask;
+
+        if (_ctrl[idx] == ctrl_erased) --_erased;
+        _ctrl[idx]            = ctrl_tag(hash_);
+        _slots[idx].value     = std::pair<Key, T>(k, v);
+        _slots[idx].timestamp = now_;
+        ++_size;
+
+        if (now_ < _oldest) _oldest = now_;
+        return idx;
+      }
+
+      void erase_index(size_type idx_)
+      {
+        // keep the probe chain intact if the next slot is in use
+        const size_type next = (idx_ + 1) & (_ctrl.size() - 1);
+        if (_ctrl[next] == ctrl_empty)
+        {
+          _ctrl[idx_] = ctrl_empty;
+        }
+        else
+        {
+          _ctrl[idx_] = ctrl_erased;
+          ++_erased;
+        }
+        _slots[idx_].value = std::pair<Key, T>();
+        --_size;
+      }
+
+      // Grow (or just clean up erased slots) and reinsert all elements
+      void rehash()
+      {
+        size_type capacity = min_capacity;
+        while (capacity * 3 < (_size + 1) * 4 * 2) capacity *= 2;
+
+        std::vector<uint8_t> ctrl(capacity, ctrl_empty);
+        std::vector<SSlot>   slots(capacity);
+        const size_type      mask = capacity - 1;
+
+        for (size_type old_idx = 0; old_idx < _ctrl.size(); ++old_idx)
+        {
+          if ((_ctrl[old_idx] & ctrl_used) == 0) continue;
+
+          SSlot& slot = _slots[old_idx];
+          size_type idx = Hash()(slot.value.first) & mask;
+          while (ctrl[idx] != ctrl_empty) idx = (idx + 1) & mask;
+
+          ctrl[idx]  = _ctrl[old_idx];
+          slots[idx] = std::move(slot);
+        }
+
+        _ctrl.swap(ctrl);
+        _slots.swap(slots);
+        _erased = 0;
+      }
+
+      template <typename Handler>
+      void purge(clock_type::time_point eviction_limit_, Handler handler_)
+      {
+        clock_type::time_point oldest = clock_type::time_point::max();
+        for (size_type idx = 0; idx < _ctrl.size(); ++idx)
+        {
+          if ((_ctrl[idx] & ctrl_used) == 0) continue;
+
+          SSlot& slot = _slots[idx];
+          if (slot.timestamp < eviction_limit_)
+          {
+            handler_(slot);
+            erase_index(idx);
+          }
+          else if (slot.timestamp < oldest)
+          {
+            oldest = slot.timestamp;
+          }
+        }
+        _oldest = oldest;
+      }
+
+      clock_type::time_point get_curr_time()
+      {
+        return clock_type::now();
+      }
+
+      // Control bytes and slots, same size (power of two)
+      std::vector<uint8_t> _ctrl;
+      std::vector<SSlot>   _slots;
+
+      // Timeout of map
+      clock_type::duration _timeout;
+
+      size_type            _size;
+      size_type            _erased;
+
+      // Lower bound of all element timestamps
+      clock_type::time_point _oldest;
+    };
+  }
+}
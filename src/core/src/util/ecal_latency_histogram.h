@@ -0,0 +1,163 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL lock free latency histogram
+**/
+
+#pragma once
+
+#include <ecal/types/monitoring.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief HDR style latency histogram with log linear buckets (relative error < 12.5 %).
+    *
+    * Values are recorded in nanoseconds (up to ~18 minutes, larger values are counted in the
+    * last bucket) with relaxed atomics only, so recording never blocks. Readers get a
+    * consistent enough summary while values are recorded concurrently.
+    **/
+    class CLatencyHistogram
+    {
+    public:
+      CLatencyHistogram() = default;
+
+      CLatencyHistogram(const CLatencyHistogram&) = delete;
+      CLatencyHistogram& operator=(const CLatencyHistogram&) = delete;
+
+      void Record(std::int64_t value_ns_)
+      {
+        const std::uint64_t value = (value_ns_ > 0) ? static_cast<std::uint64_t>(value_ns_) : 0;
+
+        m_buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        std::uint64_t current_max = m_max.load(std::memory_order_relaxed);
+        while ((value > current_max) && !m_max.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {}
+        std::uint64_t current_min = m_min.load(std::memory_order_relaxed);
+        while ((value < current_min) && !m_min.compare_exchange_weak(current_min, value, std::memory_order_relaxed)) {}
+      }
+
+      template <class Rep, class Period>
+      void Record(std::chrono::duration<Rep, Period> duration_)
+      {
+        Record(static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration_).count()));
+      }
+
+      Monitoring::SLatencyMon GetSummary() const
+      {
+        std::array<std::uint64_t, bucket_count> buckets;
+        std::uint64_t count(0);
+        for (std::size_t idx = 0; idx < bucket_count; ++idx)
+        {
+          buckets[idx] = m_buckets[idx].load(std::memory_order_relaxed);
+          count += buckets[idx];
+        }
+
+        Monitoring::SLatencyMon summary;
+        if (count == 0) return summary;
+
+        // minimum / maximum may lag behind the buckets while a value is recorded concurrently
+        const std::uint64_t max = m_max.load(std::memory_order_relaxed);
+        const std::uint64_t min = std::min(m_min.load(std::memory_order_relaxed), max);
+        summary.count = static_cast<std::int64_t>(count);
+        summary.min   = static_cast<std::int64_t>(min);
+        summary.max   = static_cast<std::int64_t>(max);
+        summary.mean  = static_cast<std::int64_t>(m_sum.load(std::memory_order_relaxed) / std::max<std::uint64_t>(1, m_count.load(std::memory_order_relaxed)));
+
+        // percentiles are reported as the upper bound of their bucket (limited by the maximum)
+        const auto percentile = [&buckets, count, max](std::uint64_t per_mille_)
+        {
+          const std::uint64_t rank = (count * per_mille_ + 999) / 1000;
+          std::uint64_t cumulated(0);
+          for (std::size_t idx = 0; idx < bucket_count; ++idx)
+          {
+            cumulated += buckets[idx];
+            if ((cumulated >= rank) && (cumulated != 0)) return static_cast<std::int64_t>(std::min(BucketUpperBound(idx), max));
+          }
+          return static_cast<std::int64_t>(max);
+        };
+        summary.p50  = percentile(500);
+        summary.p90  = percentile(900);
+        summary.p99  = percentile(990);
+        summary.p999 = percentile(999);
+
+        return summary;
+      }
+
+    private:
+      // 8 linear sub buckets per power of two
+      static constexpr int         sub_bucket_bits  = 3;
+      static constexpr std::size_t sub_bucket_count = std::size_t(1) << sub_bucket_bits;
+      static constexpr int         max_value_bits   = 40;
+      static constexpr std::size_t bucket_count     = (max_value_bits - sub_bucket_bits + 1) * sub_bucket_count;
+
+      static int MostSignificantBit(std::uint64_t value_)
+      {
+        int msb(0);
+        for (int shift = 32; shift > 0; shift >>= 1)
+        {
+          if ((value_ >> shift) != 0)
+          {
+            value_ >>= shift;
+            msb     += shift;
+          }
+        }
+        return msb;
+      }
+
+      static std::size_t BucketIndex(std::uint64_t value_)
+      {
+        if (value_ < sub_bucket_count) return static_cast<std::size_t>(value_);
+
+        const int msb = MostSignificantBit(value_);
+        if (msb >= max_value_bits) return bucket_count - 1;
+
+        const std::size_t sub_bucket = static_cast<std::size_t>(value_ >> (msb - sub_bucket_bits)) & (sub_bucket_count - 1);
+        return static_cast<std::size_t>(msb - sub_bucket_bits + 1) * sub_bucket_count + sub_bucket;
+      }
+
+      static std::uint64_t BucketUpperBound(std::size_t index_)
+      {
+        if (index_ < sub_bucket_count) return index_;
+        if (index_ == bucket_count - 1) return UINT64_MAX;
+
+        const int         shift      = static_cast<int>(index_ / sub_bucket_count) - 1;
+        const std::size_t sub_bucket = index_ % sub_bucket_count;
+        return ((static_cast<std::uint64_t>(sub_bucket_count + sub_bucket + 1)) << shift) - 1;
+      }
+
+      std::array<std::atomic<std::uint64_t>, bucket_count> m_buckets{};
+      std::atomic<std::uint64_t>                           m_count{0};
+      std::atomic<std::uint64_t>                           m_sum{0};
+      std::atomic<std::uint64_t>                           m_min{UINT64_MAX};
+      std::atomic<std::uint64_t>                           m_max{0};
+    };
+  }
+}
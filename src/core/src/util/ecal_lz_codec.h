@@ -0,0 +1,233 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL lz payload codec
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief Fast byte oriented LZ77 codec for network payloads (LZ4 like block format).
+    *
+    * A compressed frame is the uncompressed size (4 byte, little endian) followed by sequences of
+    * a token (literal length << 4 | match length - 4), extended lengths (255 continuation bytes),
+    * the literals, a 2 byte match offset and the match. The last sequence holds literals only.
+    * Matches are found with a single hash table lookup per position, incompressible input is
+    * skipped with growing steps.
+    **/
+    namespace LzCodec
+    {
+      // payloads smaller than this are not worth a compression
+      constexpr size_t min_input_size = 64;
+
+      namespace detail
+      {
+        constexpr int    hash_bits    = 14;
+        constexpr size_t min_match    = 4;
+        constexpr size_t max_offset   = 0xFFFF;
+        constexpr size_t header_size  = 4;
+        // the last bytes of the input are always literals
+        constexpr size_t end_literals = 5;
+
+        inline std::uint32_t Read32(const unsigned char* ptr_)
+        {
+          std::uint32_t value;
+          std::memcpy(&value, ptr_, sizeof(value));
+          return value;
+        }
+
+        inline std::uint32_t Hash(std::uint32_t value_)
+        {
+          return (value_ * 2654435761U) >> (32 - hash_bits);
+        }
+
+        inline unsigned char* WriteLength(unsigned char* out_, size_t length_)
+        {
+          for (; length_ >= 255; length_ -= 255) *out_++ = 255;
+          *out_++ = static_cast<unsigned char>(length_);
+          return out_;
+        }
+
+        inline bool ReadLength(const unsigned char*& in_, const unsigned char* in_end_, size_t& length_)
+        {
+          unsigned char byte(255);
+          while (byte == 255)
+          {
+            if (in_ >= in_end_) return false;
+            byte     = *in_++;
+            length_ += byte;
+          }
+          return true;
+        }
+      }
+
+      /**
+       * @brief Compress a payload.
+       *
+       * @param buf_  Payload.
+       * @param len_  Payload size.
+       * @param out_  Compressed frame (resized to its size).
+       *
+       * @return  False if the payload is too small or does not get smaller (send it uncompressed).
+      **/
+      inline bool Compress(const void* buf_, size_t len_, std::vector<char>& out_)
+      {
+        using namespace detail;
+        if ((len_ < min_input_size) || (len_ > 0xFFFFFFFFU)) return false;
+
+        // hash table of the last positions (+1, 0 == empty), reused by every call of the thread
+        thread_local std::vector<std::uint32_t> table;
+        table.assign(size_t(1) << hash_bits, 0);
+
+        // the frame has to be smaller than the input, worst case output is limited to that
+        const size_t capacity = len_ + len_ / 255 + 16 + header_size;
+        out_.resize(capacity);
+
+        const auto* const in  = static_cast<const unsigned char*>(buf_);
+        auto* const       out = reinterpret_cast<unsigned char*>(out_.data());
+        unsigned char*    op  = out;
+
+        const std::uint32_t raw_size = static_cast<std::uint32_t>(len_);
+        for (size_t idx = 0; idx < header_size; ++idx) *op++ = static_cast<unsigned char>(raw_size >> (8 * idx));
+
+        const auto emit_sequence = [&op, in](size_t anchor_, size_t literals_, size_t offset_, size_t match_)
+        {
+          unsigned char* token = op++;
+          *token = static_cast<unsigned char>((literals_ < 15 ? literals_ : 15) << 4);
+          if (literals_ >= 15) op = WriteLength(op, literals_ - 15);
+          std::memcpy(op, in + anchor_, literals_);
+          op += literals_;
+          if (match_ == 0) return;
+
+          *op++ = static_cast<unsigned char>(offset_);
+          *op++ = static_cast<unsigned char>(offset_ >> 8);
+          const size_t match_code = match_ - min_match;
+          *token |= static_cast<unsigned char>(match_code < 15 ? match_code : 15);
+          if (match_code >= 15) op = WriteLength(op, match_code - 15);
+        };
+
+        const size_t match_limit  = len_ - end_literals;
+        const size_t search_limit = match_limit - min_match;
+        size_t anchor(0);
+        size_t pos(0);
+        size_t misses(0);
+        while (pos < search_limit)
+        {
+          const std::uint32_t sequence  = Read32(in + pos);
+          std::uint32_t&      slot      = table[Hash(sequence)];
+          const size_t        candidate = slot;
+          slot = static_cast<std::uint32_t>(pos + 1);
+
+          if ((candidate == 0) || (pos + 1 - candidate > max_offset) || (Read32(in + candidate - 1) != sequence))
+          {
+            // skip faster through incompressible data
+            pos += 1 + (misses++ >> 6);
+            continue;
+          }
+
+          const size_t match_pos = candidate - 1;
+          size_t match = min_match;
+          while ((pos + match < match_limit) && (in[match_pos + match] == in[pos + match])) ++match;
+
+          emit_sequence(anchor, pos - anchor, pos - match_pos, match);
+          pos    += match;
+          anchor  = pos;
+          misses  = 0;
+
+          // stop as soon as the frame can not get smaller than the input anymore
+          if (static_cast<size_t>(op - out) >= len_) return false;
+        }
+        emit_sequence(anchor, len_ - anchor, 0, 0);
+
+        const size_t out_size = static_cast<size_t>(op - out);
+        if (out_size >= len_) return false;
+        out_.resize(out_size);
+        return true;
+      }
+
+      /**
+       * @brief Decompress a frame created by Compress.
+       *
+       * @param buf_  Compressed frame.
+       * @param len_  Compressed frame size.
+       * @param out_  Payload (resized to its size).
+       *
+       * @return  False if the frame is corrupted.
+      **/
+      inline bool Decompress(const char* buf_, size_t len_, std::vector<char>& out_)
+      {
+        using namespace detail;
+        if (len_ < header_size) return false;
+
+        const auto*       ip     = reinterpret_cast<const unsigned char*>(buf_);
+        const auto* const in_end = ip + len_;
+
+        std::uint32_t raw_size(0);
+        for (size_t idx = 0; idx < header_size; ++idx) raw_size |= static_cast<std::uint32_t>(*ip++) << (8 * idx);
+        // a match byte expands to 255 bytes at most, do not allocate for corrupted sizes
+        if (raw_size / 255 > len_) return false;
+        out_.resize(raw_size);
+
+        auto* const out = reinterpret_cast<unsigned char*>(out_.data());
+        size_t      op(0);
+        while (ip < in_end)
+        {
+          const unsigned char token = *ip++;
+
+          // literals
+          size_t literals = token >> 4;
+          if ((literals == 15) && !ReadLength(ip, in_end, literals)) return false;
+          if ((literals > static_cast<size_t>(in_end - ip)) || (literals > raw_size - op)) return false;
+          std::memcpy(out + op, ip, literals);
+          ip += literals;
+          op += literals;
+
+          // last sequence
+          if (ip == in_end) break;
+
+          // match
+          if (in_end - ip < 2) return false;
+          const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+          ip += 2;
+          size_t match = token & 0x0F;
+          if ((match == 15) && !ReadLength(ip, in_end, match)) return false;
+          match += min_match;
+          if ((offset == 0) || (offset > op) || (match > raw_size - op)) return false;
+
+          // overlapping matches repeat the last offset bytes
+          const unsigned char* source = out + op - offset;
+          if (offset >= match) std::memcpy(out + op, source, match);
+          else for (size_t idx = 0; idx < match; ++idx) out[op + idx] = source[idx];
+          op += match;
+        }
+
+        return op == raw_size;
+      }
+    }
+  }
+}
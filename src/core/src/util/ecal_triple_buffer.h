@@ -0,0 +1,85 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL wait free triple buffer
+**/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief Single producer / single consumer triple buffer holding the latest value.
+    *
+    * The producer fills the back slot and publishes it by exchanging it with the middle slot,
+    * the consumer takes the middle slot (if it was published since the last update) by exchanging
+    * it with its front slot. Both sides are wait free and own their slot exclusively, so slots
+    * are never copied and keep their allocated storage.
+    **/
+    template <typename T>
+    class CTripleBuffer
+    {
+    public:
+      CTripleBuffer() = default;
+      explicit CTripleBuffer(const T& initial_) : m_slots{ { initial_, initial_, initial_ } } {}
+
+      CTripleBuffer(const CTripleBuffer&) = delete;
+      CTripleBuffer& operator=(const CTripleBuffer&) = delete;
+
+      // producer, slot to fill before Publish
+      T& Back() { return m_slots[m_back]; }
+
+      // producer, publishes the back slot (an unread published slot is overwritten)
+      void Publish()
+      {
+        const std::uint8_t middle = m_middle.exchange(static_cast<std::uint8_t>(m_back | dirty_flag), std::memory_order_acq_rel);
+        m_back = middle & index_mask;
+      }
+
+      // consumer, takes the latest published slot, returns false if nothing was published since the last update
+      bool Update()
+      {
+        if ((m_middle.load(std::memory_order_relaxed) & dirty_flag) == 0) return false;
+
+        const std::uint8_t middle = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = middle & index_mask;
+        return true;
+      }
+
+      // consumer, latest slot taken by Update
+      const T& Front() const { return m_slots[m_front]; }
+
+    private:
+      static constexpr std::uint8_t index_mask = 0x3;
+      static constexpr std::uint8_t dirty_flag = 0x4;
+
+      std::array<T, 3>          m_slots{};
+      std::uint8_t              m_back  = 0;
+      std::atomic<std::uint8_t> m_middle{1};
+      std::uint8_t              m_front = 2;
+    };
+  }
+}
@@ -20,8 +20,14 @@
 #include <ecal/ecal.h>
 #include <ecal/msg/string/publisher.h>
 #include <ecal/msg/string/subscriber.h>
+
+#include "config/ecal_config_snapshot.h"
+#include "readwrite/ecal_writer.h"
+
 #include <algorithm>
 #include <atomic>
+#include <memory>
+#include <string>
 #include <thread>
 #include <vector>
 #include <gtest/gtest.h>
@@ -36,6 +42,20 @@ namespace {
     accumulated_clock += clock_;
   }
 
+  bool ContainsTopic(const std::vector<std::shared_ptr<const eCAL::Monitoring::STopicMon>>& topics_, const std::string& topic_name_)
+  {
+    return std::any_of(topics_.begin(), topics_.end(), [&topic_name_](const std::shared_ptr<const eCAL::Monitoring::STopicMon>& topic_) { return topic_->tname == topic_name_; });
+  }
+
+  int GetTopicRegistrationClock(const std::vector<std::shared_ptr<const eCAL::Monitoring::STopicMon>>& topics_, const std::string& topic_name_)
+  {
+    for (const auto& topic : topics_)
+    {
+      if (topic->tname == topic_name_) return topic->rclock;
+    }
+    return -1;
+  }
+
 #if 0
   // timer callback function
   std::atomic_size_t     g_callback_received{ 0 };
@@ -70,11 +90,11 @@ TEST(Core, LeakedPubSub)
   eCAL::Util::EnableLoopback(true);
 
   // create subscriber and register a callback
-  eCAL::string::CSubscriber<std::string> sub("foo");
+  eCAL::string::CSubscriber<std::string> sub("core_foo");
   sub.AddReceiveCallback(std::bind(OnReceive, std::placeholders::_4));
 
   // create publisher
-  eCAL::string::CPublisher<std::string> pub("foo");
+  eCAL::string::CPublisher<std::string> pub("core_foo");
 
   // let's match them
   eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
@@ -123,7 +143,7 @@ TEST(Core, CallbackDestruction)
     std::shared_ptr<eCAL::string::CSubscriber<std::string>> sub;
 
     // create publisher
-    eCAL::string::CPublisher<std::string> pub("foo");
+    eCAL::string::CPublisher<std::string> pub("core_foo");
 
     // start publishing thread
     std::atomic<bool> pub_stop(false);
@@ -146,7 +166,7 @@ TEST(Core, CallbackDestruction)
     std::atomic<bool> sub_stop(false);
     std::thread sub_t([&]() {
       while (!sub_stop) {
-        sub = std::make_shared<eCAL::string::CSubscriber<std::string>>("foo");
+        sub = std::make_shared<eCAL::string::CSubscriber<std::string>>("core_foo");
         sub->AddReceiveCallback(std::bind(OnReceive, std::placeholders::_4));
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
       }
@@ -168,6 +188,114 @@ TEST(Core, CallbackDestruction)
   }
 }
 
+TEST(Core, MonitoringSnapshotDelta)
+{
+  // initialize eCAL API including monitoring
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "monitoring snapshot/delta", eCAL::Init::All));
+
+  // enable loop back communication in the same thread
+  eCAL::Util::EnableLoopback(true);
+
+  // create publisher and let it register
+  const std::string topic_name("monitoring_snapshot_delta");
+  auto pub = std::make_unique<eCAL::string::CPublisher<std::string>>(topic_name);
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // the snapshot contains the publisher
+  auto snapshot = eCAL::Monitoring::GetMonitoringSnapshot();
+  ASSERT_NE(nullptr, snapshot);
+  EXPECT_TRUE(ContainsTopic(snapshot->entities.publisher, topic_name));
+
+  // registration refreshes without any content change are no update
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  eCAL::Monitoring::SMonitoringDelta delta;
+  eCAL::Monitoring::GetMonitoringDelta(snapshot->version, delta, eCAL::Monitoring::Entity::Publisher);
+  EXPECT_FALSE(delta.full);
+  EXPECT_FALSE(ContainsTopic(delta.changed.publisher, topic_name));
+  EXPECT_FALSE(ContainsTopic(delta.removed.publisher, topic_name));
+
+  // but the registration clock of the stored entity keeps increasing
+  // (the version itself may move with entities of other processes on this host)
+  const auto refreshed_snapshot = eCAL::Monitoring::GetMonitoringSnapshot();
+  ASSERT_NE(nullptr, refreshed_snapshot);
+  EXPECT_LT(GetTopicRegistrationClock(snapshot->entities.publisher, topic_name), GetTopicRegistrationClock(refreshed_snapshot->entities.publisher, topic_name));
+
+  // sending data changes the data clock
+  uint64_t version = delta.version;
+  pub->Send("Hello World");
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  eCAL::Monitoring::GetMonitoringDelta(version, delta, eCAL::Monitoring::Entity::Publisher);
+  EXPECT_FALSE(delta.full);
+  EXPECT_TRUE(ContainsTopic(delta.changed.publisher, topic_name));
+
+  // the destroyed publisher is reported as removed
+  version = delta.version;
+  pub.reset();
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  eCAL::Monitoring::GetMonitoringDelta(version, delta, eCAL::Monitoring::Entity::Publisher);
+  EXPECT_FALSE(ContainsTopic(delta.changed.publisher, topic_name));
+  EXPECT_TRUE(ContainsTopic(delta.removed.publisher, topic_name));
+
+  // an unknown version is answered with the complete registry
+  eCAL::Monitoring::GetMonitoringDelta(0, delta, eCAL::Monitoring::Entity::Publisher);
+  EXPECT_TRUE(delta.full);
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(Core, LazyLayerCreation)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "lazy layer creation", eCAL::Init::Publisher));
+
+  // create the transport layers on the first matching subscription
+  auto config = *eCAL::Config::GetSnapshot();
+  config.lazy_layer_creation = true;
+  eCAL::Config::PublishSnapshot(config);
+
+  // a local subscriber reading the memory file only needs the shm layer
+  {
+    eCAL::CDataWriter writer;
+    ASSERT_TRUE(writer.Create("lazy_layer_creation_loc", eCAL::SDataTypeInformation()));
+    EXPECT_FALSE(writer.IsLayerCreated(eCAL::TLayer::tlayer_shm));
+    EXPECT_FALSE(writer.IsLayerCreated(eCAL::TLayer::tlayer_udp_mc));
+
+    eCAL::CDataWriter::SLocalSubscriptionInfo local_info;
+    local_info.process_id = "1";
+    local_info.topic_id   = "1";
+    writer.ApplyLocSubscription(local_info, eCAL::SDataTypeInformation(), "", eCAL::SSampleFilter(), eCAL::TLayer::compression_none, true);
+    EXPECT_TRUE(writer.IsLayerCreated(eCAL::TLayer::tlayer_shm));
+    EXPECT_FALSE(writer.IsLayerCreated(eCAL::TLayer::tlayer_udp_mc));
+    EXPECT_FALSE(writer.IsLayerCreated(eCAL::TLayer::tlayer_tcp));
+  }
+
+  // an external subscriber only needs the network layers
+  {
+    eCAL::CDataWriter writer;
+    ASSERT_TRUE(writer.Create("lazy_layer_creation_ext", eCAL::SDataTypeInformation()));
+
+    eCAL::CDataWriter::SExternalSubscriptionInfo external_info;
+    external_info.host_name  = "lazy_layer_creation_host";
+    external_info.process_id = "1";
+    external_info.topic_id   = "1";
+    writer.ApplyExtSubscription(external_info, eCAL::SDataTypeInformation(), "", eCAL::SSampleFilter(), eCAL::TLayer::compression_none);
+    EXPECT_FALSE(writer.IsLayerCreated(eCAL::TLayer::tlayer_shm));
+    EXPECT_TRUE(writer.IsLayerCreated(eCAL::TLayer::tlayer_udp_mc));
+
+    // a following local subscriber adds the shm layer
+    eCAL::CDataWriter::SLocalSubscriptionInfo local_info;
+    local_info.process_id = "2";
+    local_info.topic_id   = "2";
+    writer.ApplyLocSubscription(local_info, eCAL::SDataTypeInformation(), "", eCAL::SSampleFilter(), eCAL::TLayer::compression_none, true);
+    EXPECT_TRUE(writer.IsLayerCreated(eCAL::TLayer::tlayer_shm));
+    EXPECT_TRUE(writer.IsLayerCreated(eCAL::TLayer::tlayer_udp_mc));
+  }
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
 /* excluded for now, system timer jitter too high */
 #if 0
 TEST(Core, TimerCallback)
@@ -0,0 +1,173 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include "util/ecal_exphashmap.h"
+
+#include <string>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(ExpHashMap, ExpHashMapSetGet)
+{
+  eCAL::Util::CExpHashMap<std::string, int> expmap(std::chrono::milliseconds(200));
+
+  expmap["A"] = 1;
+  EXPECT_EQ(1, expmap["A"]);
+  EXPECT_EQ(1, expmap.size());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+
+  // access and reset timer
+  EXPECT_EQ(1, expmap["A"]);
+  expmap.remove_deprecated();
+  EXPECT_EQ(1, expmap.size());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap.remove_deprecated();
+  EXPECT_EQ(1, expmap.size());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap.remove_deprecated();
+  EXPECT_EQ(0, expmap.size());
+
+  expmap["A"] = 1;
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap["B"] = 2;
+  expmap["C"] = 3;
+  expmap.remove_deprecated();
+  EXPECT_EQ(3, expmap.size());
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap["B"] = 4;
+  expmap.remove_deprecated();
+  EXPECT_EQ(2, expmap.size());
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap.remove_deprecated();
+  EXPECT_EQ(1, expmap.size());
+  EXPECT_EQ(4, expmap["B"]);
+}
+
+TEST(ExpHashMap, ExpHashMapInsert)
+{
+  eCAL::Util::CExpHashMap<std::string, int> expmap(std::chrono::milliseconds(200));
+  auto ret = expmap.insert(std::make_pair("A", 1));
+  EXPECT_TRUE(ret.second);
+
+  auto key = (*ret.first).first;
+  auto value = (*ret.first).second;
+  EXPECT_EQ(std::string("A"), key);
+  EXPECT_EQ(1, value);
+
+  // existing elements are not overwritten
+  ret = expmap.insert(std::make_pair("A", 2));
+  EXPECT_FALSE(ret.second);
+  EXPECT_EQ(1, expmap["A"]);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  expmap.remove_deprecated();
+  EXPECT_EQ(0, expmap.size());
+}
+
+TEST(ExpHashMap, ExpHashMapFindConst)
+{
+  eCAL::Util::CExpHashMap<std::string, int> expmap(std::chrono::milliseconds(200));
+
+  auto it = expmap.find("A");
+  EXPECT_EQ(expmap.end(), it);
+
+  expmap["A"] = 1;
+
+  const auto& const_ref_exmap = expmap;
+  auto const_it = const_ref_exmap.find("A");
+  static_assert(std::is_same<decltype(const_it), eCAL::Util::CExpHashMap<std::string, int>::const_iterator>::value, "We're not being returned a const_iterator from find.");
+  EXPECT_EQ(1, (*const_it).second);
+}
+
+TEST(ExpHashMap, ExpHashMapIterate)
+{
+  eCAL::Util::CExpHashMap<int, int> expmap(std::chrono::milliseconds(200));
+  for (int i = 0; i < 1000; ++i) expmap[i] = 2 * i;
+
+  // iteration order is unspecified, so check the sum
+  int count(0);
+  long long key_sum(0);
+  long long value_sum(0);
+  const auto& const_ref_exmap = expmap;
+  for (auto&& entry : const_ref_exmap)
+  {
+    ++count;
+    key_sum   += entry.first;
+    value_sum += entry.second;
+  }
+  EXPECT_EQ(1000, count);
+  EXPECT_EQ(499500, key_sum);
+  EXPECT_EQ(999000, value_sum);
+
+  // values can be modified through the iterator
+  for (auto&& entry : expmap) entry.second = 1;
+  EXPECT_EQ(1, expmap.at(500));
+}
+
+TEST(ExpHashMap, ExpHashMapRemove)
+{
+  eCAL::Util::CExpHashMap<int, int> expmap(std::chrono::milliseconds(200));
+  for (int i = 0; i < 1000; ++i) expmap[i] = i;
+  EXPECT_EQ(1000, expmap.size());
+
+  // erase every second element and check that the probe sequences are still intact
+  for (int i = 0; i < 1000; i += 2) EXPECT_TRUE(expmap.erase(i));
+  EXPECT_FALSE(expmap.erase(0));
+  EXPECT_EQ(500, expmap.size());
+  for (int i = 1; i < 1000; i += 2) EXPECT_EQ(i, (*expmap.find(i)).second);
+  for (int i = 0; i < 1000; i += 2) EXPECT_EQ(expmap.end(), expmap.find(i));
+
+  // reuse erased slots
+  for (int i = 0; i < 1000; i += 2) expmap[i] = i;
+  EXPECT_EQ(1000, expmap.size());
+
+  expmap.clear();
+  EXPECT_TRUE(expmap.empty());
+  EXPECT_EQ(expmap.begin(), expmap.end());
+}
+
+TEST(ExpHashMap, ExpHashMapRemoveDeprecatedKeys)
+{
+  eCAL::Util::CExpHashMap<std::string, int> expmap(std::chrono::milliseconds(100));
+  expmap["A"] = 1;
+  expmap["B"] = 2;
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  expmap["B"] = 3;
+
+  std::list<std::string> erased_keys;
+  expmap.remove_deprecated(&erased_keys);
+  ASSERT_EQ(1, erased_keys.size());
+  EXPECT_EQ(std::string("A"), erased_keys.front());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  std::list<std::pair<std::string, int>> erased;
+  expmap.remove_deprecated(erased);
+  ASSERT_EQ(1, erased.size());
+  EXPECT_EQ(std::string("B"), erased.front().first);
+  EXPECT_EQ(3, erased.front().second);
+  EXPECT_TRUE(expmap.empty());
+}
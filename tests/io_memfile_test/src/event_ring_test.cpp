@@ -0,0 +1,132 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "registration/shm/relocatable_event_ring.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  struct SEvent
+  {
+    std::uint64_t id;
+    std::uint64_t check;
+  };
+
+  using EventRingT = RelocatableEventRing<SEvent>;
+}
+
+TEST(EventRing, EventRingPushRead)
+{
+  std::vector<std::uint64_t> memory(EventRingT::PresumablyOccupiedMemorySize(8) / sizeof(std::uint64_t) + 1);
+
+  EventRingT writer;
+  writer.SetBaseAddress(memory.data());
+  writer.Reset(8);
+
+  // a second instance on the same memory, like a reader process
+  EventRingT reader;
+  reader.SetBaseAddress(memory.data());
+  EXPECT_EQ(8, reader.Capacity());
+  EXPECT_EQ(0, reader.WriteIndex());
+
+  SEvent event{};
+  EXPECT_FALSE(reader.Read(0, event));
+
+  for (std::uint64_t id = 0; id < 5; ++id) writer.Push({ id, ~id });
+  EXPECT_EQ(5, reader.WriteIndex());
+  EXPECT_EQ(0, reader.FirstReadableIndex());
+  for (std::uint64_t index = 0; index < 5; ++index)
+  {
+    ASSERT_TRUE(reader.Read(index, event));
+    EXPECT_EQ(index, event.id);
+  }
+
+  // overwrite the oldest events
+  for (std::uint64_t id = 5; id < 12; ++id) writer.Push({ id, ~id });
+  EXPECT_EQ(12, reader.WriteIndex());
+  EXPECT_EQ(4, reader.FirstReadableIndex());
+  EXPECT_FALSE(reader.Read(3, event));
+  ASSERT_TRUE(reader.Read(4, event));
+  EXPECT_EQ(4, event.id);
+
+  // flushed events are skipped
+  writer.Flush();
+  EXPECT_EQ(12, reader.FirstReadableIndex());
+  writer.Push({ 12, ~std::uint64_t(12) });
+  ASSERT_TRUE(reader.Read(12, event));
+  EXPECT_EQ(12, event.id);
+}
+
+TEST(EventRing, EventRingConcurrentReaders)
+{
+  const std::uint64_t capacity(64);
+  const std::uint64_t event_count(200000);
+  std::vector<std::uint64_t> memory(EventRingT::PresumablyOccupiedMemorySize(capacity) / sizeof(std::uint64_t) + 1);
+
+  EventRingT writer;
+  writer.SetBaseAddress(memory.data());
+  writer.Reset(capacity);
+
+  // every reader follows the writer with its own cursor, events are either read consistently or detected as lost
+  std::atomic<bool> torn_event(false);
+  std::atomic<bool> order_violation(false);
+  std::vector<std::thread> readers;
+  for (int reader_num = 0; reader_num < 3; ++reader_num)
+  {
+    readers.emplace_back([&memory, &torn_event, &order_violation, event_count]()
+      {
+        EventRingT reader;
+        reader.SetBaseAddress(memory.data());
+
+        std::uint64_t read_index(0);
+        std::uint64_t last_id(0);
+        bool first_event(true);
+        while (read_index < event_count)
+        {
+          const std::uint64_t write_index = reader.WriteIndex();
+          const std::uint64_t first_index = reader.FirstReadableIndex();
+          if (read_index < first_index) read_index = first_index;
+          for (; read_index < write_index; ++read_index)
+          {
+            SEvent event{};
+            if (!reader.Read(read_index, event)) continue;
+            if (event.check != ~event.id)                   torn_event      = true;
+            if (event.id != read_index)                     torn_event      = true;
+            if (!first_event && (event.id <= last_id))      order_violation = true;
+            last_id     = event.id;
+            first_event = false;
+          }
+          std::this_thread::yield();
+        }
+      });
+  }
+
+  for (std::uint64_t id = 0; id < event_count; ++id) writer.Push({ id, ~id });
+  for (auto& reader : readers) reader.join();
+
+  EXPECT_FALSE(torn_event);
+  EXPECT_FALSE(order_violation);
+  EXPECT_EQ(event_count, writer.WriteIndex());
+}
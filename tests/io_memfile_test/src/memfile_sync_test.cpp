@@ -0,0 +1,163 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "ecal_event.h"
+#include "io/shm/ecal_memfile_sync.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  class CStringPayload : public eCAL::CPayloadWriter
+  {
+  public:
+    explicit CStringPayload(std::string s_) : s(std::move(s_)) {}
+
+    bool WriteFull(void* buf_, size_t len_) override
+    {
+      if (len_ < s.size()) return false;
+      memcpy(buf_, s.data(), s.size());
+      return true;
+    }
+
+    size_t GetSize() override { return s.size(); }
+
+  private:
+    std::string s;
+  };
+
+  eCAL::SSyncMemoryFileAttr SyncMemoryFileAttr()
+  {
+    eCAL::SSyncMemoryFileAttr attr{};
+    attr.min_size        = 4096;
+    attr.reserve         = 50;
+    attr.timeout_open_ms = 100;
+    attr.timeout_ack_ms  = 0;
+    return attr;
+  }
+
+  // a local subscriber acknowledging every memory file update after some processing time
+  class CAckResponder
+  {
+  public:
+    CAckResponder(const std::string& memfile_name_, const std::string& process_id_, int processing_time_ms_)
+    {
+      eCAL::gOpenNamedEvent(&m_event_snd, memfile_name_ + "_" + process_id_, false);
+      eCAL::gOpenNamedEvent(&m_event_ack, memfile_name_ + "_" + process_id_ + "_ack", false);
+      m_thread = std::thread([this, processing_time_ms_]()
+        {
+          while (!m_stop)
+          {
+            if (!eCAL::gWaitForEvent(m_event_snd, 10)) continue;
+            std::this_thread::sleep_for(std::chrono::milliseconds(processing_time_ms_));
+            eCAL::gSetEvent(m_event_ack);
+            m_updates++;
+          }
+        });
+    }
+
+    ~CAckResponder()
+    {
+      m_stop = true;
+      m_thread.join();
+      eCAL::gCloseEvent(m_event_snd);
+      eCAL::gCloseEvent(m_event_ack);
+    }
+
+    int Updates() const { return m_updates; }
+
+  private:
+    eCAL::EventHandleT m_event_snd;
+    eCAL::EventHandleT m_event_ack;
+    std::atomic<bool>  m_stop{ false };
+    std::atomic<int>   m_updates{ 0 };
+    std::thread        m_thread;
+  };
+}
+
+TEST(MemFile, SyncMemfileDeferredAcknowledges)
+{
+  const int         file_count(3);
+  const int         processing_time_ms(50);
+  const std::string process_id("memfile_sync_test");
+
+  std::vector<std::unique_ptr<eCAL::CSyncMemoryFile>> memfiles;
+  std::vector<std::unique_ptr<CAckResponder>>         responders;
+  for (int i = 0; i < file_count; ++i)
+  {
+    memfiles.emplace_back(std::make_unique<eCAL::CSyncMemoryFile>("memfile_sync_test", 1024, SyncMemoryFileAttr()));
+    ASSERT_TRUE(memfiles.back()->Connect(process_id));
+    responders.emplace_back(std::make_unique<CAckResponder>(memfiles.back()->GetName(), process_id, processing_time_ms));
+  }
+
+  CStringPayload payload("Hello World");
+  eCAL::SWriterAttr attr;
+  attr.len                    = payload.GetSize();
+  attr.acknowledge_timeout_ms = 1000;
+
+  // every write waits for its acknowledge before the next memory file is written
+  const auto sync_start = std::chrono::steady_clock::now();
+  for (auto& memfile : memfiles)
+  {
+    EXPECT_TRUE(memfile->Write(payload, attr));
+  }
+  const auto sync_time = std::chrono::steady_clock::now() - sync_start;
+
+  // deferred writes are signaled in a row, their acknowledge waits overlap
+  attr.defer_sync = true;
+  const auto deferred_start = std::chrono::steady_clock::now();
+  for (auto& memfile : memfiles)
+  {
+    EXPECT_TRUE(memfile->Write(payload, attr));
+  }
+  for (auto& memfile : memfiles)
+  {
+    memfile->SignalPendingContent();
+  }
+  for (auto& memfile : memfiles)
+  {
+    memfile->WaitForAcknowledges();
+  }
+  const auto deferred_time = std::chrono::steady_clock::now() - deferred_start;
+
+  EXPECT_GE(sync_time, std::chrono::milliseconds(file_count * processing_time_ms));
+  EXPECT_LT(deferred_time, std::chrono::milliseconds(file_count * processing_time_ms));
+
+  // nothing pending anymore
+  for (auto& memfile : memfiles)
+  {
+    memfile->SignalPendingContent();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * processing_time_ms));
+  for (const auto& responder : responders)
+  {
+    EXPECT_EQ(2, responder->Updates());
+  }
+
+  responders.clear();
+  memfiles.clear();
+}
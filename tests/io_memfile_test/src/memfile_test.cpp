@@ -20,12 +20,15 @@
 #include <ecal/ecal.h>
 #include "io/shm/ecal_memfile.h"
 #include "io/shm/ecal_memfile_db.h"
+#include "io/shm/ecal_memfile_os.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <memory>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -140,6 +143,129 @@ TEST(MemFile, MemfileReadWrite)
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
 
+TEST(MemFile, MemfileHoldRemap)
+{
+  const std::string memfile_name = "my_memory_file_hold";
+  const std::string send_s(1024, 'H');
+
+  // write the content to hold
+  eCAL::CMemoryFile writer;
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, send_s.size()));
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(send_s.size(), writer.WriteBuffer(send_s.data(), send_s.size(), 0));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  // hold it and release the read access
+  eCAL::CMemoryFile reader;
+  EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader.GetReadAccess(100));
+  const void* held_buf(nullptr);
+  EXPECT_EQ(send_s.size(), reader.GetReadAddress(held_buf, send_s.size()));
+  EXPECT_EQ(true, reader.Hold(1));
+  EXPECT_EQ(true, reader.ReleaseReadAccess());
+  EXPECT_EQ(1, writer.GetHoldCount());
+
+  // the memory file gets mapped again with a larger size, the held content stays mapped
+  eCAL::CMemoryFile larger_writer;
+  EXPECT_EQ(true, larger_writer.Create(memfile_name.c_str(), true, 1024 * 1024));
+  EXPECT_EQ(send_s, std::string(static_cast<const char*>(held_buf), send_s.size()));
+
+  reader.Unhold();
+  EXPECT_EQ(0, writer.GetHoldCount());
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, larger_writer.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(MemFile, MemfileHoldPerProcess)
+{
+  const std::string memfile_name = "my_memory_file_hold_process";
+  const std::string send_s(1024, 'P');
+
+  // write the content to hold
+  eCAL::CMemoryFile writer;
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, send_s.size()));
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(send_s.size(), writer.WriteBuffer(send_s.data(), send_s.size(), 0));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  // two processes hold the content
+  eCAL::CMemoryFile reader_1;
+  EXPECT_EQ(true, reader_1.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader_1.GetReadAccess(100));
+  EXPECT_EQ(true, reader_1.Hold(1));
+  EXPECT_EQ(true, reader_1.Hold(1));
+  EXPECT_EQ(true, reader_1.ReleaseReadAccess());
+
+  eCAL::CMemoryFile reader_2;
+  EXPECT_EQ(true, reader_2.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader_2.GetReadAccess(100));
+  EXPECT_EQ(true, reader_2.Hold(2));
+  EXPECT_EQ(true, reader_2.ReleaseReadAccess());
+
+  // the writer tells the holds of every process apart
+  EXPECT_EQ(3, writer.GetHoldCount());
+  EXPECT_EQ(2, writer.GetHoldCount(1));
+  EXPECT_EQ(1, writer.GetHoldCount(2));
+  EXPECT_EQ(0, writer.GetHoldCount(3));
+
+  // released holds are gone for their process only
+  reader_1.Unhold();
+  reader_1.Unhold();
+  EXPECT_EQ(0, writer.GetHoldCount(1));
+  EXPECT_EQ(1, writer.GetHoldCount(2));
+
+  // the slot of a departed reader is free again, the other one keeps holding
+  EXPECT_EQ(true, reader_1.Destroy(false));
+  eCAL::CMemoryFile reader_3;
+  EXPECT_EQ(true, reader_3.Create(memfile_name.c_str(), false));
+  EXPECT_EQ(true, reader_3.GetReadAccess(100));
+  EXPECT_EQ(true, reader_3.Hold(3));
+  EXPECT_EQ(true, reader_3.ReleaseReadAccess());
+  EXPECT_EQ(1, writer.GetHoldCount(3));
+  EXPECT_EQ(1, writer.GetHoldCount(2));
+
+  reader_2.Unhold();
+  reader_3.Unhold();
+  EXPECT_EQ(0, writer.GetHoldCount());
+
+  EXPECT_EQ(true, reader_3.Destroy(false));
+  EXPECT_EQ(true, reader_2.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+TEST(MemFile, MemfileReaderMappingWritable)
+{
+  const std::string memfile_name = "my_memory_file_reader_mapping";
+  const size_t      memfile_size = 1024;
+
+  eCAL::CMemoryFile writer;
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, memfile_size));
+
+  // map the memory file the way a reader in another process does (readers hold content and acknowledge
+  // notifications by updating the header, so their mapping has to be writable)
+  eCAL::SMemFileInfo reader_info;
+  EXPECT_EQ(true, eCAL::memfile::os::AllocFile(memfile_name, false, reader_info));
+  eCAL::memfile::os::CheckFileSize(memfile_size, false, reader_info);
+  ASSERT_NE(nullptr, reader_info.mem_address);
+  EXPECT_FALSE(reader_info.read_only);
+  static_cast<char*>(reader_info.mem_address)[reader_info.size - 1] = 'R';
+
+  // and the update is visible to everybody else
+  eCAL::SMemFileInfo check_info;
+  EXPECT_EQ(true, eCAL::memfile::os::AllocFile(memfile_name, false, check_info));
+  eCAL::memfile::os::CheckFileSize(reader_info.size, false, check_info);
+  ASSERT_NE(nullptr, check_info.mem_address);
+  EXPECT_EQ('R', static_cast<const char*>(check_info.mem_address)[reader_info.size - 1]);
+  eCAL::memfile::os::UnMapFile(check_info);
+  eCAL::memfile::os::DeAllocFile(check_info);
+
+  eCAL::memfile::os::UnMapFile(reader_info);
+  eCAL::memfile::os::DeAllocFile(reader_info);
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
 TEST(MemFile, MemfilePerf)
 {
   eCAL::CMemoryFile mem_file;
@@ -297,3 +423,344 @@ TEST(MemFile, MemfileConcurrency)
   // destroy memory file
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
+
+TEST(MemFile, MemfileSharedRead)
+{
+  const std::string memfile_name = "my_memory_file_shared";
+  const size_t buflen(64 * 1024);
+
+  eCAL::CMemoryFile writer;
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, buflen));
+
+  eCAL::CMemoryFile reader;
+  EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+
+  // nothing written so far
+  EXPECT_EQ(true, reader.GetSharedReadAccess());
+  EXPECT_EQ(true, reader.HasSharedReadAccess());
+  EXPECT_EQ(0, reader.CurDataSize());
+  EXPECT_EQ(true, reader.ReleaseSharedReadAccess());
+
+  // shared access is not possible while the file is written
+  std::vector<char> write_buf(buflen, 'a');
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(buflen, writer.WriteBuffer(write_buf.data(), write_buf.size(), 0));
+  EXPECT_EQ(false, reader.GetSharedReadAccess());
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+
+  // a write during shared access invalidates the read content
+  std::vector<char> read_buf(buflen);
+  EXPECT_EQ(true, reader.GetSharedReadAccess());
+  EXPECT_EQ(buflen, reader.Read(read_buf.data(), read_buf.size(), 0));
+  EXPECT_EQ(true, writer.GetWriteAccess(100));
+  EXPECT_EQ(true, writer.ReleaseWriteAccess());
+  EXPECT_EQ(false, reader.ReleaseSharedReadAccess());
+
+  // undisturbed shared read
+  EXPECT_EQ(true, reader.GetSharedReadAccess());
+  EXPECT_EQ(buflen, reader.Read(read_buf.data(), read_buf.size(), 0));
+  EXPECT_EQ(true, reader.ReleaseSharedReadAccess());
+  EXPECT_EQ(write_buf, read_buf);
+
+  // validated shared reads never see torn content
+  std::atomic<bool> stop(false);
+  std::thread producer([&]()
+    {
+      char value('a');
+      while (!stop)
+      {
+        std::fill(write_buf.begin(), write_buf.end(), value);
+        if (writer.GetWriteAccess(100))
+        {
+          writer.WriteBuffer(write_buf.data(), write_buf.size(), 0);
+          writer.ReleaseWriteAccess();
+        }
+        value = (value == 'z') ? 'a' : static_cast<char>(value + 1);
+      }
+    });
+
+  size_t valid_reads(0);
+  for (int i = 0; i < 10000; ++i)
+  {
+    if (!reader.GetSharedReadAccess()) continue;
+    reader.Read(read_buf.data(), read_buf.size(), 0);
+    if (reader.ReleaseSharedReadAccess())
+    {
+      valid_reads++;
+      EXPECT_EQ(read_buf.size(), static_cast<size_t>(std::count(read_buf.begin(), read_buf.end(), read_buf[0])));
+    }
+  }
+  stop = true;
+  producer.join();
+  std::cout << "Valid shared reads : " << valid_reads << " of 10000" << std::endl;
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
+
+namespace
+{
+  // writer wait time and reader throughput for n concurrent readers of one memory file
+  void BenchmarkReaders(size_t reader_num_, bool shared_)
+  {
+    const std::string memfile_name = "my_memory_file_scaling";
+    const size_t buflen(1024 * 1024);
+    const int    writes(100);
+
+    eCAL::CMemoryFile writer;
+    EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, buflen));
+    std::vector<char> write_buf(buflen, 42);
+    EXPECT_EQ(true, writer.GetWriteAccess(100));
+    writer.WriteBuffer(write_buf.data(), write_buf.size(), 0);
+    writer.ReleaseWriteAccess();
+
+    // one memory file object per reader like one observer per subscriber process
+    std::vector<std::unique_ptr<eCAL::CMemoryFile>> reader_files;
+    for (size_t r = 0; r < reader_num_; ++r)
+    {
+      reader_files.emplace_back(new eCAL::CMemoryFile);
+      EXPECT_EQ(true, reader_files.back()->Create(memfile_name.c_str(), false));
+    }
+
+    std::atomic<bool>   stop(false);
+    std::atomic<size_t> reads(0);
+    std::vector<std::thread> readers;
+    for (auto& reader_file : reader_files)
+    {
+      readers.emplace_back([&]()
+        {
+          eCAL::CMemoryFile& reader = *reader_file;
+          std::vector<char> read_buf(buflen);
+          while (!stop)
+          {
+            if (shared_)
+            {
+              if (!reader.GetSharedReadAccess()) continue;
+              reader.Read(read_buf.data(), read_buf.size(), 0);
+              if (reader.ReleaseSharedReadAccess()) reads++;
+            }
+            else
+            {
+              if (!reader.GetReadAccess(100)) continue;
+              reader.Read(read_buf.data(), read_buf.size(), 0);
+              reader.ReleaseReadAccess();
+              reads++;
+            }
+          }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    std::chrono::steady_clock::duration write_wait(0);
+    const auto start = std::chrono::steady_clock::now();
+    for (int w = 0; w < writes; ++w)
+    {
+      const auto wait_start = std::chrono::steady_clock::now();
+      if (writer.GetWriteAccess(1000))
+      {
+        write_wait += std::chrono::steady_clock::now() - wait_start;
+        writer.WriteBuffer(write_buf.data(), write_buf.size(), 0);
+        writer.ReleaseWriteAccess();
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    stop = true;
+    for (auto& reader : readers) reader.join();
+    for (auto& reader_file : reader_files) reader_file->Destroy(false);
+    writer.Destroy(true);
+
+    std::cout << (shared_ ? "shared    " : "exclusive ") << reader_num_ << " readers: "
+      << std::chrono::duration<double, std::micro>(write_wait).count() / writes << " us avg writer wait, "
+      << static_cast<int>(reads / elapsed.count()) << " reads/s" << std::endl;
+  }
+}
+
+TEST(MemFile, MemfileSharedReadScaling)
+{
+  for (size_t reader_num : { 1, 2, 4, 8, 16 })
+  {
+    BenchmarkReaders(reader_num, false);
+    BenchmarkReaders(reader_num, true);
+  }
+}
+
+namespace
+{
+  // first access latency of a freshly created memory file for writer and reader
+  void BenchmarkFirstAccess(const std::string& name_, const eCAL::SMemFileMapOptions& options_, size_t size_)
+  {
+    const std::string memfile_name = "my_memory_file_first_access";
+    std::vector<char> write_buf(size_, 42);
+    std::vector<char> read_buf(size_);
+
+    const auto create_start = std::chrono::steady_clock::now();
+    eCAL::CMemoryFile writer;
+    writer.SetMapOptions(options_);
+    EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, size_));
+    eCAL::CMemoryFile reader;
+    reader.SetMapOptions(options_);
+    EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+    const auto create_end = std::chrono::steady_clock::now();
+
+    std::chrono::steady_clock::duration write_time[2];
+    std::chrono::steady_clock::duration read_time[2];
+    for (int run = 0; run < 2; ++run)
+    {
+      const auto write_start = std::chrono::steady_clock::now();
+      EXPECT_EQ(true, writer.GetWriteAccess(100));
+      EXPECT_EQ(size_, writer.WriteBuffer(write_buf.data(), write_buf.size(), 0));
+      writer.ReleaseWriteAccess();
+      const auto read_start = std::chrono::steady_clock::now();
+      EXPECT_EQ(true, reader.GetReadAccess(100));
+      EXPECT_EQ(size_, reader.Read(read_buf.data(), read_buf.size(), 0));
+      reader.ReleaseReadAccess();
+      const auto read_end = std::chrono::steady_clock::now();
+      write_time[run] = read_start - write_start;
+      read_time[run]  = read_end - read_start;
+    }
+
+    EXPECT_EQ(true, reader.Destroy(false));
+    EXPECT_EQ(true, writer.Destroy(true));
+
+    auto us = [](std::chrono::steady_clock::duration d_) { return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(d_).count()); };
+    std::cout << name_ << " " << size_ / (1024 * 1024) << " MB: create " << us(create_end - create_start) << " us"
+      << ", first write " << us(write_time[0]) << " us, first read " << us(read_time[0]) << " us"
+      << ", next write " << us(write_time[1]) << " us, next read " << us(read_time[1]) << " us" << std::endl;
+  }
+}
+
+TEST(MemFile, MemfileMapOptions)
+{
+  eCAL::SMemFileMapOptions plain;
+  eCAL::SMemFileMapOptions populate;
+  populate.populate = true;
+  eCAL::SMemFileMapOptions populate_lock;
+  populate_lock.populate = true;
+  populate_lock.lock     = true;
+  eCAL::SMemFileMapOptions transparent_huge_pages;
+  transparent_huge_pages.populate   = true;
+  transparent_huge_pages.huge_pages = 1;
+
+  for (size_t size_mb : { 1, 4, 16, 64 })
+  {
+    const size_t size = size_mb * 1024 * 1024;
+    BenchmarkFirstAccess("plain              ", plain,                  size);
+    BenchmarkFirstAccess("populate           ", populate,               size);
+    BenchmarkFirstAccess("populate + lock    ", populate_lock,          size);
+    BenchmarkFirstAccess("populate + THP     ", transparent_huge_pages, size);
+  }
+}
+
+namespace
+{
+  // notify all readers with one broadcast and wait for their acknowledges
+  void BenchmarkBroadcastNotify(size_t reader_num_, int rounds_)
+  {
+    const std::string memfile_name = "my_memory_file_broadcast";
+
+    eCAL::CMemoryFile writer;
+    EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, 1024));
+    if (!writer.SetBroadcastNotification(true))
+    {
+      // futex based notification is not supported on this platform
+      EXPECT_EQ(true, writer.Destroy(true));
+      return;
+    }
+
+    // readers take their sequence snapshot before the first notification
+    std::vector<std::unique_ptr<eCAL::CMemoryFile>> readers;
+    std::vector<std::uint32_t> reader_seqs;
+    for (size_t num = 0; num < reader_num_; ++num)
+    {
+      readers.emplace_back(new eCAL::CMemoryFile);
+      EXPECT_EQ(true, readers.back()->Create(memfile_name.c_str(), false));
+      EXPECT_EQ(true, readers.back()->IsBroadcastNotification());
+      reader_seqs.push_back(readers.back()->GetNotificationSequence());
+    }
+
+    std::atomic<int> missed_notifications(0);
+    std::vector<std::thread> reader_threads;
+    for (size_t num = 0; num < reader_num_; ++num)
+    {
+      reader_threads.emplace_back([&readers, &reader_seqs, &missed_notifications, num, rounds_]()
+        {
+          for (int round = 0; round < rounds_; ++round)
+          {
+            if (!readers[num]->WaitForNotification(reader_seqs[num], 1000)) ++missed_notifications;
+            readers[num]->Acknowledge(reader_seqs[num]);
+          }
+        });
+    }
+
+    int missed_acknowledges(0);
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds_; ++round)
+    {
+      EXPECT_EQ(true, writer.NotifyAll());
+      if (!writer.WaitForAcknowledges(writer.GetNotificationSequence(), static_cast<std::uint32_t>(reader_num_), 1000)) ++missed_acknowledges;
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    for (auto& reader_thread : reader_threads) reader_thread.join();
+    for (auto& reader : readers) EXPECT_EQ(true, reader->Destroy(false));
+    EXPECT_EQ(true, writer.Destroy(true));
+
+    EXPECT_EQ(0, missed_notifications);
+    EXPECT_EQ(0, missed_acknowledges);
+
+    const auto round_us = std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count() / rounds_;
+    std::cout << "Broadcast notify + acknowledge " << reader_num_ << " reader(s): " << round_us << " us per round" << std::endl;
+  }
+}
+
+TEST(MemFile, MemfileBroadcastNotify)
+{
+  for (size_t reader_num : { 1, 4, 16 })
+  {
+    BenchmarkBroadcastNotify(reader_num, 1000);
+  }
+}
+
+TEST(MemFile, MemfileBroadcastLateAcknowledge)
+{
+  const std::string memfile_name = "my_memory_file_broadcast_ack";
+
+  eCAL::CMemoryFile writer;
+  EXPECT_EQ(true, writer.Create(memfile_name.c_str(), true, 1024));
+  if (!writer.SetBroadcastNotification(true))
+  {
+    // futex based notification is not supported on this platform
+    EXPECT_EQ(true, writer.Destroy(true));
+    return;
+  }
+
+  eCAL::CMemoryFile reader;
+  EXPECT_EQ(true, reader.Create(memfile_name.c_str(), false));
+  std::uint32_t reader_seq = reader.GetNotificationSequence();
+
+  // first round, the reader sees the notification but is too late to acknowledge it
+  EXPECT_EQ(true, writer.NotifyAll());
+  const std::uint32_t first_seq = writer.GetNotificationSequence();
+  EXPECT_EQ(true, reader.WaitForNotification(reader_seq, 0));
+  EXPECT_EQ(first_seq, reader_seq);
+  EXPECT_EQ(false, writer.WaitForAcknowledges(first_seq, 1, 10));
+
+  // second round, the late acknowledge of the first round must not count
+  EXPECT_EQ(true, writer.NotifyAll());
+  const std::uint32_t second_seq = writer.GetNotificationSequence();
+  reader.Acknowledge(first_seq);
+  EXPECT_EQ(false, writer.WaitForAcknowledges(second_seq, 1, 10));
+
+  // waiting for an outdated round fails right away
+  EXPECT_EQ(false, writer.WaitForAcknowledges(first_seq, 1, 10));
+
+  // the acknowledge of the current round does
+  EXPECT_EQ(true, reader.WaitForNotification(reader_seq, 0));
+  reader.Acknowledge(reader_seq);
+  EXPECT_EQ(true, writer.WaitForAcknowledges(second_seq, 1, 10));
+
+  EXPECT_EQ(true, reader.Destroy(false));
+  EXPECT_EQ(true, writer.Destroy(true));
+}
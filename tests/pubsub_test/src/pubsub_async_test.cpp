@@ -0,0 +1,260 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include <ecal/msg/string/publisher.h>
+#include <ecal/msg/string/subscriber.h>
+
+#include "config/ecal_config_snapshot.h"
+#include "readwrite/ecal_writer.h"
+#include "readwrite/ecal_writer_buffer_payload.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH 1000
+#define DATA_FLOW_TIME             50
+
+namespace
+{
+  // send on the udp layer only, from the background sender
+  void ConfigureAsyncNetSend(size_t queue_size_, bool block_on_overflow_)
+  {
+    auto config = *eCAL::Config::GetSnapshot();
+    config.pub_use_shm                 = eCAL::TLayer::smode_off;
+    config.pub_use_udp_mc              = eCAL::TLayer::smode_on;
+    config.async_net_send              = true;
+    config.async_net_queue_size        = queue_size_;
+    config.async_net_block_on_overflow = block_on_overflow_;
+    eCAL::Config::PublishSnapshot(config);
+  }
+
+  // udp send queue drops of the publisher, as registered
+  long long GetUdpQueueDrops(const std::string& topic_name_)
+  {
+    const auto snapshot = eCAL::Monitoring::GetMonitoringSnapshot();
+    if (snapshot == nullptr) return -1;
+    for (const auto& topic : snapshot->entities.publisher)
+    {
+      if (topic->tname != topic_name_) continue;
+      for (const auto& layer : topic->tlayer)
+      {
+        if (layer.type == eCAL::Monitoring::tl_ecal_udp_mc) return layer.queue_drops;
+      }
+    }
+    return -1;
+  }
+}
+
+TEST(PubSubAsync, Delivery)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "pubsub_async_test", eCAL::Init::All));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+  ConfigureAsyncNetSend(100, true);
+
+  // create subscriber and publisher
+  std::mutex received_mtx;
+  std::vector<std::string> received;
+  eCAL::string::CSubscriber<std::string> sub("async_delivery");
+  sub.AddReceiveCallback([&received_mtx, &received](const char* /*topic_name_*/, const std::string& msg_, long long /*time_*/, long long /*clock_*/, long long /*id_*/)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.push_back(msg_);
+    });
+  eCAL::string::CPublisher<std::string> pub("async_delivery");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // every sample arrives in order
+  for (int idx = 0; idx < 10; ++idx)
+  {
+    EXPECT_LT(0, pub.Send(std::to_string(idx)));
+    eCAL::Process::SleepMS(10);
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_EQ(10, received.size());
+    for (int idx = 0; idx < 10; ++idx) EXPECT_EQ(std::to_string(idx), received[idx]);
+  }
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSubAsync, DropOldest)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "pubsub_async_test", eCAL::Init::All));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // a single sample queue dropping the oldest sample on overflow
+  ConfigureAsyncNetSend(1, false);
+  eCAL::string::CSubscriber<std::string> sub("async_drop_oldest");
+  eCAL::string::CPublisher<std::string> pub("async_drop_oldest");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // the burst overflows the queue, the sends do not wait for it
+  const std::string send_s(64 * 1024, 'D');
+  for (int idx = 0; idx < 1000; ++idx)
+  {
+    EXPECT_EQ(send_s.size(), pub.Send(send_s));
+  }
+
+  // the drops are registered with the udp layer
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  EXPECT_LT(0, GetUdpQueueDrops("async_drop_oldest"));
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSubAsync, BlockOnOverflow)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "pubsub_async_test", eCAL::Init::All));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // a single sample queue blocking the sender on overflow
+  ConfigureAsyncNetSend(1, true);
+  std::atomic<size_t> received_count(0);
+  eCAL::string::CSubscriber<std::string> sub("async_block_on_overflow");
+  sub.AddReceiveCallback([&received_count](const char* /*topic_name_*/, const std::string& /*msg_*/, long long /*time_*/, long long /*clock_*/, long long /*id_*/)
+    {
+      ++received_count;
+    });
+  eCAL::string::CPublisher<std::string> pub("async_block_on_overflow");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // the same burst does not lose a sample in the queue
+  const std::string send_s(64 * 1024, 'B');
+  for (int idx = 0; idx < 1000; ++idx)
+  {
+    EXPECT_EQ(send_s.size(), pub.Send(send_s));
+  }
+
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  EXPECT_EQ(0, GetUdpQueueDrops("async_block_on_overflow"));
+  EXPECT_LT(0, received_count);
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSubAsync, ModeSwitchWhileSending)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL::Initialize(0, nullptr, "pubsub_async_test", eCAL::Init::All));
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+  ConfigureAsyncNetSend(100, false);
+
+  std::mutex received_mtx;
+  std::string last_received;
+  eCAL::string::CSubscriber<std::string> sub("async_mode_switch");
+  sub.AddReceiveCallback([&received_mtx, &last_received](const char* /*topic_name_*/, const std::string& msg_, long long /*time_*/, long long /*clock_*/, long long /*id_*/)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      last_received = msg_;
+    });
+
+  // the data writer switches its layers
+  eCAL::CDataWriter writer;
+  ASSERT_TRUE(writer.Create("async_mode_switch", eCAL::SDataTypeInformation()));
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // the udp layer is switched off and on while the samples are queued and sent
+  std::atomic<bool> sending(true);
+  std::thread sender([&writer, &sending]()
+    {
+      const std::string send_s(16 * 1024, 'S');
+      long long id(0);
+      while (sending)
+      {
+        eCAL::CBufferPayloadWriter payload(send_s.data(), send_s.size());
+        writer.Write(payload, eCAL::Time::GetMicroSeconds(), ++id);
+      }
+    });
+  for (int idx = 0; idx < 50; ++idx)
+  {
+    writer.SetLayerMode(eCAL::TLayer::tlayer_udp_mc, eCAL::TLayer::smode_off);
+    eCAL::Process::SleepMS(1);
+    writer.SetLayerMode(eCAL::TLayer::tlayer_udp_mc, eCAL::TLayer::smode_on);
+    eCAL::Process::SleepMS(1);
+  }
+  sending = false;
+  sender.join();
+
+  // the switched on layer sends again
+  const std::string last_s("last");
+  eCAL::CBufferPayloadWriter payload(last_s.data(), last_s.size());
+  EXPECT_EQ(last_s.size(), writer.Write(payload, eCAL::Time::GetMicroSeconds(), 0));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    EXPECT_EQ(last_s, last_received);
+  }
+
+  // destroy data writer
+  writer.Destroy();
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
@@ -0,0 +1,179 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecalc.h>
+
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define CMN_REGISTRATION_REFRESH   1000
+#define DATA_FLOW_TIME               50
+#define PAYLOAD_SIZE               1024
+
+namespace
+{
+  struct SReceivedC
+  {
+    std::mutex               mtx;
+    std::vector<std::string> payloads;
+    std::vector<long long>   times;
+  };
+
+  void OnReceiveBuffer(const char* /*topic_name_*/, const struct SReceiveBufferDataC* data_, void* par_)
+  {
+    auto* received = static_cast<SReceivedC*>(par_);
+    const std::lock_guard<std::mutex> lock(received->mtx);
+    received->payloads.emplace_back(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size));
+    received->times.push_back(data_->time);
+  }
+
+  struct SPayloadC
+  {
+    std::string content;
+    int         write_full_calls = 0;
+  };
+
+  int WriteFull(void* buf_, int buf_len_, void* par_)
+  {
+    auto* payload = static_cast<SPayloadC*>(par_);
+    payload->write_full_calls++;
+    if (buf_len_ < static_cast<int>(payload->content.size())) return(0);
+    memcpy(buf_, payload->content.data(), payload->content.size());
+    return(1);
+  }
+
+  int GetSize(void* par_)
+  {
+    return(static_cast<int>(static_cast<SPayloadC*>(par_)->content.size()));
+  }
+}
+
+TEST(PubSubC, ReceiveBufferCallback)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL_Initialize(0, nullptr, "pubsub_c_test", eCAL_Init_Default));
+
+  // publish / subscribe match in the same process
+  eCAL_Util_EnableLoopback(1);
+
+  // create subscriber with buffer callback, the user parameter is forwarded
+  SReceivedC received;
+  ECAL_HANDLE sub = eCAL_Sub_New();
+  ASSERT_NE(nullptr, sub);
+  EXPECT_NE(0, eCAL_Sub_Create(sub, "pubsub_c_buffer", "", "", "", 0));
+  EXPECT_EQ(0, eCAL_Sub_AddReceiveBufferCallback(sub, nullptr, &received));
+  EXPECT_NE(0, eCAL_Sub_AddReceiveBufferCallback(sub, OnReceiveBuffer, &received));
+
+  // create publisher
+  ECAL_HANDLE pub = eCAL_Pub_New();
+  ASSERT_NE(nullptr, pub);
+  EXPECT_NE(0, eCAL_Pub_Create(pub, "pubsub_c_buffer", "", "", "", 0));
+
+  // let's match them
+  eCAL_Process_SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // send payloads with explicit time stamps
+  const std::vector<std::string> send_vector{ std::string(PAYLOAD_SIZE, 'A'), "Hello World", std::string(PAYLOAD_SIZE / 2, 'B') };
+  long long send_time(1000);
+  for (const auto& send_s : send_vector)
+  {
+    EXPECT_EQ(static_cast<int>(send_s.size()), eCAL_Pub_Send(pub, send_s.data(), static_cast<int>(send_s.size()), send_time++));
+    eCAL_Process_SleepMS(DATA_FLOW_TIME);
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(received.mtx);
+    EXPECT_EQ(send_vector, received.payloads);
+    EXPECT_EQ((std::vector<long long>{ 1000, 1001, 1002 }), received.times);
+  }
+
+  // no more callbacks after removal
+  EXPECT_NE(0, eCAL_Sub_RemReceiveCallback(sub));
+  eCAL_Pub_Send(pub, "late", 4, -1);
+  eCAL_Process_SleepMS(DATA_FLOW_TIME);
+  {
+    const std::lock_guard<std::mutex> lock(received.mtx);
+    EXPECT_EQ(send_vector.size(), received.payloads.size());
+  }
+
+  // destroy subscriber and publisher
+  EXPECT_NE(0, eCAL_Sub_Destroy(sub));
+  EXPECT_NE(0, eCAL_Pub_Destroy(pub));
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL_Finalize(eCAL_Init_All));
+}
+
+TEST(PubSubC, SendPayloadWriter)
+{
+  // initialize eCAL API
+  EXPECT_EQ(0, eCAL_Initialize(0, nullptr, "pubsub_c_test", eCAL_Init_Default));
+
+  // publish / subscribe match in the same process
+  eCAL_Util_EnableLoopback(1);
+
+  // create subscriber
+  SReceivedC received;
+  ECAL_HANDLE sub = eCAL_Sub_New();
+  ASSERT_NE(nullptr, sub);
+  EXPECT_NE(0, eCAL_Sub_Create(sub, "pubsub_c_writer", "", "", "", 0));
+  EXPECT_NE(0, eCAL_Sub_AddReceiveBufferCallback(sub, OnReceiveBuffer, &received));
+
+  // create publisher
+  ECAL_HANDLE pub = eCAL_Pub_New();
+  ASSERT_NE(nullptr, pub);
+  EXPECT_NE(0, eCAL_Pub_Create(pub, "pubsub_c_writer", "", "", "", 0));
+
+  // let's match them
+  eCAL_Process_SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // write full and size functions are mandatory
+  SPayloadC payload;
+  payload.content = std::string(PAYLOAD_SIZE, 'W');
+  EXPECT_EQ(0, eCAL_Pub_SendPayloadWriter(pub, nullptr, nullptr, GetSize, &payload, -1));
+  EXPECT_EQ(0, eCAL_Pub_SendPayloadWriter(pub, WriteFull, nullptr, nullptr, &payload, -1));
+  EXPECT_EQ(0, payload.write_full_calls);
+
+  // the payload is written by the user function, without write modified function
+  EXPECT_EQ(PAYLOAD_SIZE, eCAL_Pub_SendPayloadWriter(pub, WriteFull, nullptr, GetSize, &payload, 42));
+  eCAL_Process_SleepMS(DATA_FLOW_TIME);
+  EXPECT_LE(1, payload.write_full_calls);
+
+  // a different size is written as well
+  payload.content = "Hello World";
+  EXPECT_EQ(static_cast<int>(payload.content.size()), eCAL_Pub_SendPayloadWriter(pub, WriteFull, nullptr, GetSize, &payload, 43));
+  eCAL_Process_SleepMS(DATA_FLOW_TIME);
+
+  {
+    const std::lock_guard<std::mutex> lock(received.mtx);
+    EXPECT_EQ((std::vector<std::string>{ std::string(PAYLOAD_SIZE, 'W'), "Hello World" }), received.payloads);
+    EXPECT_EQ((std::vector<long long>{ 42, 43 }), received.times);
+  }
+
+  // destroy subscriber and publisher
+  EXPECT_NE(0, eCAL_Sub_Destroy(sub));
+  EXPECT_NE(0, eCAL_Pub_Destroy(pub));
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL_Finalize(eCAL_Init_All));
+}
@@ -18,11 +18,22 @@
 */
 
 #include <ecal/ecal.h>
+#include <ecal/msg/pod/publisher.h>
+#include <ecal/msg/pod/subscriber.h>
 #include <ecal/msg/string/publisher.h>
 #include <ecal/msg/string/subscriber.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -39,6 +50,27 @@ void OnReceive(const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackD
   g_callback_received_count++;
 }
 
+namespace
+{
+  class CStringPayload : public eCAL::CPayloadWriter
+  {
+  public:
+    explicit CStringPayload(std::string s_) : s(std::move(s_)) {}
+
+    bool WriteFull(void* buf_, size_t len_) override
+    {
+      if (len_ < s.size()) return false;
+      memcpy(buf_, s.data(), s.size());
+      return true;
+    }
+
+    size_t GetSize() override { return s.size(); }
+
+  private:
+    std::string s;
+  };
+}
+
 static std::string CreatePayLoad(size_t payload_size_)
 {
   std::string s = "Hello World ";
@@ -779,3 +811,876 @@ TEST(PubSub, SubscriberReconnection)
   // without destroying any pub / sub
   eCAL::Finalize();
 }
+
+TEST(PubSub, LoanedMessage)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo", store the received messages
+  std::mutex received_mtx;
+  std::vector<std::string> received;
+  eCAL::CSubscriber sub("foo");
+  sub.AddReceiveCallback([&received_mtx, &received](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.emplace_back(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size));
+    });
+
+  // create publisher for topic "foo"
+  eCAL::CPublisher pub("foo");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  const std::string first_s  = CreatePayLoad(PAYLOAD_SIZE);
+  const std::string second_s(PAYLOAD_SIZE / 2, 'X');
+
+  // two loans in flight, the second one does not get a (single buffered) memory file
+  eCAL::CPublisherLoan first_loan  = pub.Loan(first_s.size());
+  eCAL::CPublisherLoan second_loan = pub.Loan(second_s.size());
+  ASSERT_TRUE(first_loan.IsValid());
+  ASSERT_TRUE(second_loan.IsValid());
+  EXPECT_EQ(first_s.size(), first_loan.Size());
+  EXPECT_EQ(second_s.size(), second_loan.Size());
+
+  // produce the payloads in place, then publish them
+  memcpy(second_loan.Data(), second_s.data(), second_s.size());
+  memcpy(first_loan.Data(), first_s.data(), first_s.size());
+  EXPECT_EQ(first_s.size(), first_loan.Commit());
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(second_s.size(), second_loan.Commit());
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  // committed loans are released
+  EXPECT_FALSE(first_loan.IsValid());
+  EXPECT_EQ(0, first_loan.Commit());
+
+  // a discarded loan is not published and releases its memory file
+  {
+    eCAL::CPublisherLoan discarded_loan = pub.Loan(PAYLOAD_SIZE);
+    ASSERT_TRUE(discarded_loan.IsValid());
+    memset(discarded_loan.Data(), 'D', discarded_loan.Size());
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(first_s.size(), pub.Send(first_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_EQ(3, received.size());
+    EXPECT_EQ(first_s,  received[0]);
+    EXPECT_EQ(second_s, received[1]);
+    EXPECT_EQ(first_s,  received[2]);
+  }
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, LoanDiscardConcurrentSend)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo", count the received messages that differ from the sent one
+  const std::string send_s = CreatePayLoad(PAYLOAD_SIZE);
+  std::atomic<size_t> received_count(0);
+  std::atomic<size_t> corrupted_count(0);
+  eCAL::CSubscriber sub("foo");
+  sub.AddReceiveCallback([&send_s, &received_count, &corrupted_count](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      received_count++;
+      if (std::string(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size)) != send_s) corrupted_count++;
+    });
+
+  // create publisher for topic "foo"
+  eCAL::CPublisher pub("foo");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // loans are taken and discarded by another thread while sending
+  std::atomic<bool> stop(false);
+  std::thread loan_thread([&pub, &stop]()
+    {
+      while (!stop)
+      {
+        eCAL::CPublisherLoan loan = pub.Loan(PAYLOAD_SIZE);
+        if (loan.IsValid()) memset(loan.Data(), 'D', loan.Size());
+        std::this_thread::yield();
+      }
+    });
+
+  for (int send = 0; send < 500; ++send)
+  {
+    pub.Send(send_s);
+    std::this_thread::yield();
+  }
+  stop = true;
+  loan_thread.join();
+
+  // the sent messages still arrive, the discarded loans never do
+  EXPECT_EQ(send_s.size(), pub.Send(send_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_LT(0, received_count);
+  EXPECT_EQ(0, corrupted_count);
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, HeldSamples)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo", keep the received sample handles
+  std::mutex received_mtx;
+  std::vector<std::shared_ptr<const eCAL::SReceiveCallbackData>> received;
+  eCAL::CSubscriber sub("foo");
+  sub.AddReceiveSampleCallback([&received_mtx, &received](const char* /*topic_name_*/, const std::shared_ptr<const eCAL::SReceiveCallbackData>& sample_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.push_back(sample_);
+    });
+  const auto received_payload = [&received_mtx, &received](size_t idx_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      if (idx_ >= received.size()) return std::string();
+      return std::string(static_cast<const char*>(received[idx_]->buf), static_cast<size_t>(received[idx_]->size));
+    };
+
+  // create publisher for topic "foo" (one memory file by default)
+  eCAL::CPublisher pub("foo");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // the memory file gets held by the subscriber
+  const std::string first_s(PAYLOAD_SIZE, 'A');
+  EXPECT_EQ(first_s.size(), pub.Send(first_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(first_s, received_payload(0));
+
+  // the only memory file is held, so the publisher drops the next samples
+  // and the held sample stays untouched
+  const std::string second_s(PAYLOAD_SIZE, 'B');
+  pub.Send(second_s);
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  pub.Send(second_s);
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(first_s, received_payload(0));
+  EXPECT_EQ(std::string(), received_payload(1));
+
+  // released samples give the memory files back to the publisher
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.clear();
+  }
+  const std::string fourth_s(PAYLOAD_SIZE, 'D');
+  for (int i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(fourth_s.size(), pub.Send(fourth_s));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.clear();
+  }
+  EXPECT_EQ(fourth_s.size(), pub.Send(fourth_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(fourth_s, received_payload(0));
+
+  // release all handles before finalizing
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    received.clear();
+  }
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+namespace
+{
+  struct SPose
+  {
+    double        x;
+    double        y;
+    double        yaw;
+    std::uint32_t seq;
+  };
+
+  struct SPoseReordered
+  {
+    std::uint32_t seq;
+    double        x;
+    double        y;
+    double        yaw;
+  };
+
+  struct SSequence
+  {
+    explicit SSequence(std::uint32_t seq_) : seq(seq_) {}
+    std::uint32_t seq;
+  };
+}
+
+namespace eCAL
+{
+  namespace pod
+  {
+    template <> struct TypeLayout<SPose> { static std::string Get() { return "double x;double y;double yaw;uint32 seq"; } };
+
+    // same name, size and alignment as SPose, different field order
+    template <> struct TypeName<SPoseReordered>   { static std::string Get() { return TypeName<SPose>::Get(); } };
+    template <> struct TypeLayout<SPoseReordered> { static std::string Get() { return "uint32 seq;double x;double y;double yaw"; } };
+    template <> struct TypeLayout<SSequence>      { static std::string Get() { return "uint32 seq"; } };
+  }
+}
+
+TEST(PubSub, HeldSampleLargerPayload)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo", keep the received sample handles
+  std::mutex received_mtx;
+  std::vector<std::shared_ptr<const eCAL::SReceiveCallbackData>> received;
+  eCAL::CSubscriber sub("foo");
+  sub.AddReceiveSampleCallback([&received_mtx, &received](const char* /*topic_name_*/, const std::shared_ptr<const eCAL::SReceiveCallbackData>& sample_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.push_back(sample_);
+    });
+
+  // create publisher for topic "foo"
+  eCAL::CPublisher pub("foo");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // hold the first sample
+  const std::string first_s(PAYLOAD_SIZE, 'A');
+  EXPECT_EQ(first_s.size(), pub.Send(first_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  std::shared_ptr<const eCAL::SReceiveCallbackData> held;
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_EQ(1, received.size());
+    held = received[0];
+    received.clear();
+  }
+
+  // a larger payload would need a larger memory file, the held one is neither resized nor overwritten
+  const std::string larger_s(1024 * PAYLOAD_SIZE, 'B');
+  pub.Send(larger_s);
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_EQ(first_s, std::string(static_cast<const char*>(held->buf), static_cast<size_t>(held->size)));
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    EXPECT_TRUE(received.empty());
+  }
+
+  // released, the memory file grows and the larger payload arrives
+  held.reset();
+  pub.Send(larger_s);
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  pub.Send(larger_s);
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_FALSE(received.empty());
+    EXPECT_EQ(larger_s, std::string(static_cast<const char*>(received.back()->buf), static_cast<size_t>(received.back()->size)));
+    received.clear();
+  }
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, HeldSampleSubscriberLeft)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo", keep the first received sample handle
+  std::mutex received_mtx;
+  std::shared_ptr<const eCAL::SReceiveCallbackData> held;
+  auto sub = std::make_shared<eCAL::CSubscriber>("foo");
+  sub->AddReceiveSampleCallback([&received_mtx, &held](const char* /*topic_name_*/, const std::shared_ptr<const eCAL::SReceiveCallbackData>& sample_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      if (!held) held = sample_;
+    });
+
+  // create publisher for topic "foo"
+  eCAL::CPublisher pub("foo");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // hold the first sample
+  const std::string first_s(PAYLOAD_SIZE, 'A');
+  EXPECT_EQ(first_s.size(), pub.Send(first_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_NE(nullptr, held);
+  }
+
+  // the subscriber leaves without releasing the sample
+  sub->Destroy();
+  sub.reset();
+
+  // a new subscriber is not blocked by the hold left behind
+  std::atomic<size_t> received_bytes(0);
+  eCAL::CSubscriber sub2("foo");
+  sub2.AddReceiveCallback([&received_bytes](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      received_bytes += static_cast<size_t>(data_->size);
+    });
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  const std::string second_s(PAYLOAD_SIZE, 'B');
+  pub.Send(second_s);
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  pub.Send(second_s);
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  EXPECT_LT(0, received_bytes);
+
+  // the held sample stays untouched
+  EXPECT_EQ(first_s, std::string(static_cast<const char*>(held->buf), static_cast<size_t>(held->size)));
+  held.reset();
+
+  // destroy subscriber
+  sub2.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, PodMessage)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // the topic information describes name, size and layout
+  const eCAL::SDataTypeInformation pose_info = eCAL::pod::GetDataTypeInformation<SPose>();
+  EXPECT_EQ("pod", pose_info.encoding);
+  EXPECT_NE(std::string::npos, pose_info.descriptor.find("size=" + std::to_string(sizeof(SPose))));
+  EXPECT_TRUE(eCAL::pod::IsCompatible<SPose>(pose_info));
+  EXPECT_FALSE(eCAL::pod::IsCompatible<double>(pose_info));
+  EXPECT_FALSE(eCAL::pod::IsCompatible<SPoseReordered>(pose_info));
+
+  // create subscriber for topic "pose", store the received messages
+  std::mutex received_mtx;
+  std::vector<SPose> received;
+  eCAL::pod::CSubscriber<SPose> sub("pose");
+  sub.AddReceiveCallback([&received_mtx, &received](const char* /*topic_name_*/, const SPose& msg_, long long /*time_*/, long long /*clock_*/, long long /*id_*/)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.push_back(msg_);
+    });
+
+  // create publisher for topic "pose"
+  eCAL::pod::CPublisher<SPose> pub("pose");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // send some poses
+  for (std::uint32_t seq = 0; seq < 3; ++seq)
+  {
+    const SPose pose{ 1.0 * seq, 2.0 * seq, 0.5, seq };
+    EXPECT_EQ(sizeof(SPose), pub.Send(pose));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_EQ(3, received.size());
+    for (std::uint32_t seq = 0; seq < 3; ++seq)
+    {
+      EXPECT_EQ(seq,       received[seq].seq);
+      EXPECT_EQ(2.0 * seq, received[seq].y);
+    }
+  }
+
+  // message types do not need to be default constructible
+  eCAL::pod::CSubscriber<SSequence> seq_sub("sequence");
+  EXPECT_TRUE(seq_sub.AddReceiveCallback([](const char* /*topic_name_*/, const SSequence& /*msg_*/, long long /*time_*/, long long /*clock_*/, long long /*id_*/) {}));
+  seq_sub.Destroy();
+
+  // receive by copy
+  sub.RemReceiveCallback();
+  const SPose pose{ 3.0, 4.0, 0.25, 42 };
+  pub.Send(pose);
+  SPose received_pose{};
+  EXPECT_TRUE(sub.Receive(received_pose, nullptr, 2 * DATA_FLOW_TIME));
+  EXPECT_EQ(42,  received_pose.seq);
+  EXPECT_EQ(4.0, received_pose.y);
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+namespace
+{
+  // string message publisher with a serializer failing on request
+  class CFailingStringPublisher : public eCAL::CMsgPublisher<std::string>
+  {
+  public:
+    explicit CFailingStringPublisher(const std::string& topic_name_) : eCAL::CMsgPublisher<std::string>(topic_name_) {}
+
+    std::atomic<bool> fail_serialize{ false };
+
+  private:
+    size_t GetSize(const std::string& msg_) const override
+    {
+      return msg_.size();
+    }
+
+    bool Serialize(const std::string& msg_, char* buffer_, size_t size_) const override
+    {
+      if (fail_serialize || (msg_.size() > size_)) return false;
+      memcpy(buffer_, msg_.data(), msg_.size());
+      return true;
+    }
+  };
+}
+
+TEST(PubSub, FailedSerialization)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "failing", store the received payloads
+  std::mutex received_mtx;
+  std::vector<std::string> received;
+  eCAL::CSubscriber sub("failing");
+  sub.AddReceiveCallback([&received_mtx, &received](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.emplace_back(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size));
+    });
+
+  // create publisher for topic "failing"
+  CFailingStringPublisher pub("failing");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  const std::string first_s(PAYLOAD_SIZE, 'A');
+  EXPECT_EQ(first_s.size(), pub.Send(first_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  // a failing serialization publishes nothing
+  pub.fail_serialize = true;
+  const std::string second_s(PAYLOAD_SIZE, 'B');
+  EXPECT_EQ(0, pub.Send(second_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  // the next message is serialized completely again
+  pub.fail_serialize = false;
+  const std::string third_s(PAYLOAD_SIZE, 'C');
+  EXPECT_EQ(third_s.size(), pub.Send(third_s));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_EQ(2, received.size());
+    EXPECT_EQ(first_s, received[0]);
+    EXPECT_EQ(third_s, received[1]);
+  }
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, LatestValue)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo" in latest value mode
+  eCAL::CSubscriber sub("foo");
+  EXPECT_TRUE(sub.SetLatestValueMode(true, PAYLOAD_SIZE));
+
+  // nothing received so far
+  eCAL::SLatestSample sample;
+  EXPECT_FALSE(sub.ReadLatest(sample));
+
+  // create publisher for topic "foo"
+  eCAL::CPublisher pub("foo");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // only the latest of several samples is read
+  for (char c = 'A'; c <= 'C'; ++c)
+  {
+    pub.Send(std::string(PAYLOAD_SIZE, c));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  }
+  ASSERT_TRUE(sub.ReadLatest(sample));
+  EXPECT_TRUE(sample.is_new);
+  EXPECT_EQ(std::string(PAYLOAD_SIZE, 'C'), std::string(static_cast<const char*>(sample.buf), sample.size));
+  EXPECT_GE(sample.age, DATA_FLOW_TIME * 1000 / 2);
+  const long long sequence = sample.sequence;
+
+  // reading again returns the same (aging) sample
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  ASSERT_TRUE(sub.ReadLatest(sample));
+  EXPECT_FALSE(sample.is_new);
+  EXPECT_EQ(sequence, sample.sequence);
+  EXPECT_GE(sample.age, DATA_FLOW_TIME * 1000);
+
+  // the next sample has a new sequence, the samples do not reach the receive buffer
+  pub.Send(std::string(PAYLOAD_SIZE / 2, 'D'));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  ASSERT_TRUE(sub.ReadLatest(sample));
+  EXPECT_TRUE(sample.is_new);
+  EXPECT_EQ(sequence + 1, sample.sequence);
+  EXPECT_EQ(std::string(PAYLOAD_SIZE / 2, 'D'), std::string(static_cast<const char*>(sample.buf), sample.size));
+  std::string rcv_buf;
+  EXPECT_FALSE(sub.ReceiveBuffer(rcv_buf));
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, SubscriberFilter)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo" accepting id 1 only
+  eCAL::CSubscriber sub_id("foo");
+  EXPECT_TRUE(sub_id.SetID({ 1 }));
+  std::atomic<int> received_id(0);
+  std::atomic<int> received_other_id(0);
+  sub_id.AddReceiveCallback([&received_id, &received_other_id](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      if (data_->id == 1) received_id++;
+      else                received_other_id++;
+    });
+  std::atomic<int> dropped_id(0);
+  sub_id.AddEventCallback(sub_event_dropped, [&dropped_id](const char* /*topic_name_*/, const struct eCAL::SSubEventCallbackData* /*data_*/)
+    {
+      dropped_id++;
+    });
+
+  // create subscriber for topic "foo" limited to 20 Hz
+  eCAL::CSubscriber sub_freq("foo");
+  EXPECT_TRUE(sub_freq.SetMaxFrequency(20.0));
+  std::atomic<int> received_freq(0);
+  sub_freq.AddReceiveCallback([&received_freq](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* /*data_*/)
+    {
+      received_freq++;
+    });
+
+  // create publisher for topic "foo"
+  eCAL::CPublisher pub("foo");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // send 20 samples with alternating id's every 10 ms (publisher time)
+  const std::string send_s(PAYLOAD_SIZE, 'X');
+  for (long long idx = 0; idx < 20; ++idx)
+  {
+    pub.SetID(1 + idx % 2);
+    EXPECT_EQ(send_s.size(), pub.Send(send_s, 1000 + idx * 10000));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME / 5);
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  // every second sample matches the id, skipped samples are no drops
+  EXPECT_EQ(10, received_id);
+  EXPECT_EQ(0, received_other_id);
+  EXPECT_EQ(0, dropped_id);
+
+  // every fifth sample passes the frequency limit
+  EXPECT_EQ(4, received_freq);
+
+  // destroy subscribers
+  sub_id.Destroy();
+  sub_freq.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, PayloadCompression)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscriber for topic "foo"
+  eCAL::CSubscriber sub("foo");
+  std::mutex received_mtx;
+  std::vector<std::string> received;
+  sub.AddReceiveCallback([&received_mtx, &received](const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.emplace_back(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size));
+    });
+
+  // create publisher for topic "foo" with compressed network payloads
+  eCAL::CPublisher pub("foo");
+  EXPECT_TRUE(pub.SetCompression(eCAL::TLayer::compression_lz));
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // compressible, incompressible and small payloads are received unchanged
+  std::string compressible;
+  while (compressible.size() < PAYLOAD_SIZE) compressible += "x=1.0;y=2.0;z=3.0;";
+  std::string incompressible(PAYLOAD_SIZE, '\0');
+  for (size_t idx = 0; idx < incompressible.size(); ++idx) incompressible[idx] = static_cast<char>((idx * 7919) ^ (idx >> 3));
+  const std::vector<std::string> send_vector{ compressible, incompressible, "small" };
+  for (const auto& send_s : send_vector)
+  {
+    EXPECT_EQ(send_s.size(), pub.Send(send_s));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME);
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    EXPECT_EQ(send_vector, received);
+  }
+
+  // destroy subscriber
+  sub.Destroy();
+
+  // destroy publisher
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+TEST(PubSub, SendBatch)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create subscribers and publishers
+  const std::vector<std::string> topics{ "batch_a", "batch_b", "batch_c" };
+  std::mutex received_mtx;
+  std::vector<std::pair<std::string, long long>> received;
+  std::vector<std::unique_ptr<eCAL::CSubscriber>> subs;
+  std::vector<std::unique_ptr<eCAL::CPublisher>>  pubs;
+  for (const auto& topic : topics)
+  {
+    subs.emplace_back(std::make_unique<eCAL::CSubscriber>(topic));
+    subs.back()->AddReceiveCallback([&received_mtx, &received](const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      {
+        const std::lock_guard<std::mutex> lock(received_mtx);
+        received.emplace_back(std::string(topic_name_) + ":" + std::string(static_cast<const char*>(data_->buf), static_cast<size_t>(data_->size)), data_->time);
+      });
+    pubs.emplace_back(std::make_unique<eCAL::CPublisher>(topic));
+  }
+
+  // a publisher without subscriber
+  eCAL::CPublisher pub_unsubscribed("batch_unsubscribed");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // every message of the frame is sent with the frame time, invalid entries are skipped
+  CStringPayload payload_a("A"), payload_b("BB"), payload_c("CCC"), payload_unsubscribed("DDDD");
+  const std::vector<eCAL::SPublisherPayload> batch{ { pubs[0].get(), &payload_a }, { pubs[1].get(), &payload_b }, { nullptr, &payload_a },
+                                                    { pubs[2].get(), &payload_c }, { &pub_unsubscribed, &payload_unsubscribed }, { pubs[0].get(), nullptr } };
+  EXPECT_EQ(10, eCAL::CPublisher::SendBatch(batch, 4711));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    std::sort(received.begin(), received.end());
+    const std::vector<std::pair<std::string, long long>> expected{ { "batch_a:A", 4711 }, { "batch_b:BB", 4711 }, { "batch_c:CCC", 4711 } };
+    EXPECT_EQ(expected, received);
+    received.clear();
+  }
+
+  // the default time is one eCAL time stamp for the whole frame
+  EXPECT_EQ(10, eCAL::CPublisher::SendBatch(batch));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    ASSERT_EQ(topics.size(), received.size());
+    for (const auto& sample : received)
+    {
+      EXPECT_EQ(received.front().second, sample.second);
+    }
+    received.clear();
+  }
+
+  // a publisher occurring twice sends both messages one after another, the latest one arrives last
+  CStringPayload payload_a2("A2");
+  const std::vector<eCAL::SPublisherPayload> batch_twice{ { pubs[0].get(), &payload_a }, { pubs[1].get(), &payload_b }, { pubs[0].get(), &payload_a2 } };
+  EXPECT_EQ(5, eCAL::CPublisher::SendBatch(batch_twice, 4712));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME);
+
+  {
+    const std::lock_guard<std::mutex> lock(received_mtx);
+    std::vector<std::string> received_a;
+    for (const auto& sample : received)
+    {
+      if (sample.first.compare(0, 8, "batch_a:") == 0) received_a.push_back(sample.first);
+    }
+    ASSERT_FALSE(received_a.empty());
+    EXPECT_EQ("batch_a:A2", received_a.back());
+  }
+
+  // destroy subscribers and publishers
+  subs.clear();
+  pubs.clear();
+  pub_unsubscribed.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
+
+namespace
+{
+  // process cpu time consumed while sending some samples with pauses in between
+  std::chrono::milliseconds CpuTimeOfSends(eCAL::CPublisher& pub_, int sends_, int pause_ms_)
+  {
+    const std::clock_t cpu_start = std::clock();
+    for (int i = 0; i < sends_; ++i)
+    {
+      pub_.Send("spin");
+      eCAL::Process::SleepMS(pause_ms_);
+    }
+    return std::chrono::milliseconds(static_cast<long long>(1000.0 * static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC));
+  }
+}
+
+TEST(PubSub, ShmSpinBudget)
+{
+  // initialize eCAL API
+  eCAL::Initialize(0, nullptr, "pubsub_test");
+
+  // publish / subscribe match in the same process
+  eCAL::Util::EnableLoopback(true);
+
+  // create two subscribers sharing the memory file observer, one of them busy polls after every sample
+  const auto spin_budget = std::chrono::milliseconds(200);
+  const int  sends(4);
+  const int  pause_ms(300);
+  eCAL::CSubscriber sub_plain("spin_budget");
+  auto sub_spin = std::make_unique<eCAL::CSubscriber>("spin_budget");
+  sub_spin->ShmSetSpinBudget(spin_budget);
+
+  // create publisher
+  eCAL::CPublisher pub("spin_budget");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+
+  // the receive thread spins after every sample
+  const auto spin_cpu_time = CpuTimeOfSends(pub, sends, pause_ms);
+  EXPECT_GT(spin_cpu_time, sends * spin_budget / 2);
+
+  // a lowered budget is applied with the next publisher registration
+  sub_spin->ShmSetSpinBudget(std::chrono::microseconds(0));
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  EXPECT_LT(CpuTimeOfSends(pub, sends, pause_ms), spin_cpu_time / 4);
+
+  // the budget of a destroyed subscriber is dropped right away
+  sub_spin->ShmSetSpinBudget(spin_budget);
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH);
+  EXPECT_GT(CpuTimeOfSends(pub, sends, pause_ms), sends * spin_budget / 2);
+  sub_spin.reset();
+  EXPECT_LT(CpuTimeOfSends(pub, sends, pause_ms), spin_cpu_time / 4);
+
+  // destroy subscriber and publisher
+  sub_plain.Destroy();
+  pub.Destroy();
+
+  // finalize eCAL API
+  EXPECT_EQ(0, eCAL::Finalize());
+}
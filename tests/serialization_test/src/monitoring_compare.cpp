@@ -23,6 +23,27 @@ namespace eCAL
 {
   namespace Monitoring
   {
+    // compare two latency histogram summaries
+    bool CompareLatency(const SLatencyMon& latency1, const SLatencyMon& latency2)
+    {
+      return (latency1.count == latency2.count) &&
+             (latency1.min   == latency2.min) &&
+             (latency1.max   == latency2.max) &&
+             (latency1.mean  == latency2.mean) &&
+             (latency1.p50   == latency2.p50) &&
+             (latency1.p90   == latency2.p90) &&
+             (latency1.p99   == latency2.p99) &&
+             (latency1.p999  == latency2.p999);
+    }
+
+    // compare two topic latency structs
+    bool CompareTopicLatency(const STopicLatencyMon& latency1, const STopicLatencyMon& latency2)
+    {
+      return CompareLatency(latency1.delivery, latency2.delivery) &&
+             CompareLatency(latency1.callback, latency2.callback) &&
+             CompareLatency(latency1.shm_lock, latency2.shm_lock);
+    }
+
     // compare two monitoring structs
     bool CompareMonitorings(const SMonitoring& monitoring1, const SMonitoring& monitoring2)
     {
@@ -84,6 +105,7 @@ namespace eCAL
           monitoring1.publisher[i].did != monitoring2.publisher[i].did ||
           monitoring1.publisher[i].dclock != monitoring2.publisher[i].dclock ||
           monitoring1.publisher[i].dfreq != monitoring2.publisher[i].dfreq ||
+          !CompareTopicLatency(monitoring1.publisher[i].latency, monitoring2.publisher[i].latency) ||
           monitoring1.publisher[i].attr != monitoring2.publisher[i].attr)
         {
           return false;
@@ -118,6 +140,7 @@ namespace eCAL
           monitoring1.subscriber[i].did != monitoring2.subscriber[i].did ||
           monitoring1.subscriber[i].dclock != monitoring2.subscriber[i].dclock ||
           monitoring1.subscriber[i].dfreq != monitoring2.subscriber[i].dfreq ||
+          !CompareTopicLatency(monitoring1.subscriber[i].latency, monitoring2.subscriber[i].latency) ||
           monitoring1.subscriber[i].attr != monitoring2.subscriber[i].attr)
         {
           return false;
@@ -52,6 +52,21 @@ namespace eCAL
     }
 
     // generate topic
+    // generate latency histogram summary
+    SLatencyMon GenerateLatency()
+    {
+      SLatencyMon latency;
+      latency.count = rand();
+      latency.min   = rand() % 100;
+      latency.max   = rand() % 100000;
+      latency.mean  = rand() % 1000;
+      latency.p50   = rand() % 1000;
+      latency.p90   = rand() % 5000;
+      latency.p99   = rand() % 10000;
+      latency.p999  = rand() % 50000;
+      return latency;
+    }
+
     STopicMon GenerateTopic(const std::string& direction)
     {
       STopicMon publisher;
@@ -75,6 +90,9 @@ namespace eCAL
       publisher.did                  = rand() % 10000;
       publisher.dclock               = rand() % 10000;
       publisher.dfreq                = rand() % 100;
+      publisher.latency.delivery     = GenerateLatency();
+      publisher.latency.callback     = GenerateLatency();
+      publisher.latency.shm_lock     = GenerateLatency();
       return publisher;
     }
 
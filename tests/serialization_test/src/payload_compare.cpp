@@ -43,7 +43,8 @@ namespace eCAL
           sample1.content.clock != sample2.content.clock ||
           sample1.content.time  != sample2.content.time ||
           sample1.content.hash  != sample2.content.hash ||
-          sample1.content.size  != sample2.content.size) {
+          sample1.content.size  != sample2.content.size ||
+          sample1.content.compression != sample2.content.compression) {
         return false;
       }
 
@@ -68,6 +68,7 @@ namespace eCAL
       content.time    = rand() % 10000;
       content.hash    = rand() % 100000;
       content.size    = rand() % 50;
+      content.compression = rand() % 2;
       content.payload = GeneratePayload(payload_addr, payload_size);
 
       return content;
@@ -82,6 +83,7 @@ namespace eCAL
       content.time    = rand() % 10000;
       content.hash    = rand() % 100000;
       content.size    = rand() % 50;
+      content.compression = rand() % 2;
       content.payload = GeneratePayload(payload_vec);
 
       return content;
@@ -110,15 +110,16 @@ namespace eCAL
     }
 
     // compare two LayerParUdpMC objects
-    bool CompareLayerParUdpMC(const LayerParUdpMC& /*par1*/, const LayerParUdpMC& /*par2*/)
+    bool CompareLayerParUdpMC(const LayerParUdpMC& par1, const LayerParUdpMC& par2)
     {
-      return true;
+      return par1.compression == par2.compression;
     }
 
     // compare two LayerParTcp objects
     bool CompareLayerParTcp(const LayerParTcp& par1, const LayerParTcp& par2)
     {
-      return par1.port == par2.port;
+      return par1.port == par2.port &&
+             par1.compression == par2.compression;
     }
 
     // compare two LayerParShm objects
@@ -150,10 +151,26 @@ namespace eCAL
           return (layer1.type      == layer2.type) &&
                  (layer1.version   == layer2.version) &&
                  (layer1.confirmed == layer2.confirmed) &&
+                 (layer1.queue_depth     == layer2.queue_depth) &&
+                 (layer1.queue_max_depth == layer2.queue_max_depth) &&
+                 (layer1.queue_drops     == layer2.queue_drops) &&
                  CompareConnectionPar(layer1.par_layer, layer2.par_layer);
         });
     }
 
+    // compare two LatencyHistogram objects
+    bool CompareLatencyHistogram(const LatencyHistogram& histogram1, const LatencyHistogram& histogram2)
+    {
+      return (histogram1.count == histogram2.count) &&
+             (histogram1.min   == histogram2.min) &&
+             (histogram1.max   == histogram2.max) &&
+             (histogram1.mean  == histogram2.mean) &&
+             (histogram1.p50   == histogram2.p50) &&
+             (histogram1.p90   == histogram2.p90) &&
+             (histogram1.p99   == histogram2.p99) &&
+             (histogram1.p999  == histogram2.p999);
+    }
+
     // compare two Topic objects
     bool CompareTopic(const Topic& topic1, const Topic& topic2)
     {
@@ -177,6 +194,11 @@ namespace eCAL
              (topic1.did             == topic2.did) &&
              (topic1.dclock          == topic2.dclock) &&
              (topic1.dfreq           == topic2.dfreq) &&
+             CompareLatencyHistogram(topic1.latency.delivery, topic2.latency.delivery) &&
+             CompareLatencyHistogram(topic1.latency.callback, topic2.latency.callback) &&
+             CompareLatencyHistogram(topic1.latency.shm_lock, topic2.latency.shm_lock) &&
+             (topic1.filter.ids      == topic2.filter.ids) &&
+             (topic1.filter.max_freq == topic2.filter.max_freq) &&
              (topic1.attr            == topic2.attr);
     }
 
@@ -94,10 +94,30 @@ namespace eCAL
       layer.type      = static_cast<eTLayerType>(rand() % (tl_all + 1));
       layer.version   = rand() % 100;
       layer.confirmed = rand() % 2 == 1;
+      layer.queue_depth     = rand() % 32;
+      layer.queue_max_depth = rand() % 32;
+      layer.queue_drops     = rand();
+      layer.par_layer.layer_par_udpmc.compression = rand() % 2;
+      layer.par_layer.layer_par_tcp.compression   = rand() % 2;
       return layer;
     }
 
     // generate Topic
+    // generate LatencyHistogram
+    LatencyHistogram GenerateLatencyHistogram()
+    {
+      LatencyHistogram histogram;
+      histogram.count = rand();
+      histogram.min   = rand() % 100;
+      histogram.max   = rand() % 100000;
+      histogram.mean  = rand() % 1000;
+      histogram.p50   = rand() % 1000;
+      histogram.p90   = rand() % 5000;
+      histogram.p99   = rand() % 10000;
+      histogram.p999  = rand() % 50000;
+      return histogram;
+    }
+
     Topic GenerateTopic()
     {
       Topic topic;
@@ -122,6 +142,11 @@ namespace eCAL
       topic.did             = rand();
       topic.dclock          = rand();
       topic.dfreq           = rand() % 100;
+      topic.latency.delivery = GenerateLatencyHistogram();
+      topic.latency.callback = GenerateLatencyHistogram();
+      topic.latency.shm_lock = GenerateLatencyHistogram();
+      topic.filter.ids       = { rand() % 100, -(rand() % 100), static_cast<int64_t>(rand()) << 32 };
+      topic.filter.max_freq  = rand() % 100000;
       return topic;
     }
 
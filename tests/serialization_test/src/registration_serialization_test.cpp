@@ -21,6 +21,9 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <vector>
+
 namespace eCAL
 {
   namespace Registration
@@ -87,5 +90,72 @@ namespace eCAL
       ASSERT_TRUE(sample_list_in.samples.size() == sample_list_out.samples.size());
       ASSERT_TRUE(std::equal(sample_list_in.samples.begin(), sample_list_in.samples.end(), sample_list_out.samples.begin(), CompareRegistrationSamples));
     }
+
+    TEST(Serialization, RegistrationListFromSerializedSamples)
+    {
+      SampleList sample_list_in;
+      sample_list_in.samples.push_back(GenerateRegistrationSample());
+      sample_list_in.samples.push_back(GenerateRegistrationSample());
+      sample_list_in.samples.push_back(GenerateRegistrationSample());
+
+      // build the list from the single serialized samples
+      std::vector<char> sample_list_buffer;
+      for (const auto& sample : sample_list_in.samples)
+      {
+        std::vector<char> sample_buffer;
+        ASSERT_TRUE(SerializeToBuffer(sample, sample_buffer));
+
+        const size_t list_size = sample_list_buffer.size();
+        AppendToSampleListBuffer(sample_buffer, sample_list_buffer);
+        ASSERT_EQ(GetSampleListEntrySize(sample_buffer.size()), sample_list_buffer.size() - list_size);
+      }
+
+      // has to match the regular list serialization
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeToBuffer(sample_list_in, sample_buffer));
+      ASSERT_TRUE(sample_buffer == sample_list_buffer);
+
+      SampleList sample_list_out;
+      ASSERT_TRUE(DeserializeFromBuffer(sample_list_buffer.data(), sample_list_buffer.size(), sample_list_out));
+
+      ASSERT_TRUE(sample_list_in.samples.size() == sample_list_out.samples.size());
+      ASSERT_TRUE(std::equal(sample_list_in.samples.begin(), sample_list_in.samples.end(), sample_list_out.samples.begin(), CompareRegistrationSamples));
+    }
+  
+    TEST(Serialization, RegistrationSnapshot2Buffers)
+    {
+      std::vector<std::shared_ptr<const Sample>> samples;
+      for (size_t idx = 0; idx < 101; ++idx)
+      {
+        samples.push_back(std::make_shared<const Sample>(GenerateRegistrationSample()));
+      }
+
+      // single worker reference
+      std::vector<std::vector<char>> reference_buffers;
+      ASSERT_TRUE(SerializeToBuffers(samples, reference_buffers, 1));
+      ASSERT_EQ(samples.size(), reference_buffers.size());
+
+      // multiple workers (uneven chunks and more workers than samples) have to produce the same buffers
+      for (const size_t workers : { size_t(2), size_t(3), size_t(8), size_t(1000) })
+      {
+        std::vector<std::vector<char>> sample_buffers;
+        ASSERT_TRUE(SerializeToBuffers(samples, sample_buffers, workers));
+        ASSERT_TRUE(sample_buffers == reference_buffers);
+      }
+
+      // reused buffers keep their size, only the first samples are overwritten
+      std::vector<std::shared_ptr<const Sample>> samples_head(samples.begin(), samples.begin() + 10);
+      std::vector<std::vector<char>> sample_buffers(reference_buffers);
+      ASSERT_TRUE(SerializeToBuffers(samples_head, sample_buffers, 4));
+      ASSERT_EQ(reference_buffers.size(), sample_buffers.size());
+      ASSERT_TRUE(sample_buffers == reference_buffers);
+
+      for (size_t idx = 0; idx < samples.size(); ++idx)
+      {
+        Sample sample_out;
+        ASSERT_TRUE(DeserializeFromBuffer(sample_buffers[idx].data(), sample_buffers[idx].size(), sample_out));
+        ASSERT_TRUE(CompareRegistrationSamples(*samples[idx], sample_out));
+      }
+    }
   }
 }
@@ -0,0 +1,140 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "util/ecal_bounded_queue.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  using QueueT = eCAL::Util::CBoundedQueue<std::vector<int>>;
+}
+
+TEST(BoundedQueue, DropOldest)
+{
+  QueueT queue(3, QueueT::eOverflowPolicy::drop_oldest);
+
+  for (int value = 0; value < 5; ++value)
+  {
+    std::vector<int> element{ value };
+    EXPECT_TRUE(queue.Push(element));
+  }
+
+  // the two oldest elements are dropped
+  auto statistics = queue.GetStatistics();
+  EXPECT_EQ(3, statistics.depth);
+  EXPECT_EQ(3, statistics.max_depth);
+  EXPECT_EQ(2, statistics.drops);
+
+  std::vector<int> element;
+  for (int value = 2; value < 5; ++value)
+  {
+    ASSERT_TRUE(queue.Pop(element));
+    ASSERT_EQ(1, element.size());
+    EXPECT_EQ(value, element[0]);
+  }
+  EXPECT_EQ(0, queue.GetStatistics().depth);
+
+  // closed and empty queues return immediately
+  queue.Close();
+  EXPECT_FALSE(queue.Pop(element));
+  EXPECT_FALSE(queue.Push(element));
+
+  queue.Reopen();
+  element = { 5 };
+  EXPECT_TRUE(queue.Push(element));
+  EXPECT_EQ(1, queue.GetStatistics().depth);
+}
+
+TEST(BoundedQueue, TryPop)
+{
+  QueueT queue(2, QueueT::eOverflowPolicy::block);
+
+  // an empty queue does not wait for the producer
+  std::vector<int> element;
+  EXPECT_FALSE(queue.TryPop(element));
+
+  element = { 1 };
+  EXPECT_TRUE(queue.Push(element));
+  ASSERT_TRUE(queue.TryPop(element));
+  ASSERT_EQ(1, element.size());
+  EXPECT_EQ(1, element[0]);
+
+  // queued elements are still served after closing
+  element = { 2 };
+  EXPECT_TRUE(queue.Push(element));
+  queue.Close();
+  ASSERT_TRUE(queue.TryPop(element));
+  EXPECT_EQ(2, element[0]);
+  EXPECT_FALSE(queue.TryPop(element));
+}
+
+TEST(BoundedQueue, RecycledStorage)
+{
+  QueueT queue(2, QueueT::eOverflowPolicy::drop_oldest);
+
+  // the producer gets back the storage of the consumed elements
+  std::vector<int> produced;
+  std::vector<int> consumed;
+  produced.reserve(1024);
+  const int* storage = produced.data();
+
+  EXPECT_TRUE(queue.Push(produced));
+  ASSERT_TRUE(queue.Pop(consumed));
+  EXPECT_EQ(storage, consumed.data());
+
+  produced.reserve(1024);
+  EXPECT_TRUE(queue.Push(produced));
+  EXPECT_TRUE(queue.Pop(consumed));
+  EXPECT_TRUE(queue.Push(produced));
+  EXPECT_EQ(storage, produced.data());
+  EXPECT_EQ(1024, produced.capacity());
+}
+
+TEST(BoundedQueue, BlockOnOverflow)
+{
+  const int element_count(10000);
+  QueueT queue(4, QueueT::eOverflowPolicy::block);
+
+  // a slow consumer does not lose elements
+  std::vector<int> received;
+  std::thread consumer([&queue, &received]()
+    {
+      std::vector<int> element;
+      while (queue.Pop(element)) received.push_back(element[0]);
+    });
+
+  for (int value = 0; value < element_count; ++value)
+  {
+    std::vector<int> element{ value };
+    EXPECT_TRUE(queue.Push(element));
+  }
+  queue.Close();
+  consumer.join();
+
+  const auto statistics = queue.GetStatistics();
+  EXPECT_EQ(0, statistics.drops);
+  EXPECT_LE(statistics.max_depth, 4);
+  ASSERT_EQ(element_count, received.size());
+  for (int value = 0; value < element_count; ++value) EXPECT_EQ(value, received[value]);
+}
@@ -0,0 +1,101 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/ecal_latency_histogram.h"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(LatencyHistogram, EmptyHistogram)
+{
+  const eCAL::Util::CLatencyHistogram histogram;
+  const auto summary = histogram.GetSummary();
+  EXPECT_EQ(0, summary.count);
+  EXPECT_EQ(0, summary.min);
+  EXPECT_EQ(0, summary.max);
+  EXPECT_EQ(0, summary.p999);
+}
+
+TEST(LatencyHistogram, Percentiles)
+{
+  eCAL::Util::CLatencyHistogram histogram;
+
+  // 1 .. 10000 ns
+  for (std::int64_t value = 1; value <= 10000; ++value) histogram.Record(value);
+
+  const auto summary = histogram.GetSummary();
+  EXPECT_EQ(10000, summary.count);
+  EXPECT_EQ(1,     summary.min);
+  EXPECT_EQ(10000, summary.max);
+  EXPECT_EQ(5000,  summary.mean);
+
+  // percentiles are bucket upper bounds, so they are never below the exact value and at most 12.5 % above
+  const auto expect_near = [](std::int64_t expected_, std::int64_t value_)
+  {
+    EXPECT_GE(value_, expected_);
+    EXPECT_LE(value_, expected_ + expected_ / 8);
+  };
+  expect_near(5000, summary.p50);
+  expect_near(9000, summary.p90);
+  expect_near(9900, summary.p99);
+  expect_near(9990, summary.p999);
+  EXPECT_LE(summary.p999, summary.max);
+}
+
+TEST(LatencyHistogram, ValueRange)
+{
+  eCAL::Util::CLatencyHistogram histogram;
+
+  // negative values (unsynchronized clocks) are counted as zero, huge values in the last bucket
+  histogram.Record(-5);
+  histogram.Record(std::chrono::hours(1));
+
+  const auto summary = histogram.GetSummary();
+  EXPECT_EQ(2, summary.count);
+  EXPECT_EQ(0, summary.min);
+  EXPECT_EQ(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::hours(1)).count(), summary.max);
+  EXPECT_EQ(0, summary.p50);
+  EXPECT_EQ(summary.max, summary.p999);
+}
+
+TEST(LatencyHistogram, ConcurrentRecording)
+{
+  eCAL::Util::CLatencyHistogram histogram;
+
+  const int thread_count(4);
+  const int record_count(100000);
+  std::vector<std::thread> threads;
+  for (int thread_num = 0; thread_num < thread_count; ++thread_num)
+  {
+    threads.emplace_back([&histogram, record_count]()
+      {
+        for (int value = 0; value < record_count; ++value) histogram.Record(value);
+      });
+  }
+  for (auto& thread : threads) thread.join();
+
+  const auto summary = histogram.GetSummary();
+  EXPECT_EQ(thread_count * record_count, summary.count);
+  EXPECT_EQ(0, summary.min);
+  EXPECT_EQ(record_count - 1, summary.max);
+}
@@ -0,0 +1,72 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "util/ecal_lz_codec.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace LzCodec = eCAL::Util::LzCodec;
+
+TEST(LzCodec, RoundTrip)
+{
+  // repetitive content with overlapping matches and long literal / match runs
+  std::string payload;
+  for (int line = 0; line < 200; ++line) payload += "point " + std::to_string(line % 17) + " : 0.0 0.0 1.0;";
+  payload += std::string(1000, 'A');
+
+  std::vector<char> compressed;
+  ASSERT_TRUE(LzCodec::Compress(payload.data(), payload.size(), compressed));
+  EXPECT_LT(compressed.size(), payload.size() / 4);
+
+  std::vector<char> decompressed;
+  ASSERT_TRUE(LzCodec::Decompress(compressed.data(), compressed.size(), decompressed));
+  EXPECT_EQ(payload, std::string(decompressed.begin(), decompressed.end()));
+}
+
+TEST(LzCodec, Incompressible)
+{
+  // random and small payloads are sent uncompressed
+  std::mt19937 generator(42);
+  std::vector<char> payload(4096);
+  for (auto& byte : payload) byte = static_cast<char>(generator());
+
+  std::vector<char> compressed;
+  EXPECT_FALSE(LzCodec::Compress(payload.data(), payload.size(), compressed));
+  EXPECT_FALSE(LzCodec::Compress(payload.data(), LzCodec::min_input_size - 1, compressed));
+}
+
+TEST(LzCodec, CorruptedFrame)
+{
+  const std::string payload(512, 'X');
+  std::vector<char> compressed;
+  ASSERT_TRUE(LzCodec::Compress(payload.data(), payload.size(), compressed));
+
+  // truncated frames and wrong sizes are rejected
+  std::vector<char> decompressed;
+  EXPECT_FALSE(LzCodec::Decompress(compressed.data(), compressed.size() - 1, decompressed));
+  EXPECT_FALSE(LzCodec::Decompress(compressed.data(), 3, decompressed));
+  compressed[0]++;
+  EXPECT_FALSE(LzCodec::Decompress(compressed.data(), compressed.size(), decompressed));
+}
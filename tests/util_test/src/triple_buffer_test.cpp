@@ -0,0 +1,94 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+#include "util/ecal_triple_buffer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  struct SValue
+  {
+    std::uint64_t id    = 0;
+    std::uint64_t check = ~std::uint64_t(0);
+  };
+}
+
+TEST(TripleBuffer, LatestValue)
+{
+  eCAL::Util::CTripleBuffer<SValue> buffer;
+
+  // nothing published yet
+  EXPECT_FALSE(buffer.Update());
+
+  buffer.Back() = { 1, ~std::uint64_t(1) };
+  buffer.Publish();
+  ASSERT_TRUE(buffer.Update());
+  EXPECT_EQ(1, buffer.Front().id);
+
+  // no new value, the front slot is kept
+  EXPECT_FALSE(buffer.Update());
+  EXPECT_EQ(1, buffer.Front().id);
+
+  // only the latest of several values is read
+  for (std::uint64_t id = 2; id < 5; ++id)
+  {
+    buffer.Back() = { id, ~id };
+    buffer.Publish();
+  }
+  ASSERT_TRUE(buffer.Update());
+  EXPECT_EQ(4, buffer.Front().id);
+}
+
+TEST(TripleBuffer, ConcurrentProducerConsumer)
+{
+  const std::uint64_t value_count(1000000);
+  eCAL::Util::CTripleBuffer<SValue> buffer;
+
+  // the consumer reads consistent values in increasing order
+  std::atomic<bool> torn_value(false);
+  std::atomic<bool> order_violation(false);
+  std::thread consumer([&buffer, &torn_value, &order_violation, value_count]()
+    {
+      std::uint64_t last_id(0);
+      while (last_id + 1 < value_count)
+      {
+        if (!buffer.Update()) continue;
+        const SValue& value = buffer.Front();
+        if (value.check != ~value.id) torn_value      = true;
+        if (value.id <= last_id)      order_violation = true;
+        last_id = value.id;
+      }
+    });
+
+  for (std::uint64_t id = 1; id < value_count; ++id)
+  {
+    buffer.Back() = { id, ~id };
+    buffer.Publish();
+  }
+  consumer.join();
+
+  EXPECT_FALSE(torn_value);
+  EXPECT_FALSE(order_violation);
+}